@@ -0,0 +1,97 @@
+#include "benchmark_runner.hpp"
+#include "duckdb_benchmark_macro.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+using namespace duckdb;
+
+//////////////////
+// GROUP COMMIT //
+//////////////////
+// Many connections that each commit small transactions to an on-disk database
+// The total time measures the commit throughput, the log output reports the commit latency
+struct GroupCommitState : public DuckDBBenchmarkState {
+	explicit GroupCommitState(string path) : DuckDBBenchmarkState(path) {
+	}
+
+	//! The latency of every commit of the last run (in microseconds)
+	vector<double> latencies;
+};
+
+static constexpr const idx_t GROUP_COMMIT_THREADS = 16;
+static constexpr const idx_t GROUP_COMMIT_TRANSACTIONS = 250;
+
+#define GROUP_COMMIT_BENCHMARK(COMMIT_DELAY, STATEMENT)                                                                \
+	duckdb::unique_ptr<DuckDBBenchmarkState> CreateBenchmarkState() override {                                         \
+		return make_uniq<GroupCommitState>(GetDatabasePath());                                                         \
+	}                                                                                                                  \
+	void Load(DuckDBBenchmarkState *state) override {                                                                  \
+		state->conn.Query("CREATE TABLE accounts AS SELECT i AS id, 0 AS balance FROM range(10000) t(i)");             \
+		state->conn.Query("CREATE TABLE history(thread_id INTEGER, id INTEGER, amount INTEGER)");                      \
+		state->conn.Query("SET wal_commit_delay=" + std::to_string(COMMIT_DELAY));                                     \
+	}                                                                                                                  \
+	void RunBenchmark(DuckDBBenchmarkState *state_p) override {                                                        \
+		auto &state = (GroupCommitState &)*state_p;                                                                    \
+		vector<vector<double>> thread_latencies(GROUP_COMMIT_THREADS);                                                 \
+		vector<std::thread> threads;                                                                                   \
+		for (idx_t t = 0; t < GROUP_COMMIT_THREADS; t++) {                                                             \
+			threads.emplace_back([&, t]() {                                                                            \
+				Connection con(state.db);                                                                              \
+				for (idx_t i = 0; i < GROUP_COMMIT_TRANSACTIONS; i++) {                                                \
+					auto id = std::to_string(t * GROUP_COMMIT_TRANSACTIONS + i);                                       \
+					auto start = std::chrono::steady_clock::now();                                                     \
+					con.Query(StringUtil::Replace(STATEMENT, "$ID", id));                                              \
+					auto end = std::chrono::steady_clock::now();                                                       \
+					thread_latencies[t].push_back(                                                                     \
+					    std::chrono::duration<double, std::micro>(end - start).count());                               \
+				}                                                                                                      \
+			});                                                                                                        \
+		}                                                                                                              \
+		for (auto &thread : threads) {                                                                                 \
+			thread.join();                                                                                             \
+		}                                                                                                              \
+		state.latencies.clear();                                                                                       \
+		for (auto &latencies : thread_latencies) {                                                                     \
+			state.latencies.insert(state.latencies.end(), latencies.begin(), latencies.end());                         \
+		}                                                                                                              \
+	}                                                                                                                  \
+	string GetLogOutput(BenchmarkState *state_p) override {                                                            \
+		auto &state = (GroupCommitState &)*state_p;                                                                    \
+		auto latencies = state.latencies;                                                                              \
+		if (latencies.empty()) {                                                                                       \
+			return string();                                                                                           \
+		}                                                                                                              \
+		std::sort(latencies.begin(), latencies.end());                                                                 \
+		auto p50 = latencies[latencies.size() / 2];                                                                    \
+		auto p99 = latencies[latencies.size() * 99 / 100];                                                             \
+		return StringUtil::Format("{\"commits\": %d, \"latency_p50_us\": %.1f, \"latency_p99_us\": %.1f}",             \
+		                          latencies.size(), p50, p99);                                                         \
+	}                                                                                                                  \
+	string VerifyResult(QueryResult *result) override {                                                                \
+		return string();                                                                                               \
+	}                                                                                                                  \
+	bool InMemory() override {                                                                                         \
+		return false;                                                                                                  \
+	}                                                                                                                  \
+	string BenchmarkInfo() override {                                                                                  \
+		return StringUtil::Format("%d connections committing %d small transactions each (wal_commit_delay=%d)",        \
+		                          GROUP_COMMIT_THREADS, GROUP_COMMIT_TRANSACTIONS, COMMIT_DELAY);                      \
+	}
+
+DUCKDB_BENCHMARK(GroupCommitInsert, "[group_commit]")
+GROUP_COMMIT_BENCHMARK(0, "INSERT INTO history VALUES ($ID % 16, $ID, 1)")
+FINISH_BENCHMARK(GroupCommitInsert)
+
+DUCKDB_BENCHMARK(GroupCommitInsertDelay, "[group_commit]")
+GROUP_COMMIT_BENCHMARK(100, "INSERT INTO history VALUES ($ID % 16, $ID, 1)")
+FINISH_BENCHMARK(GroupCommitInsertDelay)
+
+DUCKDB_BENCHMARK(GroupCommitUpdate, "[group_commit]")
+GROUP_COMMIT_BENCHMARK(0, "UPDATE accounts SET balance = balance + 1 WHERE id = $ID")
+FINISH_BENCHMARK(GroupCommitUpdate)
+
+DUCKDB_BENCHMARK(GroupCommitUpdateDelay, "[group_commit]")
+GROUP_COMMIT_BENCHMARK(100, "UPDATE accounts SET balance = balance + 1 WHERE id = $ID")
+FINISH_BENCHMARK(GroupCommitUpdateDelay)
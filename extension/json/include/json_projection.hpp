@@ -0,0 +1,51 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// json_projection.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "json_common.hpp"
+
+namespace duckdb {
+
+enum class JSONProjectionType : uint8_t {
+	//! Only the projected keys of an object are needed
+	OBJECT = 0,
+	//! The projection applies to every element of an array
+	ARRAY = 1,
+};
+
+//! The part of a JSON value that is needed to transform it to a given type. A nullptr projection means that the whole
+//! value is needed. This is used by read_json to parse records "on-demand": the values of keys that are not projected
+//! are skipped over (without being validated) instead of being parsed into the yyjson DOM
+struct JSONProjection {
+public:
+	explicit JSONProjection(JSONProjectionType type);
+
+	//! Creates the projection needed to transform a value to the given type
+	static unique_ptr<JSONProjection> Create(const LogicalType &type);
+	//! Creates the projection needed to transform records to columns with the given names and types
+	static unique_ptr<JSONProjection> Create(const vector<string> &names, const vector<LogicalType> &types);
+
+	//! Writes the projected part of the JSON value in [data, data + size) to target, which must be able to hold size
+	//! bytes. Returns false if the value could not be projected, e.g., because it is malformed
+	bool Project(const char *data, idx_t size, char *target, idx_t &target_size) const;
+
+public:
+	JSONProjectionType type;
+	//! The projected keys (OBJECT)
+	vector<string> keys;
+	//! Projection of the value of each projected key (OBJECT)
+	json_key_map_t<unique_ptr<JSONProjection>> children;
+	//! Projection of the elements (ARRAY)
+	unique_ptr<JSONProjection> element;
+
+private:
+	void AddKey(const string &key, unique_ptr<JSONProjection> child);
+};
+
+} // namespace duckdb
@@ -16,6 +16,7 @@
 #include "duckdb/function/scalar/strftime_format.hpp"
 #include "duckdb/function/table_function.hpp"
 #include "json_enums.hpp"
+#include "json_projection.hpp"
 #include "json_transform.hpp"
 
 namespace duckdb {
@@ -133,6 +134,9 @@ public:
 	//! If a struct contains more fields than this threshold with at least 80% similar types,
 	//! we infer it as MAP type
 	idx_t map_inference_threshold = 25;
+	//! Whether we parse records on-demand, i.e., skip over the values of keys that are not projected instead of
+	//! parsing them (these values are not validated)
+	bool on_demand = false;
 
 	//! All column names (in order)
 	vector<string> names;
@@ -180,6 +184,8 @@ public:
 	//! Column names that we're actually reading (after projection pushdown)
 	vector<string> names;
 	vector<column_t> column_indices;
+	//! The filters pushed down into the scan
+	optional_ptr<TableFilterSet> filters;
 
 	//! Buffer manager allocator
 	Allocator &allocator;
@@ -227,6 +233,9 @@ public:
 	idx_t total_read_size;
 	idx_t total_tuple_count;
 
+	//! The keys that are parsed when parsing records on-demand (if set)
+	unique_ptr<JSONProjection> projection;
+
 private:
 	bool ReadNextBuffer(JSONScanGlobalState &gstate);
 	bool ReadNextBufferInternal(JSONScanGlobalState &gstate, AllocatedData &buffer, optional_idx &buffer_index,
@@ -246,6 +255,9 @@ private:
 	void ParseNextChunk(JSONScanGlobalState &gstate);
 
 	void ParseJSON(char *const json_start, const idx_t json_size, const idx_t remaining);
+	yyjson_doc *ParseFullJSON(char *const json_start, const idx_t json_size, const idx_t remaining);
+	//! Parses only the projected part of the JSON, returns nullptr if this fails
+	yyjson_doc *ParseProjectedJSON(const char *const json_start, const idx_t json_size);
 	void ThrowObjectSizeError(const idx_t object_size);
 
 	//! Must hold the lock
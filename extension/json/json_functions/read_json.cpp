@@ -4,6 +4,8 @@
 #include "json_structure.hpp"
 #include "json_transform.hpp"
 #include "duckdb/common/helper.hpp"
+#include "duckdb/planner/table_filter.hpp"
+#include "duckdb/storage/table/column_segment.hpp"
 
 namespace duckdb {
 
@@ -256,6 +258,8 @@ unique_ptr<FunctionData> ReadJSONBind(ClientContext &context, TableFunctionBindI
 			}
 		} else if (loption == "convert_strings_to_integers") {
 			bind_data->convert_strings_to_integers = BooleanValue::Get(kv.second);
+		} else if (loption == "on_demand") {
+			bind_data->on_demand = BooleanValue::Get(kv.second);
 		}
 	}
 
@@ -320,43 +324,163 @@ unique_ptr<FunctionData> ReadJSONBind(ClientContext &context, TableFunctionBindI
 	return std::move(bind_data);
 }
 
-static void ReadJSONFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
-	auto &gstate = data_p.global_state->Cast<JSONGlobalTableFunctionState>().state;
-	auto &lstate = data_p.local_state->Cast<JSONLocalTableFunctionState>().state;
+static bool TransformJSON(JSONScanGlobalState &gstate, JSONScanLocalState &lstate, yyjson_val *values[], idx_t count,
+                          const vector<string> &names, vector<Vector *> &result_vectors) {
+	D_ASSERT(gstate.bind_data.options.record_type != JSONRecordType::AUTO_DETECT);
+	if (gstate.bind_data.options.record_type == JSONRecordType::RECORDS) {
+		return JSONTransform::TransformObject(values, lstate.GetAllocator(), count, names, result_vectors,
+		                                      lstate.transform_options);
+	}
+	D_ASSERT(gstate.bind_data.options.record_type == JSONRecordType::VALUES);
+	return JSONTransform::Transform(values, lstate.GetAllocator(), *result_vectors[0], count,
+	                                lstate.transform_options);
+}
+
+static void ThrowJSONTransformError(JSONScanGlobalState &gstate, JSONScanLocalState &lstate, idx_t object_index) {
+	string hint =
+	    gstate.bind_data.auto_detect
+	        ? "\nTry increasing 'sample_size', reducing 'maximum_depth', specifying 'columns', 'format' or "
+	          "'records' manually, setting 'ignore_errors' to true, or setting 'union_by_name' to true when "
+	          "reading multiple files with a different structure."
+	        : "\nTry setting 'auto_detect' to true, specifying 'format' or 'records' manually, or setting "
+	          "'ignore_errors' to true.";
+	lstate.ThrowTransformError(object_index, lstate.transform_options.error_message + hint);
+}
+
+//! Whether the filters over constant columns (e.g., filename or hive partitions) of the current file pass
+static bool ConstantFiltersPass(const TableFilterSet &filters, const MultiFileReaderData &reader_data) {
+	for (auto &entry : reader_data.constant_map) {
+		auto filter = filters.filters.find(entry.column_id);
+		if (filter == filters.filters.end()) {
+			continue;
+		}
+		Vector constant_vector(entry.value);
+		UnifiedVectorFormat vdata;
+		constant_vector.ToUnifiedFormat(1, vdata);
+		SelectionVector sel;
+		sel.Initialize(nullptr);
+		idx_t approved = 1;
+		ColumnSegment::FilterSelection(sel, constant_vector, vdata, *filter->second, 1, approved);
+		if (approved == 0) {
+			return false;
+		}
+	}
+	return true;
+}
 
-	const auto count = lstate.ReadNext(gstate);
+//! Removes the rows that do not pass the filters over the given (already transformed) vectors from sel
+static void FilterJSONVectors(const vector<Vector *> &vectors, const vector<reference<TableFilter>> &filters,
+                              SelectionVector &sel, const idx_t count, idx_t &approved) {
+	for (idx_t i = 0; i < vectors.size() && approved != 0; i++) {
+		UnifiedVectorFormat vdata;
+		vectors[i]->ToUnifiedFormat(count, vdata);
+		ColumnSegment::FilterSelection(sel, *vectors[i], vdata, filters[i].get(), count, approved);
+	}
+}
+
+static void ReadJSONChunk(JSONScanGlobalState &gstate, JSONScanLocalState &lstate, DataChunk &output,
+                          const idx_t count) {
 	yyjson_val **values = lstate.values;
 	output.SetCardinality(count);
+	if (count != 0 && gstate.filters && !ConstantFiltersPass(*gstate.filters, lstate.GetReaderData())) {
+		output.SetCardinality(0);
+		return;
+	}
+	if (gstate.names.empty()) {
+		return;
+	}
 
-	if (!gstate.names.empty()) {
-		vector<Vector *> result_vectors;
-		result_vectors.reserve(gstate.column_indices.size());
-		for (const auto &col_idx : gstate.column_indices) {
-			result_vectors.emplace_back(&output.data[col_idx]);
+	vector<Vector *> result_vectors;
+	result_vectors.reserve(gstate.column_indices.size());
+	for (const auto &col_idx : gstate.column_indices) {
+		result_vectors.emplace_back(&output.data[col_idx]);
+	}
+	if (!gstate.filters) {
+		if (!TransformJSON(gstate, lstate, values, count, gstate.names, result_vectors)) {
+			ThrowJSONTransformError(gstate, lstate, lstate.transform_options.object_index);
 		}
+		return;
+	}
 
-		D_ASSERT(gstate.bind_data.options.record_type != JSONRecordType::AUTO_DETECT);
-		bool success;
-		if (gstate.bind_data.options.record_type == JSONRecordType::RECORDS) {
-			success = JSONTransform::TransformObject(values, lstate.GetAllocator(), count, gstate.names, result_vectors,
-			                                         lstate.transform_options);
+	// Split the columns into the columns that are filtered on, and the remaining columns
+	vector<string> filter_names;
+	vector<Vector *> filter_vectors;
+	vector<reference<TableFilter>> column_filters;
+	vector<string> other_names;
+	vector<Vector *> other_vectors;
+	for (idx_t i = 0; i < gstate.names.size(); i++) {
+		auto filter = gstate.filters->filters.find(gstate.column_indices[i]);
+		if (filter == gstate.filters->filters.end()) {
+			other_names.push_back(gstate.names[i]);
+			other_vectors.push_back(result_vectors[i]);
 		} else {
-			D_ASSERT(gstate.bind_data.options.record_type == JSONRecordType::VALUES);
-			success = JSONTransform::Transform(values, lstate.GetAllocator(), *result_vectors[0], count,
-			                                   lstate.transform_options);
+			filter_names.push_back(gstate.names[i]);
+			filter_vectors.push_back(result_vectors[i]);
+			column_filters.push_back(*filter->second);
 		}
+	}
 
-		if (!success) {
-			string hint =
-			    gstate.bind_data.auto_detect
-			        ? "\nTry increasing 'sample_size', reducing 'maximum_depth', specifying 'columns', 'format' or "
-			          "'records' manually, setting 'ignore_errors' to true, or setting 'union_by_name' to true when "
-			          "reading multiple files with a different structure."
-			        : "\nTry setting 'auto_detect' to true, specifying 'format' or 'records' manually, or setting "
-			          "'ignore_errors' to true.";
-			lstate.ThrowTransformError(lstate.transform_options.object_index,
-			                           lstate.transform_options.error_message + hint);
+	SelectionVector sel;
+	sel.Initialize(nullptr);
+	idx_t approved = count;
+	if (gstate.bind_data.options.record_type != JSONRecordType::RECORDS || lstate.transform_options.error_unknown_key ||
+	    filter_names.empty() || other_names.empty()) {
+		// We have to transform all columns at once, and filter afterwards
+		if (!TransformJSON(gstate, lstate, values, count, gstate.names, result_vectors)) {
+			ThrowJSONTransformError(gstate, lstate, lstate.transform_options.object_index);
+		}
+		FilterJSONVectors(filter_vectors, column_filters, sel, count, approved);
+		if (approved < count) {
+			output.Slice(sel, approved);
+		}
+		return;
+	}
+
+	// Transform the filtered columns first, so we only transform the remaining columns of the rows that pass
+	if (!TransformJSON(gstate, lstate, values, count, filter_names, filter_vectors)) {
+		ThrowJSONTransformError(gstate, lstate, lstate.transform_options.object_index);
+	}
+	FilterJSONVectors(filter_vectors, column_filters, sel, count, approved);
+	output.SetCardinality(approved);
+	if (approved == 0) {
+		return;
+	}
+	if (approved < count) {
+		// the selection is increasing, so we can compact the values in place
+		for (idx_t i = 0; i < approved; i++) {
+			values[i] = values[sel.get_index(i)];
+		}
+		for (auto &vector : filter_vectors) {
+			vector->Slice(sel, approved);
+		}
+	}
+	if (!TransformJSON(gstate, lstate, values, approved, other_names, other_vectors)) {
+		ThrowJSONTransformError(gstate, lstate, sel.get_index(lstate.transform_options.object_index));
+	}
+}
+
+static void ReadJSONFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &gstate = data_p.global_state->Cast<JSONGlobalTableFunctionState>().state;
+	auto &lstate = data_p.local_state->Cast<JSONLocalTableFunctionState>().state;
+
+	if (gstate.bind_data.on_demand && !lstate.projection && !lstate.transform_options.error_unknown_key &&
+	    gstate.bind_data.options.record_type == JSONRecordType::RECORDS) {
+		// Only parse the keys we need (this can't be done if we have to error on unknown keys)
+		vector<LogicalType> types;
+		for (const auto &col_idx : gstate.column_indices) {
+			types.push_back(output.data[col_idx].GetType());
+		}
+		lstate.projection = JSONProjection::Create(gstate.names, types);
+	}
+
+	while (true) {
+		const auto count = lstate.ReadNext(gstate);
+		ReadJSONChunk(gstate, lstate, output, count);
+		if (count == 0 || output.size() != 0) {
+			break;
 		}
+		// All rows were filtered out, read the next batch
+		output.Reset();
 	}
 
 	if (output.size() != 0) {
@@ -379,8 +503,9 @@ TableFunction JSONFunctions::GetReadJSONTableFunction(shared_ptr<JSONScanInfo> f
 	table_function.named_parameters["timestamp_format"] = LogicalType::VARCHAR;
 	table_function.named_parameters["records"] = LogicalType::VARCHAR;
 	table_function.named_parameters["maximum_sample_files"] = LogicalType::BIGINT;
+	table_function.named_parameters["on_demand"] = LogicalType::BOOLEAN;
 
-	// TODO: might be able to do filter pushdown/prune ?
+	table_function.filter_pushdown = true;
 
 	table_function.function_info = std::move(function_info);
 
@@ -0,0 +1,276 @@
+#include "json_projection.hpp"
+
+namespace duckdb {
+
+JSONProjection::JSONProjection(JSONProjectionType type_p) : type(type_p) {
+}
+
+void JSONProjection::AddKey(const string &key, unique_ptr<JSONProjection> child) {
+	// the map points into the strings in "keys", so these may not be moved around
+	D_ASSERT(keys.size() < keys.capacity());
+	keys.push_back(key);
+	auto &stored_key = keys.back();
+	children.insert(make_pair(JSONKey {stored_key.c_str(), stored_key.length()}, std::move(child)));
+}
+
+unique_ptr<JSONProjection> JSONProjection::Create(const LogicalType &type) {
+	switch (type.id()) {
+	case LogicalTypeId::STRUCT: {
+		auto &child_types = StructType::GetChildTypes(type);
+		auto result = make_uniq<JSONProjection>(JSONProjectionType::OBJECT);
+		result->keys.reserve(child_types.size());
+		for (auto &child_type : child_types) {
+			result->AddKey(child_type.first, Create(child_type.second));
+		}
+		return result;
+	}
+	case LogicalTypeId::LIST: {
+		auto element = Create(ListType::GetChildType(type));
+		if (!element) {
+			return nullptr;
+		}
+		auto result = make_uniq<JSONProjection>(JSONProjectionType::ARRAY);
+		result->element = std::move(element);
+		return result;
+	}
+	default:
+		// Other types (including VARCHAR and JSON) need the whole value
+		return nullptr;
+	}
+}
+
+unique_ptr<JSONProjection> JSONProjection::Create(const vector<string> &names, const vector<LogicalType> &types) {
+	D_ASSERT(names.size() == types.size());
+	auto result = make_uniq<JSONProjection>(JSONProjectionType::OBJECT);
+	result->keys.reserve(names.size());
+	for (idx_t col_idx = 0; col_idx < names.size(); col_idx++) {
+		result->AddKey(names[col_idx], Create(types[col_idx]));
+	}
+	return result;
+}
+
+//! Copies the projected parts of a JSON value, skipping over the values that are not projected
+class JSONProjector {
+public:
+	JSONProjector(const char *data, idx_t size, char *target) : ptr(data), end(data + size), target(target) {
+	}
+
+	bool ProjectValue(optional_ptr<const JSONProjection> projection) {
+		SkipWhitespace();
+		if (ptr == end) {
+			return false;
+		}
+		if (projection && projection->type == JSONProjectionType::OBJECT && *ptr == '{') {
+			return ProjectObject(*projection);
+		}
+		if (projection && projection->type == JSONProjectionType::ARRAY && *ptr == '[') {
+			return ProjectArray(*projection->element);
+		}
+		// we need the whole value (or the value has a different type than expected, which the transform handles)
+		auto value_start = ptr;
+		if (!SkipValue()) {
+			return false;
+		}
+		Write(value_start, ptr - value_start);
+		return true;
+	}
+
+	bool AtEnd() {
+		SkipWhitespace();
+		return ptr == end;
+	}
+
+public:
+	const char *ptr;
+	const char *const end;
+	char *target;
+
+private:
+	inline void SkipWhitespace() {
+		while (ptr != end && StringUtil::CharacterIsSpace(*ptr)) {
+			ptr++;
+		}
+	}
+
+	inline void Write(const char *data, idx_t size) {
+		memcpy(target, data, size);
+		target += size;
+	}
+
+	//! Skips over the string starting at ptr, sets has_escape if the string contains escaped characters
+	inline bool SkipString(bool &has_escape) {
+		D_ASSERT(*ptr == '"');
+		for (ptr++; ptr < end; ptr++) {
+			if (*ptr == '\\') {
+				has_escape = true;
+				ptr++;
+			} else if (*ptr == '"') {
+				ptr++;
+				return true;
+			}
+		}
+		return false;
+	}
+
+	//! Skips over the value starting at ptr, only the nesting of objects and arrays is checked
+	bool SkipValue() {
+		bool has_escape = false;
+		switch (*ptr) {
+		case '"':
+			return SkipString(has_escape);
+		case '{':
+		case '[': {
+			idx_t depth = 0;
+			while (ptr < end) {
+				switch (*ptr) {
+				case '"':
+					if (!SkipString(has_escape)) {
+						return false;
+					}
+					continue;
+				case '{':
+				case '[':
+					depth++;
+					break;
+				case '}':
+				case ']':
+					if (--depth == 0) {
+						ptr++;
+						return true;
+					}
+					break;
+				default:
+					break;
+				}
+				ptr++;
+			}
+			return false;
+		}
+		default: {
+			// number, true, false, null, NaN or Infinity
+			auto value_start = ptr;
+			while (ptr != end && *ptr != ',' && *ptr != '}' && *ptr != ']' && !StringUtil::CharacterIsSpace(*ptr)) {
+				ptr++;
+			}
+			return ptr != value_start;
+		}
+		}
+	}
+
+	//! Skips over the separator after an object member or array element, returns false if the object/array ends
+	inline bool NextMember(const char close, bool &success) {
+		SkipWhitespace();
+		if (ptr != end && *ptr == ',') {
+			ptr++;
+			SkipWhitespace();
+			if (ptr != end && *ptr == close) {
+				// trailing comma
+				ptr++;
+				return false;
+			}
+			return true;
+		}
+		if (ptr != end && *ptr == close) {
+			ptr++;
+			return false;
+		}
+		success = false;
+		return false;
+	}
+
+	bool ProjectObject(const JSONProjection &projection) {
+		*target++ = *ptr++;
+		SkipWhitespace();
+		if (ptr != end && *ptr == '}') {
+			*target++ = *ptr++;
+			return true;
+		}
+		bool first = true;
+		bool success = true;
+		do {
+			SkipWhitespace();
+			if (ptr == end || *ptr != '"') {
+				return false;
+			}
+			auto key_start = ptr;
+			bool has_escape = false;
+			if (!SkipString(has_escape)) {
+				return false;
+			}
+			auto key_end = ptr;
+			SkipWhitespace();
+			if (ptr == end || *ptr != ':') {
+				return false;
+			}
+			ptr++;
+			// We can't compare keys with escaped characters without unescaping them, so we keep them entirely
+			optional_ptr<const JSONProjection> child;
+			bool projected = has_escape;
+			if (!has_escape) {
+				auto entry = projection.children.find(JSONKey {key_start + 1, idx_t(key_end - key_start - 2)});
+				if (entry != projection.children.end()) {
+					child = entry->second.get();
+					projected = true;
+				}
+			}
+			if (projected) {
+				if (!first) {
+					*target++ = ',';
+				}
+				first = false;
+				Write(key_start, key_end - key_start);
+				*target++ = ':';
+				if (!ProjectValue(child)) {
+					return false;
+				}
+			} else {
+				SkipWhitespace();
+				if (ptr == end || !SkipValue()) {
+					return false;
+				}
+			}
+		} while (NextMember('}', success));
+		if (!success) {
+			return false;
+		}
+		*target++ = '}';
+		return true;
+	}
+
+	bool ProjectArray(const JSONProjection &element) {
+		*target++ = *ptr++;
+		SkipWhitespace();
+		if (ptr != end && *ptr == ']') {
+			*target++ = *ptr++;
+			return true;
+		}
+		bool first = true;
+		bool success = true;
+		do {
+			if (!first) {
+				*target++ = ',';
+			}
+			first = false;
+			if (!ProjectValue(element)) {
+				return false;
+			}
+		} while (NextMember(']', success));
+		if (!success) {
+			return false;
+		}
+		*target++ = ']';
+		return true;
+	}
+};
+
+bool JSONProjection::Project(const char *data, idx_t size, char *target, idx_t &target_size) const {
+	JSONProjector projector(data, size, target);
+	if (!projector.ProjectValue(this) || !projector.AtEnd()) {
+		return false;
+	}
+	target_size = projector.target - target;
+	D_ASSERT(target_size <= size);
+	return true;
+}
+
+} // namespace duckdb
@@ -166,6 +166,7 @@ unique_ptr<GlobalTableFunctionState> JSONGlobalTableFunctionState::Init(ClientCo
 	auto &bind_data = input.bind_data->Cast<JSONScanData>();
 	auto result = make_uniq<JSONGlobalTableFunctionState>(context, input);
 	auto &gstate = result->state;
+	gstate.filters = input.filters;
 
 	// Perform projection pushdown
 	for (idx_t col_idx = 0; col_idx < input.column_ids.size(); col_idx++) {
@@ -380,7 +381,7 @@ static inline void TrimWhitespace(JSONString &line) {
 	}
 }
 
-void JSONScanLocalState::ParseJSON(char *const json_start, const idx_t json_size, const idx_t remaining) {
+yyjson_doc *JSONScanLocalState::ParseFullJSON(char *const json_start, const idx_t json_size, const idx_t remaining) {
 	yyjson_doc *doc;
 	yyjson_read_err err;
 	if (bind_data.type == JSONScanType::READ_JSON_OBJECTS) { // If we return strings, we cannot parse INSITU
@@ -415,6 +416,35 @@ void JSONScanLocalState::ParseJSON(char *const json_start, const idx_t json_size
 			                                "Try auto-detecting the JSON format");
 		}
 	}
+	return doc;
+}
+
+yyjson_doc *JSONScanLocalState::ParseProjectedJSON(const char *const json_start, const idx_t json_size) {
+	// The projected JSON is never larger than the input, we allocate it in the thread-local arena
+	auto alc = allocator.GetYYAlc();
+	auto projected = char_ptr_cast(alc->malloc(alc->ctx, json_size + YYJSON_PADDING_SIZE));
+	idx_t projected_size;
+	if (!projection->Project(json_start, json_size, projected, projected_size)) {
+		return nullptr;
+	}
+	memset(projected + projected_size, 0, YYJSON_PADDING_SIZE);
+	yyjson_read_err err;
+	auto doc = JSONCommon::ReadDocumentUnsafe(projected, projected_size, JSONCommon::READ_INSITU_FLAG, alc, &err);
+	if (err.code != YYJSON_READ_SUCCESS || yyjson_doc_get_read_size(doc) != projected_size) {
+		return nullptr;
+	}
+	return doc;
+}
+
+void JSONScanLocalState::ParseJSON(char *const json_start, const idx_t json_size, const idx_t remaining) {
+	yyjson_doc *doc = nullptr;
+	if (projection) {
+		// If this fails we parse the whole JSON below, which gives us the proper error
+		doc = ParseProjectedJSON(json_start, json_size);
+	}
+	if (!doc) {
+		doc = ParseFullJSON(json_start, json_size, remaining);
+	}
 
 	lines_or_objects_in_buffer++;
 	if (!doc) {
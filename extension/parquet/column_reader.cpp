@@ -153,6 +153,41 @@ void ColumnReader::RegisterPrefetch(ThriftFileTransport &transport, bool allow_m
 	}
 }
 
+bool ColumnReader::HasPageIndex() const {
+	if (!chunk || HasRepeats() || reader.parquet_options.encryption_config) {
+		// the page index of repeated columns is expressed in rows rather than in values - we only use it for
+		// non-repeated columns
+		return false;
+	}
+	return chunk->__isset.column_index_offset && chunk->__isset.offset_index_offset;
+}
+
+template <class T>
+void ColumnReader::ReadPageIndex(T &index, idx_t offset) {
+	// the page index is stored separately from the column chunk - restore the location after reading it
+	auto &trans = reinterpret_cast<ThriftFileTransport &>(*protocol->getTransport());
+	auto current_location = trans.GetLocation();
+	trans.SetLocation(offset);
+	reader.Read(index, *protocol);
+	trans.SetLocation(current_location);
+}
+
+unique_ptr<ColumnIndex> ColumnReader::ReadColumnIndex() {
+	D_ASSERT(HasPageIndex());
+	auto result = make_uniq<ColumnIndex>();
+	ReadPageIndex(*result, NumericCast<idx_t>(chunk->column_index_offset));
+	return result;
+}
+
+const OffsetIndex &ColumnReader::GetOffsetIndex() {
+	D_ASSERT(chunk && chunk->__isset.offset_index_offset);
+	if (!offset_index) {
+		offset_index = make_uniq<OffsetIndex>();
+		ReadPageIndex(*offset_index, NumericCast<idx_t>(chunk->offset_index_offset));
+	}
+	return *offset_index;
+}
+
 uint64_t ColumnReader::TotalCompressedSize() {
 	if (!chunk) {
 		return 0;
@@ -238,6 +273,7 @@ void ColumnReader::InitializeRead(idx_t row_group_idx_p, const vector<ColumnChun
 		chunk_read_offset = chunk->meta_data.dictionary_page_offset;
 	}
 	group_rows_available = chunk->meta_data.num_values;
+	offset_index.reset();
 }
 
 void ColumnReader::PrepareRead(parquet_filter_t &filter) {
@@ -600,9 +636,70 @@ void ColumnReader::Skip(idx_t num_values) {
 	pending_skips += num_values;
 }
 
+idx_t ColumnReader::SkipPages(idx_t num_values) {
+	if (num_values <= page_rows_available) {
+		// the skip ends within the current page
+		return num_values;
+	}
+	if (!chunk || HasRepeats() || !chunk->__isset.offset_index_offset || reader.parquet_options.encryption_config) {
+		return num_values;
+	}
+	auto &pages = GetOffsetIndex().page_locations;
+	if (pages.empty()) {
+		return num_values;
+	}
+	// for non-repeated columns every value is a row
+	auto current_row = NumericCast<idx_t>(chunk->meta_data.num_values) - group_rows_available;
+	auto next_page_row = current_row + page_rows_available;
+	auto target_row = current_row + num_values;
+
+	// find the page that contains the target row - all pages in between can be skipped without reading them
+	idx_t target_page = 0;
+	while (target_page + 1 < pages.size() && NumericCast<idx_t>(pages[target_page + 1].first_row_index) <= target_row) {
+		target_page++;
+	}
+	auto target_page_row = NumericCast<idx_t>(pages[target_page].first_row_index);
+	if (target_page_row <= current_row || target_page_row < next_page_row) {
+		// the target row is in a page we have already started reading
+		return num_values;
+	}
+
+	auto &trans = reinterpret_cast<ThriftFileTransport &>(*protocol->getTransport());
+	// the dictionary precedes the data pages - make sure we have read it before skipping over the data pages
+	while (page_rows_available == 0 && trans.GetLocation() < NumericCast<idx_t>(pages[0].offset)) {
+		PrepareRead(none_filter);
+	}
+	chunk_read_offset = trans.GetLocation();
+	if (page_rows_available > 0) {
+		// we unexpectedly read a data page - skip the regular way
+		return num_values;
+	}
+
+	idx_t skipped_pages = 0;
+	idx_t skipped_bytes = 0;
+	for (idx_t page_idx = 0; page_idx < target_page; page_idx++) {
+		if (NumericCast<idx_t>(pages[page_idx].first_row_index) >= next_page_row) {
+			skipped_pages++;
+			skipped_bytes += NumericCast<idx_t>(pages[page_idx].compressed_page_size);
+		}
+	}
+	reader.skipped_pages += skipped_pages;
+	reader.skipped_page_bytes += skipped_bytes;
+
+	// move to the start of the target page
+	chunk_read_offset = NumericCast<idx_t>(pages[target_page].offset);
+	trans.SetLocation(chunk_read_offset);
+	page_rows_available = 0;
+	group_rows_available -= target_page_row - current_row;
+	return target_row - target_page_row;
+}
+
 void ColumnReader::ApplyPendingSkips(idx_t num_values) {
 	pending_skips -= num_values;
 
+	// skip over entire pages without reading them if we can
+	num_values = SkipPages(num_values);
+
 	dummy_define.zero();
 	dummy_repeat.zero();
 
@@ -3,9 +3,11 @@
 #include "duckdb.hpp"
 #include "parquet_rle_bp_decoder.hpp"
 #include "parquet_rle_bp_encoder.hpp"
+#include "parquet_statistics.hpp"
 #include "parquet_writer.hpp"
 #include "geo_parquet.hpp"
 #ifndef DUCKDB_AMALGAMATION
+#include "duckdb/common/algorithm.hpp"
 #include "duckdb/common/exception.hpp"
 #include "duckdb/common/operator/comparison_operators.hpp"
 #include "duckdb/common/serializer/buffered_file_writer.hpp"
@@ -356,6 +358,8 @@ public:
 	vector<PageWriteInformation> write_info;
 	unique_ptr<ColumnWriterStatistics> stats_state;
 	idx_t current_page = 0;
+	//! The hashes of the (non-NULL) values written to this column chunk, used to build the bloom filter
+	unsafe_vector<uint64_t> bloom_filter_hashes;
 };
 
 //===--------------------------------------------------------------------===//
@@ -416,6 +420,8 @@ protected:
 	//! Writes a (subset of a) vector to the specified serializer. Only used for scalar types.
 	virtual void WriteVector(WriteStream &temp_writer, ColumnWriterStatistics *stats, ColumnWriterPageState *page_state,
 	                         Vector &vector, idx_t chunk_start, idx_t chunk_end) = 0;
+	//! Hashes the values of a (subset of a) vector for the bloom filter. Only used for scalar types.
+	virtual void HashVector(BasicColumnWriterState &state, Vector &vector, idx_t chunk_start, idx_t chunk_end);
 
 	virtual bool HasDictionary(BasicColumnWriterState &state_p) {
 		return false;
@@ -427,6 +433,7 @@ protected:
 
 	void SetParquetStatistics(BasicColumnWriterState &state, duckdb_parquet::format::ColumnChunk &column);
 	void RegisterToRowGroup(duckdb_parquet::format::RowGroup &row_group);
+	void FlushBloomFilter(BasicColumnWriterState &state);
 };
 
 unique_ptr<ColumnWriterState> BasicColumnWriter::InitializeWriteState(duckdb_parquet::format::RowGroup &row_group) {
@@ -636,6 +643,9 @@ void BasicColumnWriter::Write(ColumnWriterState &state_p, Vector &vector, idx_t
 
 		WriteVector(temp_writer, state.stats_state.get(), write_info.page_state.get(), vector, offset,
 		            offset + write_count);
+		if (write_bloom_filter) {
+			HashVector(state, vector, offset, offset + write_count);
+		}
 
 		write_info.write_count += write_count;
 		if (write_info.write_count == write_info.max_write_count) {
@@ -728,6 +738,32 @@ void BasicColumnWriter::FinalizeWrite(ColumnWriterState &state_p) {
 	column_chunk.meta_data.total_compressed_size =
 	    UnsafeNumericCast<int64_t>(column_writer.GetTotalWritten() - start_offset);
 	column_chunk.meta_data.total_uncompressed_size = UnsafeNumericCast<int64_t>(total_uncompressed_size);
+
+	if (write_bloom_filter) {
+		FlushBloomFilter(state);
+	}
+}
+
+void BasicColumnWriter::HashVector(BasicColumnWriterState &state, Vector &vector, idx_t chunk_start,
+                                   idx_t chunk_end) {
+	throw InternalException("This column writer does not support bloom filters");
+}
+
+void BasicColumnWriter::FlushBloomFilter(BasicColumnWriterState &state) {
+	auto &hashes = state.bloom_filter_hashes;
+	if (hashes.empty()) {
+		// only NULL values - no bloom filter required
+		return;
+	}
+	// size the bloom filter according to the number of distinct values in this column chunk
+	std::sort(hashes.begin(), hashes.end());
+	auto num_distinct = NumericCast<idx_t>(std::unique(hashes.begin(), hashes.end()) - hashes.begin());
+	auto bloom_filter = make_uniq<ParquetBloomFilter>(num_distinct, writer.BloomFilterFalsePositiveRatio());
+	for (idx_t i = 0; i < num_distinct; i++) {
+		bloom_filter->Insert(hashes[i]);
+	}
+	writer.BufferBloomFilter(state.col_idx, std::move(bloom_filter));
+	hashes.clear();
 }
 
 void BasicColumnWriter::FlushDictionary(BasicColumnWriterState &state, ColumnWriterStatistics *stats) {
@@ -920,6 +956,24 @@ public:
 		TemplatedWritePlain<SRC, TGT, OP>(input_column, stats, chunk_start, chunk_end, mask, temp_writer);
 	}
 
+	bool SupportsBloomFilter() const override {
+		// (u)hugeint values are written as (lossy) doubles
+		return !std::is_same<SRC, hugeint_t>::value && !std::is_same<SRC, uhugeint_t>::value;
+	}
+
+	void HashVector(BasicColumnWriterState &state, Vector &input_column, idx_t chunk_start,
+	                idx_t chunk_end) override {
+		auto &mask = FlatVector::Validity(input_column);
+		const auto *ptr = FlatVector::GetData<SRC>(input_column);
+		for (idx_t r = chunk_start; r < chunk_end; r++) {
+			if (!mask.RowIsValid(r)) {
+				continue;
+			}
+			TGT target_value = OP::template Operation<SRC, TGT>(ptr[r]);
+			state.bloom_filter_hashes.push_back(ParquetBloomFilter::Hash(target_value));
+		}
+	}
+
 	idx_t GetRowSize(const Vector &vector, const idx_t index, const BasicColumnWriterState &state) const override {
 		return sizeof(TGT);
 	}
@@ -1474,6 +1528,27 @@ public:
 		}
 	}
 
+	bool SupportsBloomFilter() const override {
+		return true;
+	}
+
+	void HashVector(BasicColumnWriterState &state_p, Vector &input_column, idx_t chunk_start,
+	                idx_t chunk_end) override {
+		auto &state = state_p.Cast<StringColumnWriterState>();
+		if (state.IsDictionaryEncoded()) {
+			// the values of the dictionary are hashed when the dictionary is flushed
+			return;
+		}
+		auto &mask = FlatVector::Validity(input_column);
+		auto *ptr = FlatVector::GetData<string_t>(input_column);
+		for (idx_t r = chunk_start; r < chunk_end; r++) {
+			if (!mask.RowIsValid(r)) {
+				continue;
+			}
+			state.bloom_filter_hashes.push_back(ParquetBloomFilter::Hash(ptr[r]));
+		}
+	}
+
 	unique_ptr<ColumnWriterPageState> InitializePageState(BasicColumnWriterState &state_p) override {
 		auto &state = state_p.Cast<StringColumnWriterState>();
 		return make_uniq<StringWriterPageState>(state.key_bit_width, state.dictionary);
@@ -1527,6 +1602,9 @@ public:
 			auto &value = values[r];
 			// update the statistics
 			stats.Update(value);
+			if (write_bloom_filter) {
+				state.bloom_filter_hashes.push_back(ParquetBloomFilter::Hash(value));
+			}
 			// write this string value to the dictionary
 			temp_writer->Write<uint32_t>(value.GetSize());
 			temp_writer->WriteData(const_data_ptr_cast((value.GetData())), value.GetSize());
@@ -30,8 +30,10 @@ class ParquetReader;
 using duckdb_apache::thrift::protocol::TProtocol;
 
 using duckdb_parquet::format::ColumnChunk;
+using duckdb_parquet::format::ColumnIndex;
 using duckdb_parquet::format::CompressionCodec;
 using duckdb_parquet::format::FieldRepetitionType;
+using duckdb_parquet::format::OffsetIndex;
 using duckdb_parquet::format::PageHeader;
 using duckdb_parquet::format::SchemaElement;
 using duckdb_parquet::format::Type;
@@ -68,6 +70,13 @@ public:
 	// register the range this reader will touch for prefetching
 	virtual void RegisterPrefetch(ThriftFileTransport &transport, bool allow_merge);
 
+	//! Whether or not the current column chunk has a page index (ColumnIndex + OffsetIndex) this reader can use
+	bool HasPageIndex() const;
+	//! Reads the ColumnIndex of the current column chunk
+	unique_ptr<ColumnIndex> ReadColumnIndex();
+	//! Returns the OffsetIndex of the current column chunk (reading it if required)
+	const OffsetIndex &GetOffsetIndex();
+
 	virtual unique_ptr<BaseStatistics> Stats(idx_t row_group_idx_p, const vector<ColumnChunk> &columns);
 
 	template <class VALUE_TYPE, class CONVERSION>
@@ -134,6 +143,8 @@ protected:
 
 	// applies any skips that were registered using Skip()
 	virtual void ApplyPendingSkips(idx_t num_values);
+	// skips over entire pages using the OffsetIndex (if possible), returns the number of values that remain to be skipped
+	idx_t SkipPages(idx_t num_values);
 
 	bool HasDefines() const {
 		return max_define > 0;
@@ -163,6 +174,8 @@ private:
 	void AllocateBlock(idx_t size);
 	void AllocateCompressed(idx_t size);
 	void PrepareRead(parquet_filter_t &filter);
+	template <class T>
+	void ReadPageIndex(T &index, idx_t offset);
 	void PreparePage(PageHeader &page_hdr);
 	void PrepareDataPage(PageHeader &page_hdr);
 	void PreparePageV2(PageHeader &page_hdr);
@@ -175,6 +188,8 @@ private:
 	idx_t page_rows_available;
 	idx_t group_rows_available;
 	idx_t chunk_read_offset;
+	//! The OffsetIndex of the current column chunk (if it has been read)
+	unique_ptr<OffsetIndex> offset_index;
 
 	shared_ptr<ResizeableBuffer> block;
 
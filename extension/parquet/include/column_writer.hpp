@@ -76,6 +76,8 @@ public:
 	idx_t max_repeat;
 	idx_t max_define;
 	bool can_have_nulls;
+	//! Whether or not a bloom filter is written for the values of this column
+	bool write_bloom_filter = false;
 
 public:
 	//! Create the column writer for a specific type recursively
@@ -87,6 +89,11 @@ public:
 
 	virtual unique_ptr<ColumnWriterState> InitializeWriteState(duckdb_parquet::format::RowGroup &row_group) = 0;
 
+	//! Whether or not the writer can write a bloom filter for its values
+	virtual bool SupportsBloomFilter() const {
+		return false;
+	}
+
 	//! indicates whether the write need to analyse the data before preparing it
 	virtual bool HasAnalyze() {
 		return false;
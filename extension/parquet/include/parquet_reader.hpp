@@ -10,6 +10,7 @@
 
 #include "duckdb.hpp"
 #ifndef DUCKDB_AMALGAMATION
+#include "duckdb/common/atomic.hpp"
 #include "duckdb/common/common.hpp"
 #include "duckdb/common/encryption_state.hpp"
 #include "duckdb/common/exception.hpp"
@@ -64,6 +65,11 @@ struct ParquetReaderScanState {
 
 	bool prefetch_mode = false;
 	bool current_group_prefetched = false;
+
+	//! Row ranges [start, end) of the current row group that were pruned using the page index
+	vector<pair<idx_t, idx_t>> pruned_ranges;
+	//! The next entry of pruned_ranges
+	idx_t pruned_range_idx = 0;
 };
 
 struct ParquetColumnDefinition {
@@ -140,6 +146,9 @@ public:
 	vector<duckdb_parquet::format::SchemaElement> generated_column_schema;
 	//! Table column names - set when using COPY tbl FROM file.parquet
 	vector<string> table_columns;
+	//! The number of data pages (and their compressed size in bytes) that were skipped without reading them
+	atomic<idx_t> skipped_pages {0};
+	atomic<idx_t> skipped_page_bytes {0};
 
 public:
 	void InitializeScan(ClientContext &context, ParquetReaderScanState &state, vector<idx_t> groups_to_read);
@@ -208,7 +217,12 @@ private:
 	idx_t GetGroupOffset(ParquetReaderScanState &state);
 	// Group span is the distance between the min page offset and the max page offset plus the max page compressed size
 	uint64_t GetGroupSpan(ParquetReaderScanState &state);
+	//! Starts reading the next row group of the scan in the background (if the file can be read asynchronously)
+	void PrefetchNextGroupAsync(ParquetReaderScanState &state);
 	void PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t out_col_idx);
+	//! Uses the page index of the filtered columns to find row ranges of the current row group that can be skipped
+	void PrunePages(ParquetReaderScanState &state);
+	void SkipRows(ParquetReaderScanState &state, idx_t count);
 	LogicalType DeriveLogicalType(const SchemaElement &s_ele);
 
 	template <typename... Args>
@@ -13,14 +13,69 @@ using duckdb_parquet::format::SchemaElement;
 
 struct LogicalType;
 class ColumnReader;
+class TableFilter;
 
 struct ParquetStatisticsUtils {
 
 	static unique_ptr<BaseStatistics> TransformColumnStatistics(const ColumnReader &reader,
 	                                                            const vector<ColumnChunk> &columns);
+	//! Transforms a set of (row group or page) statistics of a non-nested column
+	static unique_ptr<BaseStatistics> TransformStatistics(const ColumnReader &reader,
+	                                                      const duckdb_parquet::format::Statistics &parquet_stats);
 
 	static Value ConvertValue(const LogicalType &type, const duckdb_parquet::format::SchemaElement &schema_ele,
 	                          const std::string &stats);
+
+	//! Whether or not the bloom filter of a column chunk can be used to evaluate filters on the given column
+	static bool BloomFilterSupported(const ColumnReader &reader);
+	//! Reads the bloom filter of a column chunk and checks whether it proves that the filter cannot match any row
+	static bool BloomFilterExcludes(const ColumnReader &reader, const TableFilter &filter,
+	                                const duckdb_parquet::format::ColumnMetaData &column_meta_data,
+	                                duckdb_apache::thrift::protocol::TProtocol &file_proto);
+};
+
+//! A split block bloom filter (SBBF) as defined by the Parquet specification
+//! The filter consists of blocks of 256 bits - each hash sets (or checks) one bit in every 32-bit word of a block
+class ParquetBloomFilter {
+public:
+	//! The number of 32-bit words per block
+	static constexpr const idx_t BLOCK_WORDS = 8;
+	//! The size of a block in bytes
+	static constexpr const idx_t BLOCK_SIZE = BLOCK_WORDS * sizeof(uint32_t);
+	//! The maximum size of a bloom filter we write (in bytes)
+	static constexpr const idx_t MAX_SIZE = 128ULL * 1024ULL * 1024ULL;
+
+public:
+	//! Creates an empty bloom filter sized for the given number of distinct values and false positive ratio
+	ParquetBloomFilter(idx_t num_distinct, double false_positive_ratio);
+	//! Creates a bloom filter from the bitset stored in a file
+	explicit ParquetBloomFilter(vector<uint32_t> words);
+
+	void Insert(uint64_t hash);
+	bool Check(uint64_t hash) const;
+
+	const_data_ptr_t Data() const {
+		return const_data_ptr_cast(words.data());
+	}
+	idx_t SizeInBytes() const {
+		return words.size() * sizeof(uint32_t);
+	}
+
+	//! Hashes the plain encoding of a value (XXH64 with a seed of 0)
+	static uint64_t Hash(const_data_ptr_t data, idx_t size);
+	static uint64_t Hash(const string_t &value) {
+		return Hash(const_data_ptr_cast(value.GetData()), value.GetSize());
+	}
+	template <class T>
+	static uint64_t Hash(const T &value) {
+		return Hash(const_data_ptr_cast(&value), sizeof(T));
+	}
+
+private:
+	idx_t BlockOffset(uint64_t hash) const;
+
+	//! The bitset of the filter
+	vector<uint32_t> words;
 };
 
 } // namespace duckdb
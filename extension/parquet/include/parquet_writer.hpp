@@ -20,6 +20,7 @@
 #endif
 
 #include "column_writer.hpp"
+#include "parquet_statistics.hpp"
 #include "parquet_types.h"
 #include "geo_parquet.hpp"
 #include "thrift/protocol/TCompactProtocol.h"
@@ -67,7 +68,8 @@ public:
 	              vector<string> names, duckdb_parquet::format::CompressionCodec::type codec, ChildFieldIDs field_ids,
 	              const vector<pair<string, string>> &kv_metadata,
 	              shared_ptr<ParquetEncryptionConfig> encryption_config, double dictionary_compression_ratio_threshold,
-	              optional_idx compression_level, bool debug_use_openssl);
+	              optional_idx compression_level, bool debug_use_openssl, const vector<bool> &bloom_filter_columns,
+	              double bloom_filter_false_positive_ratio);
 
 public:
 	void PrepareRowGroup(ColumnDataCollection &buffer, PreparedRowGroup &result);
@@ -103,6 +105,9 @@ public:
 	optional_idx CompressionLevel() const {
 		return compression_level;
 	}
+	double BloomFilterFalsePositiveRatio() const {
+		return bloom_filter_false_positive_ratio;
+	}
 	idx_t NumberOfRowGroups() {
 		lock_guard<mutex> glock(lock);
 		return file_meta_data.row_groups.size();
@@ -111,6 +116,10 @@ public:
 	uint32_t Write(const duckdb_apache::thrift::TBase &object);
 	uint32_t WriteData(const const_data_ptr_t buffer, const uint32_t buffer_size);
 
+	//! Buffers the bloom filter of a column chunk of the row group that is being flushed
+	//! The bloom filters are written after all column chunks of the row group have been written
+	void BufferBloomFilter(idx_t col_idx, unique_ptr<ParquetBloomFilter> bloom_filter);
+
 	GeoParquetFileMetadata &GetGeoParquetData();
 
 	static bool TryGetParquetType(const LogicalType &duckdb_type,
@@ -126,6 +135,7 @@ private:
 	double dictionary_compression_ratio_threshold;
 	optional_idx compression_level;
 	bool debug_use_openssl;
+	double bloom_filter_false_positive_ratio;
 	shared_ptr<EncryptionUtil> encryption_util;
 
 	unique_ptr<BufferedFileWriter> writer;
@@ -134,6 +144,8 @@ private:
 	std::mutex lock;
 
 	vector<unique_ptr<ColumnWriter>> column_writers;
+	//! The bloom filters of the row group that is currently being flushed (column index, bloom filter)
+	vector<pair<idx_t, unique_ptr<ParquetBloomFilter>>> bloom_filters;
 
 	unique_ptr<GeoParquetFileMetadata> geoparquet_data;
 };
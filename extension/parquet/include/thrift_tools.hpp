@@ -105,17 +105,50 @@ struct ReadAheadBuffer {
 
 	// Prefetch all read heads
 	void Prefetch() {
-		for (auto &read_head : read_heads) {
-			read_head.Allocate(allocator);
+		SubmitPrefetch();
+		WaitForPrefetch();
+	}
 
+	// Submit the reads of all read heads that have not been read yet as a single batch, without waiting for them
+	void SubmitPrefetch() {
+		WaitForPrefetch();
+		vector<FileReadRequest> requests;
+		for (auto &read_head : read_heads) {
+			if (read_head.data_isset) {
+				continue;
+			}
 			if (read_head.GetEnd() > handle.GetFileSize()) {
 				throw std::runtime_error("Prefetch registered requested for bytes outside file");
 			}
+			read_head.Allocate(allocator);
+			requests.emplace_back(read_head.data.get(), read_head.size, read_head.location);
+		}
+		if (!requests.empty()) {
+			pending_reads = handle.SubmitReads(std::move(requests));
+		}
+	}
 
-			handle.Read(read_head.data.get(), read_head.size, read_head.location);
+	// Wait for the reads submitted by SubmitPrefetch to complete
+	void WaitForPrefetch() {
+		if (!pending_reads) {
+			return;
+		}
+		pending_reads->Wait();
+		pending_reads.reset();
+		for (auto &read_head : read_heads) {
 			read_head.data_isset = true;
 		}
 	}
+
+	void Clear() {
+		// the pending reads write into the read heads: they have to be finished before the read heads are destroyed
+		pending_reads.reset();
+		read_heads.clear();
+		merge_set.clear();
+	}
+
+	// The reads of the read heads that are still in flight (if any), declared last so it is destroyed first
+	unique_ptr<PendingFileReads> pending_reads;
 };
 
 class ThriftFileTransport : public duckdb_apache::thrift::transport::TVirtualTransport<ThriftFileTransport> {
@@ -123,8 +156,8 @@ public:
 	static constexpr uint64_t PREFETCH_FALLBACK_BUFFERSIZE = 1000000;
 
 	ThriftFileTransport(Allocator &allocator, FileHandle &handle_p, bool prefetch_mode_p)
-	    : handle(handle_p), location(0), allocator(allocator), ra_buffer(ReadAheadBuffer(allocator, handle_p)),
-	      prefetch_mode(prefetch_mode_p) {
+	    : handle(handle_p), location(0), allocator(allocator), ra_buffer(allocator, handle_p),
+	      async_buffer(allocator, handle_p), prefetch_mode(prefetch_mode_p) {
 	}
 
 	uint32_t read(uint8_t *buf, uint32_t len) {
@@ -154,6 +187,9 @@ public:
 
 	// Prefetch a single buffer
 	void Prefetch(idx_t pos, uint64_t len) {
+		if (TakeAsyncPrefetch(pos, len)) {
+			return;
+		}
 		RegisterPrefetch(pos, len, false);
 		FinalizeRegistration();
 		PrefetchRegistered();
@@ -174,9 +210,16 @@ public:
 		ra_buffer.Prefetch();
 	}
 
+	// Start reading a single buffer in the background, a later Prefetch of the same range picks up the result
+	void PrefetchAsync(idx_t pos, uint64_t len) {
+		async_buffer.Clear();
+		async_buffer.AddReadHead(pos, len, false);
+		async_buffer.SubmitPrefetch();
+	}
+
+	// Clears all prefetched buffers, except for the one that is being read in the background
 	void ClearPrefetch() {
-		ra_buffer.read_heads.clear();
-		ra_buffer.merge_set.clear();
+		ra_buffer.Clear();
 	}
 
 	void SetLocation(idx_t location_p) {
@@ -191,6 +234,22 @@ public:
 	}
 
 private:
+	// Moves the buffer read by PrefetchAsync into the prefetched buffers if it covers exactly the given range
+	bool TakeAsyncPrefetch(idx_t pos, uint64_t len) {
+		if (async_buffer.read_heads.size() != 1) {
+			return false;
+		}
+		auto &async_head = async_buffer.read_heads.front();
+		if (async_head.location != pos || async_head.size != len) {
+			async_buffer.Clear();
+			return false;
+		}
+		async_buffer.WaitForPrefetch();
+		ra_buffer.read_heads.splice(ra_buffer.read_heads.begin(), async_buffer.read_heads);
+		async_buffer.Clear();
+		return true;
+	}
+
 	FileHandle &handle;
 	idx_t location;
 
@@ -198,6 +257,8 @@ private:
 
 	// Multi-buffer prefetch
 	ReadAheadBuffer ra_buffer;
+	// Buffer that is read in the background (e.g. the next row group)
+	ReadAheadBuffer async_buffer;
 
 	// Whether the prefetch mode is enabled. In this mode the DirectIO flag of the handle will be set and the parquet
 	// reader will manage the read buffering.
@@ -25,6 +25,7 @@
 #ifndef DUCKDB_AMALGAMATION
 #include "duckdb/catalog/catalog.hpp"
 #include "duckdb/catalog/catalog_entry/table_function_catalog_entry.hpp"
+#include "duckdb/common/bind_helpers.hpp"
 #include "duckdb/common/constants.hpp"
 #include "duckdb/common/enums/file_compression_type.hpp"
 #include "duckdb/common/file_system.hpp"
@@ -168,6 +169,10 @@ struct ParquetReadGlobalState : public GlobalTableFunctionState {
 	vector<column_t> column_ids;
 	optional_ptr<TableFilterSet> filters;
 
+	//! The number of data pages (and their compressed size in bytes) that were skipped using the page index
+	idx_t skipped_pages = 0;
+	idx_t skipped_page_bytes = 0;
+
 	idx_t MaxThreads() const override {
 		return max_threads;
 	}
@@ -201,6 +206,11 @@ struct ParquetWriteBindData : public TableFunctionData {
 	ChildFieldIDs field_ids;
 	//! The compression level, higher value is more
 	optional_idx compression_level;
+
+	//! For which (top-level) columns to write a bloom filter
+	vector<bool> bloom_filter_columns;
+	//! The target false positive ratio of the bloom filters
+	double bloom_filter_false_positive_ratio = 0.01;
 };
 
 struct ParquetWriteGlobalState : public GlobalFunctionData {
@@ -391,6 +401,7 @@ public:
 		table_function.statistics = ParquetScanStats;
 		table_function.cardinality = ParquetCardinality;
 		table_function.table_scan_progress = ParquetProgress;
+		table_function.dynamic_to_string = ParquetScanDynamicToString;
 		table_function.named_parameters["binary_as_string"] = LogicalType::BOOLEAN;
 		table_function.named_parameters["file_row_number"] = LogicalType::BOOLEAN;
 		table_function.named_parameters["debug_use_openssl"] = LogicalType::BOOLEAN;
@@ -407,6 +418,7 @@ public:
 		table_function.projection_pushdown = true;
 		table_function.filter_pushdown = true;
 		table_function.filter_prune = true;
+		table_function.dynamic_filter_pushdown = true;
 		table_function.pushdown_complex_filter = ParquetComplexFilterPushdown;
 
 		MultiFileReader::AddParameters(table_function);
@@ -645,6 +657,17 @@ public:
 		return (percentage + 100.0 * static_cast<double>(gstate.file_index)) / static_cast<double>(total_count);
 	}
 
+	static InsertionOrderPreservingMap<string> ParquetScanDynamicToString(GlobalTableFunctionState *global_state) {
+		InsertionOrderPreservingMap<string> result;
+		auto &gstate = global_state->Cast<ParquetReadGlobalState>();
+		lock_guard<mutex> guard(gstate.lock);
+		if (gstate.skipped_pages > 0) {
+			result["Skipped Pages"] = to_string(gstate.skipped_pages);
+			result["Skipped Page Bytes"] = to_string(gstate.skipped_page_bytes);
+		}
+		return result;
+	}
+
 	static unique_ptr<LocalTableFunctionState>
 	ParquetScanInitLocal(ExecutionContext &context, TableFunctionInitInput &input, GlobalTableFunctionState *gstate_p) {
 		auto &bind_data = input.bind_data->Cast<ParquetReadBindData>();
@@ -886,6 +909,12 @@ public:
 	                                     ParquetReadLocalState &scan_data, ParquetReadGlobalState &parallel_state) {
 		unique_lock<mutex> parallel_lock(parallel_state.lock);
 
+		if (scan_data.reader) {
+			// collect the pages that were skipped while scanning the previous row group
+			parallel_state.skipped_pages += scan_data.reader->skipped_pages.exchange(0);
+			parallel_state.skipped_page_bytes += scan_data.reader->skipped_page_bytes.exchange(0);
+		}
+
 		while (true) {
 			if (parallel_state.error_opening_file) {
 				return false;
@@ -1183,6 +1212,15 @@ unique_ptr<FunctionData> ParquetWriteBind(ClientContext &context, CopyFunctionBi
 	auto bind_data = make_uniq<ParquetWriteBindData>();
 	for (auto &option : input.info.options) {
 		const auto loption = StringUtil::Lower(option.first);
+		if (loption == "bloom_filter_columns") {
+			// accept both BLOOM_FILTER_COLUMNS (a, b) and BLOOM_FILTER_COLUMNS ['a', 'b']
+			auto column_list = option.second.size() == 1 && option.second[0].type().id() == LogicalTypeId::LIST
+			                       ? option.second[0]
+			                       : ConvertVectorToValue(option.second);
+			auto column_names = names;
+			bind_data->bloom_filter_columns = ParseColumnList(column_list, column_names, loption);
+			continue;
+		}
 		if (option.second.size() != 1) {
 			// All parquet write options require exactly one argument
 			throw BinderException("%s requires exactly one argument", StringUtil::Upper(loption));
@@ -1276,10 +1314,19 @@ unique_ptr<FunctionData> ParquetWriteBind(ClientContext &context, CopyFunctionBi
 			}
 		} else if (loption == "compression_level") {
 			bind_data->compression_level = option.second[0].GetValue<uint64_t>();
+		} else if (loption == "bloom_filter_false_positive_ratio") {
+			auto val = option.second[0].GetValue<double>();
+			if (val <= 0 || val >= 1) {
+				throw BinderException("bloom_filter_false_positive_ratio must be between 0 and 1 (exclusive)");
+			}
+			bind_data->bloom_filter_false_positive_ratio = val;
 		} else {
 			throw NotImplementedException("Unrecognized option for PARQUET: %s", option.first.c_str());
 		}
 	}
+	if (bind_data->encryption_config && !bind_data->bloom_filter_columns.empty()) {
+		throw NotImplementedException("BLOOM_FILTER_COLUMNS is not supported in combination with ENCRYPTION_CONFIG");
+	}
 	if (row_group_size_bytes_set) {
 		if (DBConfig::GetConfig(context).options.preserve_insertion_order) {
 			throw BinderException("ROW_GROUP_SIZE_BYTES does not work while preserving insertion order. Use \"SET "
@@ -1305,7 +1352,8 @@ unique_ptr<GlobalFunctionData> ParquetWriteInitializeGlobal(ClientContext &conte
 	    make_uniq<ParquetWriter>(context, fs, file_path, parquet_bind.sql_types, parquet_bind.column_names,
 	                             parquet_bind.codec, parquet_bind.field_ids.Copy(), parquet_bind.kv_metadata,
 	                             parquet_bind.encryption_config, parquet_bind.dictionary_compression_ratio_threshold,
-	                             parquet_bind.compression_level, parquet_bind.debug_use_openssl);
+	                             parquet_bind.compression_level, parquet_bind.debug_use_openssl,
+	                             parquet_bind.bloom_filter_columns, parquet_bind.bloom_filter_false_positive_ratio);
 	return std::move(global_state);
 }
 
@@ -21,13 +21,18 @@
 #include "duckdb/main/config.hpp"
 
 #ifndef DUCKDB_AMALGAMATION
+#include "duckdb/common/algorithm.hpp"
 #include "duckdb/common/encryption_state.hpp"
 #include "duckdb/common/file_system.hpp"
 #include "duckdb/common/helper.hpp"
 #include "duckdb/common/hive_partitioning.hpp"
 #include "duckdb/common/string_util.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/planner/filter/bloom_filter.hpp"
 #include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/dynamic_filter.hpp"
+#include "duckdb/planner/filter/in_filter.hpp"
 #include "duckdb/planner/filter/struct_filter.hpp"
 #include "duckdb/planner/table_filter.hpp"
 #include "duckdb/storage/object_cache.hpp"
@@ -41,6 +46,8 @@
 namespace duckdb {
 
 using duckdb_parquet::format::ColumnChunk;
+using duckdb_parquet::format::ColumnIndex;
+using duckdb_parquet::format::ColumnMetaData;
 using duckdb_parquet::format::ConvertedType;
 using duckdb_parquet::format::FieldRepetitionType;
 using duckdb_parquet::format::FileCryptoMetaData;
@@ -663,8 +670,7 @@ uint64_t ParquetReader::GetGroupCompressedSize(ParquetReaderScanState &state) {
 	return total_compressed_size ? total_compressed_size : calc_compressed_size;
 }
 
-uint64_t ParquetReader::GetGroupSpan(ParquetReaderScanState &state) {
-	auto &group = GetGroup(state);
+static uint64_t GetRowGroupSpan(const ParquetRowGroup &group) {
 	idx_t min_offset = NumericLimits<idx_t>::Maximum();
 	idx_t max_offset = NumericLimits<idx_t>::Minimum();
 
@@ -686,8 +692,11 @@ uint64_t ParquetReader::GetGroupSpan(ParquetReaderScanState &state) {
 	return max_offset - min_offset;
 }
 
-idx_t ParquetReader::GetGroupOffset(ParquetReaderScanState &state) {
-	auto &group = GetGroup(state);
+uint64_t ParquetReader::GetGroupSpan(ParquetReaderScanState &state) {
+	return GetRowGroupSpan(GetGroup(state));
+}
+
+static idx_t GetRowGroupOffset(const ParquetRowGroup &group) {
 	idx_t min_offset = NumericLimits<idx_t>::Maximum();
 
 	for (auto &column_chunk : group.columns) {
@@ -703,6 +712,24 @@ idx_t ParquetReader::GetGroupOffset(ParquetReaderScanState &state) {
 	return min_offset;
 }
 
+idx_t ParquetReader::GetGroupOffset(ParquetReaderScanState &state) {
+	return GetRowGroupOffset(GetGroup(state));
+}
+
+void ParquetReader::PrefetchNextGroupAsync(ParquetReaderScanState &state) {
+	auto next_group = NumericCast<idx_t>(state.current_group + 1);
+	if (next_group >= state.group_idx_list.size() || !state.file_handle->SupportsAsyncReads()) {
+		return;
+	}
+	auto &group = GetFileMetadata()->row_groups[state.group_idx_list[next_group]];
+	auto span = GetRowGroupSpan(group);
+	if (span == 0) {
+		return;
+	}
+	auto &trans = reinterpret_cast<ThriftFileTransport &>(*state.thrift_file_proto->getTransport());
+	trans.PrefetchAsync(GetRowGroupOffset(group), span);
+}
+
 static FilterPropagateResult CheckParquetStringFilter(BaseStatistics &stats, const Statistics &pq_col_stats,
                                                       TableFilter &filter) {
 	if (filter.filter_type == TableFilterType::CONSTANT_COMPARISON) {
@@ -717,6 +744,40 @@ static FilterPropagateResult CheckParquetStringFilter(BaseStatistics &stats, con
 	}
 }
 
+static FilterPropagateResult CheckParquetFilter(const ColumnReader &column_reader, BaseStatistics &stats,
+                                                const Statistics &pq_col_stats, TableFilter &filter) {
+	if (filter.filter_type == TableFilterType::DYNAMIC_FILTER) {
+		// check the current value of the dynamic filter against the full statistics
+		auto current_filter = filter.Cast<DynamicFilter>().GetFilter();
+		if (!current_filter) {
+			return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+		}
+		return CheckParquetFilter(column_reader, stats, pq_col_stats, *current_filter);
+	}
+	if (column_reader.Type().id() == LogicalTypeId::VARCHAR && pq_col_stats.__isset.min_value &&
+	    pq_col_stats.__isset.max_value) {
+		// our StringStats only store the first 8 bytes of strings (even if Parquet has longer string stats)
+		// however, when reading remote Parquet files, skipping row groups is really important
+		// here, we implement a special case to check the full length for string filters
+		if (filter.filter_type == TableFilterType::CONJUNCTION_AND) {
+			const auto &and_filter = filter.Cast<ConjunctionAndFilter>();
+			auto and_result = FilterPropagateResult::FILTER_ALWAYS_TRUE;
+			for (auto &child_filter : and_filter.child_filters) {
+				auto child_prune_result = CheckParquetStringFilter(stats, pq_col_stats, *child_filter);
+				if (child_prune_result == FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+					and_result = FilterPropagateResult::FILTER_ALWAYS_FALSE;
+					break;
+				} else if (child_prune_result != and_result) {
+					and_result = FilterPropagateResult::NO_PRUNING_POSSIBLE;
+				}
+			}
+			return and_result;
+		}
+		return CheckParquetStringFilter(stats, pq_col_stats, filter);
+	}
+	return filter.CheckStatistics(stats);
+}
+
 void ParquetReader::PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t col_idx) {
 	auto &group = GetGroup(state);
 	auto column_id = reader_data.column_ids[col_idx];
@@ -728,43 +789,27 @@ void ParquetReader::PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t c
 		// filters contain output chunk index, not file col idx!
 		auto global_id = reader_data.column_mapping[col_idx];
 		auto filter_entry = reader_data.filters->filters.find(global_id);
-		if (stats && filter_entry != reader_data.filters->filters.end()) {
-			bool skip_chunk = false;
+		if (filter_entry != reader_data.filters->filters.end()) {
 			auto &filter = *filter_entry->second;
-
-			FilterPropagateResult prune_result;
-			if (column_reader->Type().id() == LogicalTypeId::VARCHAR &&
-			    group.columns[column_reader->FileIdx()].meta_data.statistics.__isset.min_value &&
-			    group.columns[column_reader->FileIdx()].meta_data.statistics.__isset.max_value) {
-				// our StringStats only store the first 8 bytes of strings (even if Parquet has longer string stats)
-				// however, when reading remote Parquet files, skipping row groups is really important
-				// here, we implement a special case to check the full length for string filters
-				if (filter.filter_type == TableFilterType::CONJUNCTION_AND) {
-					const auto &and_filter = filter.Cast<ConjunctionAndFilter>();
-					auto and_result = FilterPropagateResult::FILTER_ALWAYS_TRUE;
-					for (auto &child_filter : and_filter.child_filters) {
-						auto child_prune_result = CheckParquetStringFilter(
-						    *stats, group.columns[column_reader->FileIdx()].meta_data.statistics, *child_filter);
-						if (child_prune_result == FilterPropagateResult::FILTER_ALWAYS_FALSE) {
-							and_result = FilterPropagateResult::FILTER_ALWAYS_FALSE;
-							break;
-						} else if (child_prune_result != and_result) {
-							and_result = FilterPropagateResult::NO_PRUNING_POSSIBLE;
-						}
-					}
-					prune_result = and_result;
-				} else {
-					prune_result = CheckParquetStringFilter(
-					    *stats, group.columns[column_reader->FileIdx()].meta_data.statistics, filter);
-				}
-			} else {
-				prune_result = filter.CheckStatistics(*stats);
+			// generated columns (i.e. the file_row_number) do not have a column chunk in the file
+			optional_ptr<const ColumnMetaData> column_meta_data;
+			if (column_reader->FileIdx() < group.columns.size()) {
+				column_meta_data = &group.columns[column_reader->FileIdx()].meta_data;
 			}
-
-			if (prune_result == FilterPropagateResult::FILTER_ALWAYS_FALSE) {
-				skip_chunk = true;
+			auto prune_result = FilterPropagateResult::NO_PRUNING_POSSIBLE;
+			if (stats) {
+				prune_result = column_meta_data
+				                   ? CheckParquetFilter(*column_reader, *stats, column_meta_data->statistics, filter)
+				                   : filter.CheckStatistics(*stats);
+			}
+			if (prune_result != FilterPropagateResult::FILTER_ALWAYS_FALSE && column_meta_data &&
+			    !parquet_options.encryption_config && state.group_offset < NumericCast<idx_t>(group.num_rows) &&
+			    ParquetStatisticsUtils::BloomFilterExcludes(*column_reader, filter, *column_meta_data,
+			                                                *state.thrift_file_proto)) {
+				// the bloom filter proves that none of the values we are looking for are in this row group
+				prune_result = FilterPropagateResult::FILTER_ALWAYS_FALSE;
 			}
-			if (skip_chunk) {
+			if (prune_result == FilterPropagateResult::FILTER_ALWAYS_FALSE) {
 				// this effectively will skip this chunk
 				state.group_offset = group.num_rows;
 				return;
@@ -776,6 +821,81 @@ void ParquetReader::PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t c
 	                                  *state.thrift_file_proto);
 }
 
+static unique_ptr<BaseStatistics> GetPageStatistics(const ColumnReader &column_reader, const ColumnIndex &column_index,
+                                                    idx_t page_idx, Statistics &page_stats) {
+	if (column_index.__isset.null_counts) {
+		page_stats.__set_null_count(column_index.null_counts[page_idx]);
+	}
+	if (column_index.null_pages[page_idx]) {
+		// the page only contains NULL values
+		auto stats = BaseStatistics::CreateEmpty(column_reader.Type());
+		stats.Set(StatsInfo::CAN_HAVE_NULL_VALUES);
+		stats.Set(StatsInfo::CANNOT_HAVE_VALID_VALUES);
+		return stats.ToUnique();
+	}
+	page_stats.__set_min_value(column_index.min_values[page_idx]);
+	page_stats.__set_max_value(column_index.max_values[page_idx]);
+	return ParquetStatisticsUtils::TransformStatistics(column_reader, page_stats);
+}
+
+void ParquetReader::PrunePages(ParquetReaderScanState &state) {
+	state.pruned_ranges.clear();
+	state.pruned_range_idx = 0;
+	auto &group = GetGroup(state);
+	if (!reader_data.filters || state.group_offset >= NumericCast<idx_t>(group.num_rows)) {
+		return;
+	}
+	auto &root_reader = state.root_reader->Cast<StructColumnReader>();
+	vector<pair<idx_t, idx_t>> ranges;
+	for (auto &filter_col : reader_data.filters->filters) {
+		auto &filter_entry = reader_data.filter_map[filter_col.first];
+		if (filter_entry.is_constant) {
+			continue;
+		}
+		auto column_reader = root_reader.GetChildReader(reader_data.column_ids[filter_entry.index]);
+		if (!column_reader->HasPageIndex()) {
+			continue;
+		}
+		auto column_index = column_reader->ReadColumnIndex();
+		auto &pages = column_reader->GetOffsetIndex().page_locations;
+		if (column_index->null_pages.size() != pages.size() || column_index->min_values.size() != pages.size() ||
+		    column_index->max_values.size() != pages.size() ||
+		    (column_index->__isset.null_counts && column_index->null_counts.size() != pages.size())) {
+			// malformed page index - ignore it
+			continue;
+		}
+		for (idx_t page_idx = 0; page_idx < pages.size(); page_idx++) {
+			Statistics page_stats;
+			auto stats = GetPageStatistics(*column_reader, *column_index, page_idx, page_stats);
+			if (!stats || CheckParquetFilter(*column_reader, *stats, page_stats, *filter_col.second) !=
+			                  FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+				continue;
+			}
+			auto start = NumericCast<idx_t>(pages[page_idx].first_row_index);
+			auto end = page_idx + 1 < pages.size() ? NumericCast<idx_t>(pages[page_idx + 1].first_row_index)
+			                                       : NumericCast<idx_t>(group.num_rows);
+			ranges.emplace_back(start, end);
+		}
+	}
+	// the filters of all columns have to hold - merge the pruned ranges of the individual columns
+	std::sort(ranges.begin(), ranges.end());
+	for (auto &range : ranges) {
+		if (!state.pruned_ranges.empty() && range.first <= state.pruned_ranges.back().second) {
+			state.pruned_ranges.back().second = MaxValue<idx_t>(state.pruned_ranges.back().second, range.second);
+		} else {
+			state.pruned_ranges.push_back(range);
+		}
+	}
+}
+
+void ParquetReader::SkipRows(ParquetReaderScanState &state, idx_t count) {
+	auto &root_reader = state.root_reader->Cast<StructColumnReader>();
+	for (idx_t col_idx = 0; col_idx < reader_data.column_ids.size(); col_idx++) {
+		root_reader.GetChildReader(reader_data.column_ids[col_idx])->Skip(count);
+	}
+	state.group_offset += count;
+}
+
 idx_t ParquetReader::NumRows() {
 	return GetFileMetadata()->num_rows;
 }
@@ -797,10 +917,15 @@ void ParquetReader::InitializeScan(ClientContext &context, ParquetReaderScanStat
 		if (!file_handle->OnDiskFile() && file_handle->CanSeek()) {
 			state.prefetch_mode = true;
 			flags |= FileFlags::FILE_FLAGS_DIRECT_IO;
+		} else if (file_handle->SupportsAsyncReads()) {
+			// local files that can be read asynchronously: let the reader prefetch (and read ahead the next row group)
+			state.prefetch_mode = true;
 		} else {
 			state.prefetch_mode = false;
 		}
 
+		// the transport can still have reads of the old file in flight
+		state.thrift_file_proto.reset();
 		state.file_handle = fs.OpenFile(file_handle->path, flags);
 	}
 
@@ -940,6 +1065,48 @@ static void FilterOperationSwitch(Vector &v, Value &constant, parquet_filter_t &
 	}
 }
 
+static void FilterBloom(Vector &v, const BloomFilter &bloom_filter, parquet_filter_t &filter_mask, idx_t count) {
+	if (filter_mask.none() || count == 0) {
+		return;
+	}
+	Vector hashes(LogicalType::HASH);
+	VectorOperations::Hash(v, hashes, count);
+
+	UnifiedVectorFormat vdata;
+	v.ToUnifiedFormat(count, vdata);
+	UnifiedVectorFormat hdata;
+	hashes.ToUnifiedFormat(count, hdata);
+	auto hash_data = UnifiedVectorFormat::GetData<hash_t>(hdata);
+	for (idx_t i = 0; i < count; i++) {
+		if (filter_mask.test(i)) {
+			filter_mask.set(i, vdata.validity.RowIsValid(vdata.sel->get_index(i)) &&
+			                       bloom_filter.filter->Lookup(hash_data[hdata.sel->get_index(i)]));
+		}
+	}
+}
+
+static void FilterIn(Vector &v, const InFilter &in_filter, parquet_filter_t &filter_mask, idx_t count) {
+	if (filter_mask.none() || count == 0) {
+		return;
+	}
+	// convert the mask into a selection vector, and filter the selected rows
+	SelectionVector sel(count);
+	idx_t sel_count = 0;
+	for (idx_t i = 0; i < count; i++) {
+		if (filter_mask.test(i)) {
+			sel.set_index(sel_count++, i);
+		}
+	}
+	UnifiedVectorFormat vdata;
+	v.ToUnifiedFormat(count, vdata);
+	in_filter.Filter(v, vdata, sel, sel_count);
+
+	filter_mask.reset();
+	for (idx_t i = 0; i < sel_count; i++) {
+		filter_mask.set(sel.get_index(i));
+	}
+}
+
 static void ApplyFilter(Vector &v, TableFilter &filter, parquet_filter_t &filter_mask, idx_t count) {
 	switch (filter.filter_type) {
 	case TableFilterType::CONJUNCTION_AND: {
@@ -994,6 +1161,19 @@ static void ApplyFilter(Vector &v, TableFilter &filter, parquet_filter_t &filter
 		auto &child = StructVector::GetEntries(v)[struct_filter.child_idx];
 		ApplyFilter(*child, *struct_filter.child_filter, filter_mask, count);
 	} break;
+	case TableFilterType::BLOOM_FILTER:
+		FilterBloom(v, filter.Cast<BloomFilter>(), filter_mask, count);
+		break;
+	case TableFilterType::IN_FILTER:
+		FilterIn(v, filter.Cast<InFilter>(), filter_mask, count);
+		break;
+	case TableFilterType::DYNAMIC_FILTER: {
+		auto current_filter = filter.Cast<DynamicFilter>().GetFilter();
+		if (current_filter) {
+			ApplyFilter(v, *current_filter, filter_mask, count);
+		}
+		break;
+	}
 	default:
 		D_ASSERT(0);
 		break;
@@ -1059,6 +1239,8 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 						trans.Prefetch(GetGroupOffset(state), total_row_group_span);
 					}
 					state.current_group_prefetched = true;
+					// read the next row group in the background while this one is being scanned
+					PrefetchNextGroupAsync(state);
 				}
 			} else {
 				// lazy fetching is when all tuples in a column can be skipped. With lazy fetching the buffer is only
@@ -1085,10 +1267,30 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 				}
 			}
 		}
+		PrunePages(state);
+		return true;
+	}
+
+	// skip over the rows that were pruned using the page index
+	auto scan_end = NumericCast<idx_t>(GetGroup(state).num_rows);
+	while (state.pruned_range_idx < state.pruned_ranges.size()) {
+		auto &range = state.pruned_ranges[state.pruned_range_idx];
+		if (range.first > state.group_offset) {
+			// end this chunk at the start of the next pruned range
+			scan_end = MinValue<idx_t>(scan_end, range.first);
+			break;
+		}
+		if (range.second > state.group_offset) {
+			SkipRows(state, MinValue<idx_t>(range.second, scan_end) - state.group_offset);
+		}
+		state.pruned_range_idx++;
+	}
+	if (state.group_offset >= scan_end) {
+		// we skipped the remainder of the row group
 		return true;
 	}
 
-	auto this_output_chunk_rows = MinValue<idx_t>(STANDARD_VECTOR_SIZE, GetGroup(state).num_rows - state.group_offset);
+	auto this_output_chunk_rows = MinValue<idx_t>(STANDARD_VECTOR_SIZE, scan_end - state.group_offset);
 	result.SetCardinality(this_output_chunk_rows);
 
 	if (this_output_chunk_rows == 0) {
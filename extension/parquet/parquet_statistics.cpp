@@ -5,10 +5,15 @@
 #include "parquet_timestamp.hpp"
 #include "string_column_reader.hpp"
 #include "struct_column_reader.hpp"
+#include "thrift_tools.hpp"
+#include "zstd/common/xxhash.h"
 #ifndef DUCKDB_AMALGAMATION
 #include "duckdb/common/types/blob.hpp"
 #include "duckdb/common/types/time.hpp"
 #include "duckdb/common/types/value.hpp"
+#include "duckdb/planner/filter/conjunction_filter.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/in_filter.hpp"
 #include "duckdb/storage/statistics/struct_stats.hpp"
 #endif
 
@@ -320,8 +325,13 @@ unique_ptr<BaseStatistics> ParquetStatisticsUtils::TransformColumnStatistics(con
 		// no stats present for row group
 		return nullptr;
 	}
-	auto &parquet_stats = column_chunk.meta_data.statistics;
+	return TransformStatistics(reader, column_chunk.meta_data.statistics);
+}
 
+unique_ptr<BaseStatistics>
+ParquetStatisticsUtils::TransformStatistics(const ColumnReader &reader,
+                                            const duckdb_parquet::format::Statistics &parquet_stats) {
+	unique_ptr<BaseStatistics> row_group_stats;
 	auto &type = reader.Type();
 	auto &s_ele = reader.Schema();
 
@@ -387,4 +397,250 @@ unique_ptr<BaseStatistics> ParquetStatisticsUtils::TransformColumnStatistics(con
 	return row_group_stats;
 }
 
+//===--------------------------------------------------------------------===//
+// Bloom Filters
+//===--------------------------------------------------------------------===//
+static constexpr const uint32_t BLOOM_FILTER_SALT[ParquetBloomFilter::BLOCK_WORDS] = {
+    0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU, 0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U};
+
+static vector<uint32_t> InitializeBloomFilter(idx_t num_distinct, double false_positive_ratio) {
+	// the optimal number of bits per value for a split block bloom filter with 8 bits set per value
+	auto bits_per_value = -8.0 / std::log(1.0 - std::pow(false_positive_ratio, 1.0 / 8.0));
+	auto num_bytes = static_cast<idx_t>(bits_per_value * static_cast<double>(MaxValue<idx_t>(num_distinct, 1)) / 8.0);
+	num_bytes = MinValue<idx_t>(NextPowerOfTwo(MaxValue<idx_t>(num_bytes, ParquetBloomFilter::BLOCK_SIZE)),
+	                            ParquetBloomFilter::MAX_SIZE);
+	return vector<uint32_t>(num_bytes / sizeof(uint32_t), 0);
+}
+
+ParquetBloomFilter::ParquetBloomFilter(idx_t num_distinct, double false_positive_ratio)
+    : words(InitializeBloomFilter(num_distinct, false_positive_ratio)) {
+}
+
+ParquetBloomFilter::ParquetBloomFilter(vector<uint32_t> words_p) : words(std::move(words_p)) {
+	if (words.empty() || words.size() % BLOCK_WORDS != 0) {
+		throw InternalException("ParquetBloomFilter requires a multiple of the block size");
+	}
+}
+
+idx_t ParquetBloomFilter::BlockOffset(uint64_t hash) const {
+	// the upper 32 bits of the hash select the block
+	auto block_count = words.size() / BLOCK_WORDS;
+	return ((hash >> 32) * block_count >> 32) * BLOCK_WORDS;
+}
+
+void ParquetBloomFilter::Insert(uint64_t hash) {
+	auto block = words.data() + BlockOffset(hash);
+	auto key = static_cast<uint32_t>(hash);
+	for (idx_t i = 0; i < BLOCK_WORDS; i++) {
+		block[i] |= 1U << ((key * BLOOM_FILTER_SALT[i]) >> 27);
+	}
+}
+
+bool ParquetBloomFilter::Check(uint64_t hash) const {
+	auto block = words.data() + BlockOffset(hash);
+	auto key = static_cast<uint32_t>(hash);
+	for (idx_t i = 0; i < BLOCK_WORDS; i++) {
+		if (!(block[i] & (1U << ((key * BLOOM_FILTER_SALT[i]) >> 27)))) {
+			return false;
+		}
+	}
+	return true;
+}
+
+uint64_t ParquetBloomFilter::Hash(const_data_ptr_t data, idx_t size) {
+	return duckdb_zstd::XXH64(data, size, 0);
+}
+
+bool ParquetStatisticsUtils::BloomFilterSupported(const ColumnReader &reader) {
+	// we only probe bloom filters if the values of the column are stored in the file as-is
+	// floating point values are excluded as -0.0 and 0.0 (or different NaNs) hash differently
+	auto &type = reader.Type();
+	auto &schema = reader.Schema();
+	switch (schema.type) {
+	case Type::INT32:
+		switch (type.id()) {
+		case LogicalTypeId::TINYINT:
+		case LogicalTypeId::SMALLINT:
+		case LogicalTypeId::INTEGER:
+		case LogicalTypeId::UTINYINT:
+		case LogicalTypeId::USMALLINT:
+		case LogicalTypeId::UINTEGER:
+		case LogicalTypeId::DATE:
+			return true;
+		case LogicalTypeId::DECIMAL:
+			return schema.__isset.scale && NumericCast<idx_t>(schema.scale) == DecimalType::GetScale(type);
+		default:
+			return false;
+		}
+	case Type::INT64:
+		switch (type.id()) {
+		case LogicalTypeId::BIGINT:
+		case LogicalTypeId::UBIGINT:
+			return true;
+		case LogicalTypeId::DECIMAL:
+			return schema.__isset.scale && NumericCast<idx_t>(schema.scale) == DecimalType::GetScale(type);
+		default:
+			return false;
+		}
+	case Type::BYTE_ARRAY:
+		return type.id() == LogicalTypeId::VARCHAR || type.id() == LogicalTypeId::BLOB;
+	default:
+		return false;
+	}
+}
+
+template <class T>
+static T GetIntegralValue(const Value &value) {
+	switch (value.type().InternalType()) {
+	case PhysicalType::INT8:
+		return static_cast<T>(value.GetValueUnsafe<int8_t>());
+	case PhysicalType::INT16:
+		return static_cast<T>(value.GetValueUnsafe<int16_t>());
+	case PhysicalType::INT32:
+		return static_cast<T>(value.GetValueUnsafe<int32_t>());
+	case PhysicalType::INT64:
+		return static_cast<T>(value.GetValueUnsafe<int64_t>());
+	case PhysicalType::UINT8:
+		return static_cast<T>(value.GetValueUnsafe<uint8_t>());
+	case PhysicalType::UINT16:
+		return static_cast<T>(value.GetValueUnsafe<uint16_t>());
+	case PhysicalType::UINT32:
+		return static_cast<T>(value.GetValueUnsafe<uint32_t>());
+	case PhysicalType::UINT64:
+		return static_cast<T>(value.GetValueUnsafe<uint64_t>());
+	default:
+		throw InternalException("Unsupported type for Parquet bloom filter");
+	}
+}
+
+//! Computes the hash of a value as it is stored in the Parquet file
+static bool TryHashBloomFilterValue(const ColumnReader &reader, const Value &value, uint64_t &result) {
+	if (value.IsNull() || value.type() != reader.Type()) {
+		return false;
+	}
+	switch (reader.Schema().type) {
+	case Type::INT32:
+		result = ParquetBloomFilter::Hash(GetIntegralValue<int32_t>(value));
+		return true;
+	case Type::INT64:
+		result = ParquetBloomFilter::Hash(GetIntegralValue<int64_t>(value));
+		return true;
+	case Type::BYTE_ARRAY: {
+		auto &str = StringValue::Get(value);
+		result = ParquetBloomFilter::Hash(const_data_ptr_cast(str.c_str()), str.size());
+		return true;
+	}
+	default:
+		return false;
+	}
+}
+
+static bool BloomFilterExcludesValue(const ColumnReader &reader, const ParquetBloomFilter &bloom_filter,
+                                     const Value &value) {
+	uint64_t hash;
+	return TryHashBloomFilterValue(reader, value, hash) && !bloom_filter.Check(hash);
+}
+
+static bool BloomFilterExcludesFilter(const ColumnReader &reader, const ParquetBloomFilter &bloom_filter,
+                                      const TableFilter &filter) {
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON: {
+		auto &constant_filter = filter.Cast<ConstantFilter>();
+		if (constant_filter.comparison_type != ExpressionType::COMPARE_EQUAL) {
+			return false;
+		}
+		return BloomFilterExcludesValue(reader, bloom_filter, constant_filter.constant);
+	}
+	case TableFilterType::IN_FILTER: {
+		auto &in_filter = filter.Cast<InFilter>();
+		for (auto &value : in_filter.values) {
+			if (!BloomFilterExcludesValue(reader, bloom_filter, value)) {
+				return false;
+			}
+		}
+		return true;
+	}
+	case TableFilterType::CONJUNCTION_AND: {
+		auto &and_filter = filter.Cast<ConjunctionAndFilter>();
+		for (auto &child_filter : and_filter.child_filters) {
+			if (BloomFilterExcludesFilter(reader, bloom_filter, *child_filter)) {
+				return true;
+			}
+		}
+		return false;
+	}
+	case TableFilterType::CONJUNCTION_OR: {
+		auto &or_filter = filter.Cast<ConjunctionOrFilter>();
+		for (auto &child_filter : or_filter.child_filters) {
+			if (!BloomFilterExcludesFilter(reader, bloom_filter, *child_filter)) {
+				return false;
+			}
+		}
+		return true;
+	}
+	default:
+		return false;
+	}
+}
+
+//! Whether or not the filter contains a (top-level) equality or IN comparison for which the bloom filter can be probed
+static bool BloomFilterCanExclude(const TableFilter &filter) {
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON:
+		return filter.Cast<ConstantFilter>().comparison_type == ExpressionType::COMPARE_EQUAL;
+	case TableFilterType::IN_FILTER:
+		return true;
+	case TableFilterType::CONJUNCTION_AND: {
+		auto &and_filter = filter.Cast<ConjunctionAndFilter>();
+		for (auto &child_filter : and_filter.child_filters) {
+			if (BloomFilterCanExclude(*child_filter)) {
+				return true;
+			}
+		}
+		return false;
+	}
+	case TableFilterType::CONJUNCTION_OR: {
+		auto &or_filter = filter.Cast<ConjunctionOrFilter>();
+		for (auto &child_filter : or_filter.child_filters) {
+			if (!BloomFilterCanExclude(*child_filter)) {
+				return false;
+			}
+		}
+		return true;
+	}
+	default:
+		return false;
+	}
+}
+
+bool ParquetStatisticsUtils::BloomFilterExcludes(const ColumnReader &reader, const TableFilter &filter,
+                                                 const duckdb_parquet::format::ColumnMetaData &column_meta_data,
+                                                 duckdb_apache::thrift::protocol::TProtocol &file_proto) {
+	if (!column_meta_data.__isset.bloom_filter_offset || column_meta_data.bloom_filter_offset <= 0 ||
+	    !BloomFilterCanExclude(filter) || !BloomFilterSupported(reader)) {
+		return false;
+	}
+	// the bloom filter is stored separately from the column chunk - restore the location after reading it
+	auto &transport = reinterpret_cast<ThriftFileTransport &>(*file_proto.getTransport());
+	auto current_location = transport.GetLocation();
+	transport.SetLocation(NumericCast<idx_t>(column_meta_data.bloom_filter_offset));
+
+	duckdb_parquet::format::BloomFilterHeader header;
+	header.read(&file_proto);
+	if (!header.algorithm.__isset.BLOCK || !header.hash.__isset.XXHASH || !header.compression.__isset.UNCOMPRESSED ||
+	    header.numBytes <= 0 || NumericCast<idx_t>(header.numBytes) > ParquetBloomFilter::MAX_SIZE ||
+	    header.numBytes % ParquetBloomFilter::BLOCK_SIZE != 0 ||
+	    transport.GetLocation() + NumericCast<idx_t>(header.numBytes) > transport.GetSize()) {
+		// unsupported (or corrupt) bloom filter - ignore it
+		transport.SetLocation(current_location);
+		return false;
+	}
+	vector<uint32_t> words(NumericCast<idx_t>(header.numBytes) / sizeof(uint32_t));
+	transport.read(data_ptr_cast(words.data()), NumericCast<uint32_t>(header.numBytes));
+	transport.SetLocation(current_location);
+
+	ParquetBloomFilter bloom_filter(std::move(words));
+	return BloomFilterExcludesFilter(reader, bloom_filter, filter);
+}
+
 } // namespace duckdb
@@ -301,6 +301,10 @@ uint32_t ParquetWriter::WriteData(const const_data_ptr_t buffer, const uint32_t
 	}
 }
 
+void ParquetWriter::BufferBloomFilter(idx_t col_idx, unique_ptr<ParquetBloomFilter> bloom_filter) {
+	bloom_filters.emplace_back(col_idx, std::move(bloom_filter));
+}
+
 void VerifyUniqueNames(const vector<string> &names) {
 #ifdef DEBUG
 	unordered_set<string> name_set;
@@ -319,11 +323,13 @@ ParquetWriter::ParquetWriter(ClientContext &context, FileSystem &fs, string file
                              const vector<pair<string, string>> &kv_metadata,
                              shared_ptr<ParquetEncryptionConfig> encryption_config_p,
                              double dictionary_compression_ratio_threshold_p, optional_idx compression_level_p,
-                             bool debug_use_openssl_p)
+                             bool debug_use_openssl_p, const vector<bool> &bloom_filter_columns,
+                             double bloom_filter_false_positive_ratio_p)
     : file_name(std::move(file_name_p)), sql_types(std::move(types_p)), column_names(std::move(names_p)), codec(codec),
       field_ids(std::move(field_ids_p)), encryption_config(std::move(encryption_config_p)),
       dictionary_compression_ratio_threshold(dictionary_compression_ratio_threshold_p),
-      debug_use_openssl(debug_use_openssl_p) {
+      debug_use_openssl(debug_use_openssl_p),
+      bloom_filter_false_positive_ratio(bloom_filter_false_positive_ratio_p) {
 	// initialize the file writer
 	writer = make_uniq<BufferedFileWriter>(fs, file_name.c_str(),
 	                                       FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE_NEW);
@@ -390,6 +396,16 @@ ParquetWriter::ParquetWriter(ClientContext &context, FileSystem &fs, string file
 		column_writers.push_back(ColumnWriter::CreateWriterRecursive(
 		    context, file_meta_data.schema, *this, sql_types[i], unique_names[i], schema_path, &field_ids));
 	}
+	for (idx_t i = 0; i < bloom_filter_columns.size(); i++) {
+		if (!bloom_filter_columns[i]) {
+			continue;
+		}
+		if (!column_writers[i]->SupportsBloomFilter()) {
+			throw BinderException("BLOOM_FILTER_COLUMNS: bloom filters are not supported for column \"%s\" of type %s",
+			                      column_names[i], sql_types[i].ToString());
+		}
+		column_writers[i]->write_bloom_filter = true;
+	}
 }
 
 void ParquetWriter::PrepareRowGroup(ColumnDataCollection &buffer, PreparedRowGroup &result) {
@@ -511,6 +527,25 @@ void ParquetWriter::FlushRowGroup(PreparedRowGroup &prepared) {
 		auto write_state = std::move(states[col_idx]);
 		col_writer->FinalizeWrite(*write_state);
 	}
+	// write the bloom filters of the row group after all of its column chunks
+	for (auto &entry : bloom_filters) {
+		auto &column_chunk = row_group.columns[entry.first];
+		auto &bloom_filter = *entry.second;
+
+		duckdb_parquet::format::BloomFilterHeader header;
+		header.numBytes = NumericCast<int32_t>(bloom_filter.SizeInBytes());
+		header.algorithm.__set_BLOCK(duckdb_parquet::format::SplitBlockAlgorithm());
+		header.hash.__set_XXHASH(duckdb_parquet::format::XxHash());
+		header.compression.__set_UNCOMPRESSED(duckdb_parquet::format::Uncompressed());
+
+		auto bloom_filter_offset = writer->GetTotalWritten();
+		Write(header);
+		WriteData(bloom_filter.Data(), NumericCast<uint32_t>(bloom_filter.SizeInBytes()));
+		column_chunk.meta_data.__set_bloom_filter_offset(NumericCast<int64_t>(bloom_filter_offset));
+		column_chunk.meta_data.__set_bloom_filter_length(
+		    NumericCast<int32_t>(writer->GetTotalWritten() - bloom_filter_offset));
+	}
+	bloom_filters.clear();
 	// let's make sure all offsets are ay-okay
 	ValidateColumnOffsets(file_name, writer->GetTotalWritten(), row_group);
 
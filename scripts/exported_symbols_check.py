@@ -20,6 +20,7 @@ whitelist = [
     'N6duckdb',
     'duckdb::',
     'duckdb_miniz::',
+    'duckdb_lz4::',
     'duckdb_fmt::',
     'duckdb_hll::',
     'duckdb_moodycamel::',
@@ -26,6 +26,9 @@ TableCatalogEntry::TableCatalogEntry(Catalog &catalog, SchemaCatalogEntry &schem
 	this->dependencies = info.dependencies;
 	this->comment = info.comment;
 	this->tags = info.tags;
+	if (info.view_query) {
+		view_query = unique_ptr_cast<SQLStatement, SelectStatement>(info.view_query->Copy());
+	}
 }
 
 bool TableCatalogEntry::HasGeneratedColumns() const {
@@ -71,6 +74,9 @@ unique_ptr<CreateInfo> TableCatalogEntry::GetInfo() const {
 	              [&result](const unique_ptr<Constraint> &c) { result->constraints.emplace_back(c->Copy()); });
 	result->comment = comment;
 	result->tags = tags;
+	if (view_query) {
+		result->view_query = unique_ptr_cast<SQLStatement, SelectStatement>(view_query->Copy());
+	}
 	return std::move(result);
 }
 
@@ -181,6 +187,11 @@ string TableCatalogEntry::ToSQL() const {
 	return create_info->ToString();
 }
 
+const SelectStatement &TableCatalogEntry::GetViewQuery() const {
+	D_ASSERT(view_query);
+	return *view_query;
+}
+
 const ColumnList &TableCatalogEntry::GetColumns() const {
 	return columns;
 }
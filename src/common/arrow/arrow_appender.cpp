@@ -14,10 +14,12 @@ namespace duckdb {
 // ArrowAppender
 //===--------------------------------------------------------------------===//
 
-ArrowAppender::ArrowAppender(vector<LogicalType> types_p, const idx_t initial_capacity, ClientProperties options)
+ArrowAppender::ArrowAppender(vector<LogicalType> types_p, const idx_t initial_capacity, ClientProperties options,
+                             bool zero_copy)
     : types(std::move(types_p)) {
 	for (auto &type : types) {
 		auto entry = InitializeChild(type, initial_capacity, options);
+		entry->zero_copy = zero_copy;
 		root_data.push_back(std::move(entry));
 	}
 }
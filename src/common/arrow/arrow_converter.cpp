@@ -15,8 +15,9 @@
 
 namespace duckdb {
 
-void ArrowConverter::ToArrowArray(DataChunk &input, ArrowArray *out_array, ClientProperties options) {
-	ArrowAppender appender(input.GetTypes(), input.size(), std::move(options));
+void ArrowConverter::ToArrowArray(DataChunk &input, ArrowArray *out_array, ClientProperties options,
+                                  bool zero_copy) {
+	ArrowAppender appender(input.GetTypes(), input.size(), std::move(options), zero_copy);
 	appender.Append(input, 0, input.size(), input.size());
 	*out_array = appender.Finalize();
 }
@@ -0,0 +1,79 @@
+#include "duckdb/common/blocked_bloom_filter.hpp"
+
+#include "duckdb/common/serializer/deserializer.hpp"
+#include "duckdb/common/serializer/serializer.hpp"
+#include "duckdb/common/types/vector.hpp"
+
+namespace duckdb {
+
+static vector<uint64_t> InitializeWords(idx_t key_count) {
+	auto word_count = MaxValue<idx_t>(key_count * BlockedBloomFilter::BITS_PER_KEY / 64, 1);
+	return vector<uint64_t>(NextPowerOfTwo(word_count), 0);
+}
+
+BlockedBloomFilter::BlockedBloomFilter(idx_t key_count) : BlockedBloomFilter(InitializeWords(key_count)) {
+}
+
+BlockedBloomFilter::BlockedBloomFilter(vector<uint64_t> words_p) : words(std::move(words_p)) {
+	if (words.empty() || !IsPowerOfTwo(words.size())) {
+		throw InternalException("BlockedBloomFilter requires a power of two number of words");
+	}
+	word_mask = words.size() - 1;
+}
+
+void BlockedBloomFilter::Insert(Vector &hashes, idx_t count) {
+	UnifiedVectorFormat hdata;
+	hashes.ToUnifiedFormat(count, hdata);
+	auto hash_data = UnifiedVectorFormat::GetData<hash_t>(hdata);
+	for (idx_t i = 0; i < count; i++) {
+		Insert(hash_data[hdata.sel->get_index(i)]);
+	}
+}
+
+idx_t BlockedBloomFilter::Lookup(Vector &hashes, const SelectionVector &sel, idx_t count,
+                                 SelectionVector &result_sel) const {
+	UnifiedVectorFormat hdata;
+	hashes.ToUnifiedFormat(count, hdata);
+	auto hash_data = UnifiedVectorFormat::GetData<hash_t>(hdata);
+	idx_t result_count = 0;
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = sel.get_index(i);
+		result_sel.set_index(result_count, idx);
+		result_count += Lookup(hash_data[hdata.sel->get_index(idx)]);
+	}
+	return result_count;
+}
+
+bool BlockedBloomFilter::SupportsType(const LogicalType &type) {
+	switch (type.InternalType()) {
+	case PhysicalType::BOOL:
+	case PhysicalType::INT8:
+	case PhysicalType::INT16:
+	case PhysicalType::INT32:
+	case PhysicalType::INT64:
+	case PhysicalType::INT128:
+	case PhysicalType::UINT8:
+	case PhysicalType::UINT16:
+	case PhysicalType::UINT32:
+	case PhysicalType::UINT64:
+	case PhysicalType::UINT128:
+		return true;
+	case PhysicalType::VARCHAR:
+		// collations change which strings are equal
+		return type.id() != LogicalTypeId::VARCHAR || StringType::GetCollation(type).empty();
+	default:
+		// floating point values (-0.0 and 0.0, NaNs) and intervals have equal values with different representations
+		return false;
+	}
+}
+
+void BlockedBloomFilter::Serialize(Serializer &serializer) const {
+	serializer.WriteProperty(100, "words", words);
+}
+
+shared_ptr<BlockedBloomFilter> BlockedBloomFilter::Deserialize(Deserializer &deserializer) {
+	auto words = deserializer.ReadProperty<vector<uint64_t>>(100, "words");
+	return make_shared_ptr<BlockedBloomFilter>(std::move(words));
+}
+
+} // namespace duckdb
@@ -15,6 +15,7 @@
 #include "duckdb/common/box_renderer.hpp"
 #include "duckdb/common/enums/access_mode.hpp"
 #include "duckdb/common/enums/aggregate_handling.hpp"
+#include "duckdb/common/enums/buffer_eviction_policy.hpp"
 #include "duckdb/common/enums/catalog_lookup_behavior.hpp"
 #include "duckdb/common/enums/catalog_type.hpp"
 #include "duckdb/common/enums/compression_type.hpp"
@@ -773,6 +774,29 @@ BlockState EnumUtil::FromString<BlockState>(const char *value) {
 	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented in FromString<BlockState>", value));
 }
 
+template<>
+const char* EnumUtil::ToChars<BufferEvictionPolicy>(BufferEvictionPolicy value) {
+	switch(value) {
+	case BufferEvictionPolicy::LRU:
+		return "LRU";
+	case BufferEvictionPolicy::SCAN_RESISTANT:
+		return "SCAN_RESISTANT";
+	default:
+		throw NotImplementedException(StringUtil::Format("Enum value: '%d' not implemented in ToChars<BufferEvictionPolicy>", value));
+	}
+}
+
+template<>
+BufferEvictionPolicy EnumUtil::FromString<BufferEvictionPolicy>(const char *value) {
+	if (StringUtil::Equals(value, "LRU")) {
+		return BufferEvictionPolicy::LRU;
+	}
+	if (StringUtil::Equals(value, "SCAN_RESISTANT")) {
+		return BufferEvictionPolicy::SCAN_RESISTANT;
+	}
+	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented in FromString<BufferEvictionPolicy>", value));
+}
+
 template<>
 const char* EnumUtil::ToChars<CAPIResultSetType>(CAPIResultSetType value) {
 	switch(value) {
@@ -4441,6 +4465,8 @@ const char* EnumUtil::ToChars<MetricsType>(MetricsType value) {
 		return "OPTIMIZER_LIMIT_PUSHDOWN";
 	case MetricsType::OPTIMIZER_TOP_N:
 		return "OPTIMIZER_TOP_N";
+	case MetricsType::OPTIMIZER_LATE_MATERIALIZATION:
+		return "OPTIMIZER_LATE_MATERIALIZATION";
 	case MetricsType::OPTIMIZER_COMPRESSED_MATERIALIZATION:
 		return "OPTIMIZER_COMPRESSED_MATERIALIZATION";
 	case MetricsType::OPTIMIZER_DUPLICATE_GROUPS:
@@ -4568,6 +4594,9 @@ MetricsType EnumUtil::FromString<MetricsType>(const char *value) {
 	if (StringUtil::Equals(value, "OPTIMIZER_TOP_N")) {
 		return MetricsType::OPTIMIZER_TOP_N;
 	}
+	if (StringUtil::Equals(value, "OPTIMIZER_LATE_MATERIALIZATION")) {
+		return MetricsType::OPTIMIZER_LATE_MATERIALIZATION;
+	}
 	if (StringUtil::Equals(value, "OPTIMIZER_COMPRESSED_MATERIALIZATION")) {
 		return MetricsType::OPTIMIZER_COMPRESSED_MATERIALIZATION;
 	}
@@ -4869,6 +4898,8 @@ const char* EnumUtil::ToChars<OptimizerType>(OptimizerType value) {
 		return "LIMIT_PUSHDOWN";
 	case OptimizerType::TOP_N:
 		return "TOP_N";
+	case OptimizerType::LATE_MATERIALIZATION:
+		return "LATE_MATERIALIZATION";
 	case OptimizerType::COMPRESSED_MATERIALIZATION:
 		return "COMPRESSED_MATERIALIZATION";
 	case OptimizerType::DUPLICATE_GROUPS:
@@ -4942,6 +4973,9 @@ OptimizerType EnumUtil::FromString<OptimizerType>(const char *value) {
 	if (StringUtil::Equals(value, "TOP_N")) {
 		return OptimizerType::TOP_N;
 	}
+	if (StringUtil::Equals(value, "LATE_MATERIALIZATION")) {
+		return OptimizerType::LATE_MATERIALIZATION;
+	}
 	if (StringUtil::Equals(value, "COMPRESSED_MATERIALIZATION")) {
 		return OptimizerType::COMPRESSED_MATERIALIZATION;
 	}
@@ -7412,6 +7446,12 @@ const char* EnumUtil::ToChars<TableFilterType>(TableFilterType value) {
 		return "CONJUNCTION_AND";
 	case TableFilterType::STRUCT_EXTRACT:
 		return "STRUCT_EXTRACT";
+	case TableFilterType::BLOOM_FILTER:
+		return "BLOOM_FILTER";
+	case TableFilterType::IN_FILTER:
+		return "IN_FILTER";
+	case TableFilterType::DYNAMIC_FILTER:
+		return "DYNAMIC_FILTER";
 	default:
 		throw NotImplementedException(StringUtil::Format("Enum value: '%d' not implemented in ToChars<TableFilterType>", value));
 	}
@@ -7437,6 +7477,15 @@ TableFilterType EnumUtil::FromString<TableFilterType>(const char *value) {
 	if (StringUtil::Equals(value, "STRUCT_EXTRACT")) {
 		return TableFilterType::STRUCT_EXTRACT;
 	}
+	if (StringUtil::Equals(value, "BLOOM_FILTER")) {
+		return TableFilterType::BLOOM_FILTER;
+	}
+	if (StringUtil::Equals(value, "IN_FILTER")) {
+		return TableFilterType::IN_FILTER;
+	}
+	if (StringUtil::Equals(value, "DYNAMIC_FILTER")) {
+		return TableFilterType::DYNAMIC_FILTER;
+	}
 	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented in FromString<TableFilterType>", value));
 }
 
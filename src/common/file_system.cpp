@@ -379,6 +379,18 @@ void FileSystem::Write(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t
 	throw NotImplementedException("%s: Write (with location) is not implemented!", GetName());
 }
 
+unique_ptr<PendingFileReads> FileSystem::SubmitReads(FileHandle &handle, vector<FileReadRequest> requests) {
+	// read the requests one-by-one - the returned batch has already completed
+	for (auto &request : requests) {
+		Read(handle, request.buffer, UnsafeNumericCast<int64_t>(request.nr_bytes), request.location);
+	}
+	return make_uniq<PendingFileReads>();
+}
+
+bool FileSystem::SupportsAsyncReads(FileHandle &handle) {
+	return false;
+}
+
 int64_t FileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes) {
 	throw NotImplementedException("%s: Read is not implemented!", GetName());
 }
@@ -557,6 +569,12 @@ FileHandle::FileHandle(FileSystem &file_system, string path_p) : file_system(fil
 FileHandle::~FileHandle() {
 }
 
+PendingFileReads::~PendingFileReads() {
+}
+
+void PendingFileReads::Wait() {
+}
+
 int64_t FileHandle::Read(void *buffer, idx_t nr_bytes) {
 	return file_system.Read(*this, buffer, UnsafeNumericCast<int64_t>(nr_bytes));
 }
@@ -577,6 +595,18 @@ void FileHandle::Write(void *buffer, idx_t nr_bytes, idx_t location) {
 	file_system.Write(*this, buffer, UnsafeNumericCast<int64_t>(nr_bytes), location);
 }
 
+unique_ptr<PendingFileReads> FileHandle::SubmitReads(vector<FileReadRequest> requests) {
+	return file_system.SubmitReads(*this, std::move(requests));
+}
+
+void FileHandle::ReadBatch(vector<FileReadRequest> requests) {
+	SubmitReads(std::move(requests))->Wait();
+}
+
+bool FileHandle::SupportsAsyncReads() {
+	return file_system.SupportsAsyncReads(*this);
+}
+
 void FileHandle::Seek(idx_t location) {
 	file_system.Seek(*this, location);
 }
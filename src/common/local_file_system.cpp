@@ -47,6 +47,18 @@ extern "C" WINBASEAPI BOOL QueryFullProcessImageNameW(HANDLE, DWORD, LPWSTR, PDW
 #endif
 #include <fcntl.h>
 #include <libgen.h>
+// io_uring is used for batches of reads if the kernel (headers) support it
+#if defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#if defined(__NR_io_uring_setup) && defined(__NR_io_uring_enter)
+#define DUCKDB_IO_URING
+#endif
+#endif
+#endif
 // See e.g.:
 // https://opensource.apple.com/source/CarbonHeaders/CarbonHeaders-18.1/TargetConditionals.h.auto.html
 #elif defined(__APPLE__)
@@ -470,6 +482,244 @@ int64_t LocalFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes
 	return bytes_read;
 }
 
+#ifdef DUCKDB_IO_URING
+//! A batch of reads that is submitted to an io_uring. We talk to the kernel directly (without liburing): the ring is
+//! set up for the batch, and torn down once all reads of the batch have completed.
+class IOUringReads : public PendingFileReads {
+public:
+	//! The maximum amount of reads that are in flight at the same time
+	static constexpr idx_t MAX_QUEUE_DEPTH = 128;
+
+	IOUringReads(FileHandle &handle, vector<FileReadRequest> requests_p)
+	    : handle(handle), fd(handle.Cast<UnixFileHandle>().fd), requests(std::move(requests_p)),
+	      iovecs(requests.size()) {
+		for (idx_t i = 0; i < requests.size(); i++) {
+			iovecs[i].iov_base = requests[i].buffer;
+			iovecs[i].iov_len = requests[i].nr_bytes;
+		}
+	}
+	~IOUringReads() override {
+		// we cannot free the ring (or the buffers) while the kernel is still writing into them
+		try {
+			while (in_flight > 0) {
+				WaitForCompletions();
+			}
+		} catch (...) { // NOLINT
+		}
+		Close();
+	}
+
+	//! Set up the ring, returns false if io_uring is not available
+	bool Initialize() {
+		auto queue_depth = NumericCast<unsigned>(MinValue<idx_t>(NextPowerOfTwo(requests.size()), MAX_QUEUE_DEPTH));
+		io_uring_params params;
+		memset(&params, 0, sizeof(params));
+		ring_fd = static_cast<int>(syscall(__NR_io_uring_setup, queue_depth, &params));
+		if (ring_fd < 0) {
+			return false;
+		}
+		max_in_flight = params.sq_entries;
+		sq_ring_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+		cq_ring_size = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+		bool single_mmap = false;
+#ifdef IORING_FEAT_SINGLE_MMAP
+		single_mmap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+#endif
+		if (single_mmap) {
+			sq_ring_size = cq_ring_size = MaxValue(sq_ring_size, cq_ring_size);
+		}
+		sq_ring = mmap(nullptr, sq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd,
+		               IORING_OFF_SQ_RING);
+		if (sq_ring == MAP_FAILED) {
+			return false;
+		}
+		if (single_mmap) {
+			cq_ring = sq_ring;
+		} else {
+			cq_ring = mmap(nullptr, cq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd,
+			               IORING_OFF_CQ_RING);
+			if (cq_ring == MAP_FAILED) {
+				return false;
+			}
+		}
+		sqes_size = params.sq_entries * sizeof(io_uring_sqe);
+		sqes = mmap(nullptr, sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd, IORING_OFF_SQES);
+		if (sqes == MAP_FAILED) {
+			return false;
+		}
+		auto sq_ptr = static_cast<data_ptr_t>(sq_ring);
+		sq_tail = reinterpret_cast<unsigned *>(sq_ptr + params.sq_off.tail);
+		sq_mask = reinterpret_cast<unsigned *>(sq_ptr + params.sq_off.ring_mask);
+		sq_array = reinterpret_cast<unsigned *>(sq_ptr + params.sq_off.array);
+		auto cq_ptr = static_cast<data_ptr_t>(cq_ring);
+		cq_head = reinterpret_cast<unsigned *>(cq_ptr + params.cq_off.head);
+		cq_tail = reinterpret_cast<unsigned *>(cq_ptr + params.cq_off.tail);
+		cq_mask = reinterpret_cast<unsigned *>(cq_ptr + params.cq_off.ring_mask);
+		cqes = reinterpret_cast<io_uring_cqe *>(cq_ptr + params.cq_off.cqes);
+		return true;
+	}
+
+	//! Submit as many of the remaining reads as fit in the ring
+	void Submit() {
+		auto submission_entries = static_cast<io_uring_sqe *>(sqes);
+		unsigned tail = *sq_tail;
+		unsigned to_submit = 0;
+		while (next_request < requests.size() && in_flight + to_submit < max_in_flight) {
+			auto &request = requests[next_request];
+			auto index = tail & *sq_mask;
+			auto &sqe = submission_entries[index];
+			memset(&sqe, 0, sizeof(sqe));
+			sqe.opcode = IORING_OP_READV;
+			sqe.fd = fd;
+			sqe.addr = reinterpret_cast<uint64_t>(&iovecs[next_request]);
+			sqe.len = 1;
+			sqe.off = request.location;
+			sqe.user_data = next_request;
+			sq_array[index] = index;
+			tail++;
+			to_submit++;
+			next_request++;
+		}
+		if (to_submit == 0) {
+			return;
+		}
+		__atomic_store_n(sq_tail, tail, __ATOMIC_RELEASE);
+		while (to_submit > 0) {
+			auto submitted = syscall(__NR_io_uring_enter, ring_fd, to_submit, 0, 0, nullptr, 0);
+			if (submitted < 0) {
+				if (errno == EINTR) {
+					continue;
+				}
+				throw IOException("Could not submit reads for file \"%s\": %s", {{"errno", std::to_string(errno)}},
+				                  handle.path, strerror(errno));
+			}
+			to_submit -= static_cast<unsigned>(submitted);
+			in_flight += static_cast<idx_t>(submitted);
+		}
+	}
+
+	void Wait() override {
+		Submit();
+		while (in_flight > 0) {
+			WaitForCompletions();
+			Submit();
+		}
+		// finish any reads that failed or were short with pread - this also throws the appropriate error
+		for (auto &request_idx : incomplete_requests) {
+			auto &request = requests[request_idx];
+			handle.Read(request.buffer, request.nr_bytes, request.location);
+		}
+		incomplete_requests.clear();
+	}
+
+private:
+	void WaitForCompletions() {
+		auto result = syscall(__NR_io_uring_enter, ring_fd, 0, 1, IORING_ENTER_GETEVENTS, nullptr, 0);
+		if (result < 0 && errno != EINTR) {
+			throw IOException("Could not wait for reads of file \"%s\": %s", {{"errno", std::to_string(errno)}},
+			                  handle.path, strerror(errno));
+		}
+		unsigned head = *cq_head;
+		while (head != __atomic_load_n(cq_tail, __ATOMIC_ACQUIRE)) {
+			auto &cqe = cqes[head & *cq_mask];
+			auto request_idx = NumericCast<idx_t>(cqe.user_data);
+			auto &request = requests[request_idx];
+			auto bytes_read = cqe.res < 0 ? 0 : NumericCast<idx_t>(cqe.res);
+			if (bytes_read < request.nr_bytes) {
+				request.buffer += bytes_read;
+				request.nr_bytes -= bytes_read;
+				request.location += bytes_read;
+				incomplete_requests.push_back(request_idx);
+			}
+			head++;
+			in_flight--;
+		}
+		__atomic_store_n(cq_head, head, __ATOMIC_RELEASE);
+	}
+
+	void Close() {
+		if (sqes != MAP_FAILED) {
+			munmap(sqes, sqes_size);
+		}
+		if (cq_ring != MAP_FAILED && cq_ring != sq_ring) {
+			munmap(cq_ring, cq_ring_size);
+		}
+		if (sq_ring != MAP_FAILED) {
+			munmap(sq_ring, sq_ring_size);
+		}
+		if (ring_fd >= 0) {
+			close(ring_fd);
+		}
+	}
+
+private:
+	FileHandle &handle;
+	int fd;
+	vector<FileReadRequest> requests;
+	vector<struct iovec> iovecs;
+	//! The index of the next request to submit
+	idx_t next_request = 0;
+	//! The amount of submitted reads that have not completed yet
+	idx_t in_flight = 0;
+	//! The maximum amount of reads that can be in flight
+	idx_t max_in_flight = 0;
+	//! Requests that failed or that were not read completely
+	vector<idx_t> incomplete_requests;
+
+	int ring_fd = -1;
+	void *sq_ring = MAP_FAILED;
+	size_t sq_ring_size = 0;
+	void *cq_ring = MAP_FAILED;
+	size_t cq_ring_size = 0;
+	void *sqes = MAP_FAILED;
+	size_t sqes_size = 0;
+	unsigned *sq_tail = nullptr;
+	unsigned *sq_mask = nullptr;
+	unsigned *sq_array = nullptr;
+	unsigned *cq_head = nullptr;
+	unsigned *cq_tail = nullptr;
+	unsigned *cq_mask = nullptr;
+	io_uring_cqe *cqes = nullptr;
+};
+
+static bool IOUringSupported() {
+	// io_uring can be unavailable even if the headers exist (old kernels, or disabled through e.g. seccomp)
+	static const bool supported = []() {
+		io_uring_params params;
+		memset(&params, 0, sizeof(params));
+		auto ring_fd = static_cast<int>(syscall(__NR_io_uring_setup, 1, &params));
+		if (ring_fd < 0) {
+			return false;
+		}
+		close(ring_fd);
+		return true;
+	}();
+	return supported;
+}
+#endif
+
+unique_ptr<PendingFileReads> LocalFileSystem::SubmitReads(FileHandle &handle, vector<FileReadRequest> requests) {
+#ifdef DUCKDB_IO_URING
+	if (requests.size() > 1 && IOUringSupported()) {
+		auto reads = make_uniq<IOUringReads>(handle, requests);
+		if (reads->Initialize()) {
+			reads->Submit();
+			return std::move(reads);
+		}
+		// setting up the ring failed (e.g. because we are out of locked memory): fall back to pread
+	}
+#endif
+	return FileSystem::SubmitReads(handle, std::move(requests));
+}
+
+bool LocalFileSystem::SupportsAsyncReads(FileHandle &handle) {
+#ifdef DUCKDB_IO_URING
+	return IOUringSupported();
+#else
+	return false;
+#endif
+}
+
 void LocalFileSystem::Write(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location) {
 	int fd = handle.Cast<UnixFileHandle>().fd;
 	auto write_buffer = char_ptr_cast(buffer);
@@ -899,6 +1149,14 @@ void LocalFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes, i
 	}
 }
 
+unique_ptr<PendingFileReads> LocalFileSystem::SubmitReads(FileHandle &handle, vector<FileReadRequest> requests) {
+	return FileSystem::SubmitReads(handle, std::move(requests));
+}
+
+bool LocalFileSystem::SupportsAsyncReads(FileHandle &handle) {
+	return false;
+}
+
 int64_t LocalFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes) {
 	HANDLE hFile = handle.Cast<WindowsFileHandle>().fd;
 	auto &pos = handle.Cast<WindowsFileHandle>().position;
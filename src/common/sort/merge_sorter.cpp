@@ -2,6 +2,9 @@
 #include "duckdb/common/sort/comparators.hpp"
 #include "duckdb/common/sort/sort.hpp"
 
+#include <algorithm>
+#include <numeric>
+
 namespace duckdb {
 
 MergeSorter::MergeSorter(GlobalSortState &state, BufferManager &buffer_manager)
@@ -11,8 +14,8 @@ MergeSorter::MergeSorter(GlobalSortState &state, BufferManager &buffer_manager)
 void MergeSorter::PerformInMergeRound() {
 	while (true) {
 		{
-			lock_guard<mutex> pair_guard(state.lock);
-			if (state.pair_idx == state.num_pairs) {
+			lock_guard<mutex> group_guard(state.lock);
+			if (state.group_idx == state.num_groups) {
 				break;
 			}
 			GetNextPartition();
@@ -21,127 +24,154 @@ void MergeSorter::PerformInMergeRound() {
 	}
 }
 
-void MergeSorter::MergePartition() {
-	auto &left_block = *left->sb;
-	auto &right_block = *right->sb;
-#ifdef DEBUG
-	D_ASSERT(left_block.radix_sorting_data.size() == left_block.payload_data->data_blocks.size());
-	D_ASSERT(right_block.radix_sorting_data.size() == right_block.payload_data->data_blocks.size());
-	if (!state.payload_layout.AllConstant() && state.external) {
-		D_ASSERT(left_block.payload_data->data_blocks.size() == left_block.payload_data->heap_blocks.size());
-		D_ASSERT(right_block.payload_data->data_blocks.size() == right_block.payload_data->heap_blocks.size());
+void MergeSorter::GetNextPartition() {
+	// Create result block
+	state.sorted_blocks_temp[state.group_idx].push_back(make_uniq<SortedBlock>(buffer_manager, state));
+	result = state.sorted_blocks_temp[state.group_idx].back().get();
+	// Determine which blocks must be merged
+	const auto group_begin = state.group_idx * state.merge_fan_in;
+	const auto group_end = MinValue(group_begin + state.merge_fan_in, state.sorted_blocks.size());
+	const auto run_count = group_end - group_begin;
+	D_ASSERT(run_count >= 2);
+	if (state.run_starts.empty()) {
+		state.run_starts.resize(run_count, 0);
 	}
-	if (!sort_layout.all_constant) {
-		D_ASSERT(left_block.radix_sorting_data.size() == left_block.blob_sorting_data->data_blocks.size());
-		D_ASSERT(right_block.radix_sorting_data.size() == right_block.blob_sorting_data->data_blocks.size());
-		if (state.external) {
-			D_ASSERT(left_block.blob_sorting_data->data_blocks.size() ==
-			         left_block.blob_sorting_data->heap_blocks.size());
-			D_ASSERT(right_block.blob_sorting_data->data_blocks.size() ==
-			         right_block.blob_sorting_data->heap_blocks.size());
+	// Initialize the readers used to search the runs
+	searchers.clear();
+	idx_t group_count = 0;
+	for (idx_t run_idx = 0; run_idx < run_count; run_idx++) {
+		auto &run = *state.sorted_blocks[group_begin + run_idx];
+		searchers.push_back(make_uniq<SBScanState>(buffer_manager, state));
+		searchers.back()->sb = &run;
+		group_count += run.Count();
+	}
+	// Compute the work that this thread must do using Merge Path
+	auto splits = state.run_starts;
+	const auto partition_end = MinValue(state.group_start + state.block_capacity, group_count);
+	if (partition_end < group_count) {
+		ComputeSplits(partition_end, splits);
+	} else {
+		for (idx_t run_idx = 0; run_idx < run_count; run_idx++) {
+			splits[run_idx] = searchers[run_idx]->sb->Count();
 		}
 	}
-#endif
-	// Set up the write block
-	// Each merge task produces a SortedBlock with exactly state.block_capacity rows or less
-	result->InitializeWrite();
-	// Initialize arrays to store merge data
-	bool left_smaller[STANDARD_VECTOR_SIZE];
-	idx_t next_entry_sizes[STANDARD_VECTOR_SIZE];
-	// Merge loop
-#ifdef DEBUG
-	auto l_count = left->Remaining();
-	auto r_count = right->Remaining();
-#endif
+	searchers.clear();
+	// Create slices of the data that this thread must merge
+	runs.clear();
+	inputs.clear();
+	for (idx_t run_idx = 0; run_idx < run_count; run_idx++) {
+		auto &run = *state.sorted_blocks[group_begin + run_idx];
+		runs.push_back(make_uniq<SBScanState>(buffer_manager, state));
+		auto &reader = *runs.back();
+		reader.SetIndices(0, 0);
+		inputs.push_back(run.CreateSlice(state.run_starts[run_idx], splits[run_idx], reader.entry_idx));
+		reader.sb = inputs.back().get();
+	}
+	state.run_starts = std::move(splits);
+	state.group_start = partition_end;
+	// Update global state
+	if (state.group_start == group_count) {
+		// Delete references to the previous group
+		for (idx_t run_idx = 0; run_idx < run_count; run_idx++) {
+			state.sorted_blocks[group_begin + run_idx] = nullptr;
+		}
+		// Advance group
+		state.group_idx++;
+		state.group_start = 0;
+		state.run_starts.clear();
+	}
+}
+
+void MergeSorter::ComputeSplits(const idx_t diagonal, vector<idx_t> &splits) {
+	const auto run_count = searchers.size();
+	// The split point of each run lies between the split point of the earlier diagonal and the end of the run
+	vector<idx_t> lower = splits;
+	vector<idx_t> upper(run_count);
+	for (idx_t run_idx = 0; run_idx < run_count; run_idx++) {
+		upper[run_idx] = searchers[run_idx]->sb->Count();
+	}
+	vector<idx_t> candidates;
+	vector<idx_t> positions(run_count);
 	while (true) {
-		auto l_remaining = left->Remaining();
-		auto r_remaining = right->Remaining();
-		if (l_remaining + r_remaining == 0) {
-			// Done
+		// Collect the runs for which the split point is not known yet
+		candidates.clear();
+		idx_t total_weight = 0;
+		for (idx_t run_idx = 0; run_idx < run_count; run_idx++) {
+			if (lower[run_idx] < upper[run_idx]) {
+				candidates.push_back(run_idx);
+				total_weight += upper[run_idx] - lower[run_idx];
+			}
+		}
+		if (candidates.empty()) {
 			break;
 		}
-		const idx_t next = MinValue(l_remaining + r_remaining, (idx_t)STANDARD_VECTOR_SIZE);
-		if (l_remaining != 0 && r_remaining != 0) {
-			// Compute the merge (not needed if one side is exhausted)
-			ComputeMerge(next, left_smaller);
+		// Use the weighted median of the medians of the remaining ranges as the pivot
+		// This guarantees that at least a quarter of the remaining rows is eliminated in every iteration
+		std::sort(candidates.begin(), candidates.end(), [&](const idx_t &l_run_idx, const idx_t &r_run_idx) {
+			return LessThanUsingGlobalIndex(l_run_idx, (lower[l_run_idx] + upper[l_run_idx]) / 2, r_run_idx,
+			                                (lower[r_run_idx] + upper[r_run_idx]) / 2);
+		});
+		idx_t pivot_run_idx = candidates.back();
+		idx_t weight = 0;
+		for (const auto &run_idx : candidates) {
+			weight += upper[run_idx] - lower[run_idx];
+			if (2 * weight >= total_weight) {
+				pivot_run_idx = run_idx;
+				break;
+			}
 		}
-		// Actually merge the data (radix, blob, and payload)
-		MergeRadix(next, left_smaller);
-		if (!sort_layout.all_constant) {
-			MergeData(*result->blob_sorting_data, *left_block.blob_sorting_data, *right_block.blob_sorting_data, next,
-			          left_smaller, next_entry_sizes, true);
-			D_ASSERT(result->radix_sorting_data.size() == result->blob_sorting_data->data_blocks.size());
+		const auto pivot_idx = (lower[pivot_run_idx] + upper[pivot_run_idx]) / 2;
+		// Count the rows that sort before the pivot
+		idx_t rank = 0;
+		for (idx_t run_idx = 0; run_idx < run_count; run_idx++) {
+			positions[run_idx] = run_idx == pivot_run_idx ? pivot_idx : CountSmaller(run_idx, pivot_run_idx, pivot_idx);
+			rank += positions[run_idx];
+		}
+		if (rank == diagonal) {
+			// Found the split points
+			lower = positions;
+			break;
+		}
+		if (rank < diagonal) {
+			// The pivot and all rows before it come before the split points
+			for (idx_t run_idx = 0; run_idx < run_count; run_idx++) {
+				lower[run_idx] = MaxValue(lower[run_idx], positions[run_idx]);
+			}
+			lower[pivot_run_idx] = MaxValue(lower[pivot_run_idx], pivot_idx + 1);
+		} else {
+			// The pivot and all rows after it come after the split points
+			for (idx_t run_idx = 0; run_idx < run_count; run_idx++) {
+				upper[run_idx] = MinValue(upper[run_idx], positions[run_idx]);
+			}
 		}
-		MergeData(*result->payload_data, *left_block.payload_data, *right_block.payload_data, next, left_smaller,
-		          next_entry_sizes, false);
-		D_ASSERT(result->radix_sorting_data.size() == result->payload_data->data_blocks.size());
 	}
-#ifdef DEBUG
-	D_ASSERT(result->Count() == l_count + r_count);
-#endif
+	D_ASSERT(std::accumulate(lower.begin(), lower.end(), idx_t(0)) == diagonal);
+	splits = std::move(lower);
 }
 
-void MergeSorter::GetNextPartition() {
-	// Create result block
-	state.sorted_blocks_temp[state.pair_idx].push_back(make_uniq<SortedBlock>(buffer_manager, state));
-	result = state.sorted_blocks_temp[state.pair_idx].back().get();
-	// Determine which blocks must be merged
-	auto &left_block = *state.sorted_blocks[state.pair_idx * 2];
-	auto &right_block = *state.sorted_blocks[state.pair_idx * 2 + 1];
-	const idx_t l_count = left_block.Count();
-	const idx_t r_count = right_block.Count();
-	// Initialize left and right reader
-	left = make_uniq<SBScanState>(buffer_manager, state);
-	right = make_uniq<SBScanState>(buffer_manager, state);
-	// Compute the work that this thread must do using Merge Path
-	idx_t l_end;
-	idx_t r_end;
-	if (state.l_start + state.r_start + state.block_capacity < l_count + r_count) {
-		left->sb = state.sorted_blocks[state.pair_idx * 2].get();
-		right->sb = state.sorted_blocks[state.pair_idx * 2 + 1].get();
-		const idx_t intersection = state.l_start + state.r_start + state.block_capacity;
-		GetIntersection(intersection, l_end, r_end);
-		D_ASSERT(l_end <= l_count);
-		D_ASSERT(r_end <= r_count);
-		D_ASSERT(intersection == l_end + r_end);
-	} else {
-		l_end = l_count;
-		r_end = r_count;
-	}
-	// Create slices of the data that this thread must merge
-	left->SetIndices(0, 0);
-	right->SetIndices(0, 0);
-	left_input = left_block.CreateSlice(state.l_start, l_end, left->entry_idx);
-	right_input = right_block.CreateSlice(state.r_start, r_end, right->entry_idx);
-	left->sb = left_input.get();
-	right->sb = right_input.get();
-	state.l_start = l_end;
-	state.r_start = r_end;
-	D_ASSERT(left->Remaining() + right->Remaining() == state.block_capacity || (l_end == l_count && r_end == r_count));
-	// Update global state
-	if (state.l_start == l_count && state.r_start == r_count) {
-		// Delete references to previous pair
-		state.sorted_blocks[state.pair_idx * 2] = nullptr;
-		state.sorted_blocks[state.pair_idx * 2 + 1] = nullptr;
-		// Advance pair
-		state.pair_idx++;
-		state.l_start = 0;
-		state.r_start = 0;
+idx_t MergeSorter::CountSmaller(const idx_t run_idx, const idx_t pivot_run_idx, const idx_t pivot_idx) {
+	// The rows before the previous split point are all smaller than the pivot
+	idx_t lower = state.run_starts[run_idx];
+	idx_t upper = searchers[run_idx]->sb->Count();
+	while (lower < upper) {
+		const auto middle = lower + (upper - lower) / 2;
+		if (LessThanUsingGlobalIndex(run_idx, middle, pivot_run_idx, pivot_idx)) {
+			lower = middle + 1;
+		} else {
+			upper = middle;
+		}
 	}
+	return lower;
 }
 
-int MergeSorter::CompareUsingGlobalIndex(SBScanState &l, SBScanState &r, const idx_t l_idx, const idx_t r_idx) {
+bool MergeSorter::LessThanUsingGlobalIndex(const idx_t l_run_idx, const idx_t l_idx, const idx_t r_run_idx,
+                                           const idx_t r_idx) {
+	D_ASSERT(l_run_idx != r_run_idx);
+	auto &l = *searchers[l_run_idx];
+	auto &r = *searchers[r_run_idx];
 	D_ASSERT(l_idx < l.sb->Count());
 	D_ASSERT(r_idx < r.sb->Count());
 
-	// Easy comparison using the previous result (intersections must increase monotonically)
-	if (l_idx < state.l_start) {
-		return -1;
-	}
-	if (r_idx < state.r_start) {
-		return 1;
-	}
-
 	l.sb->GlobalToLocalIndex(l_idx, l.block_idx, l.entry_idx);
 	r.sb->GlobalToLocalIndex(r_idx, r.block_idx, r.entry_idx);
 
@@ -158,506 +188,167 @@ int MergeSorter::CompareUsingGlobalIndex(SBScanState &l, SBScanState &r, const i
 		r.PinData(*r.sb->blob_sorting_data);
 		comp_res = Comparators::CompareTuple(l, r, l_ptr, r_ptr, sort_layout, state.external);
 	}
-	return comp_res;
+	return comp_res < 0 || (comp_res == 0 && l_run_idx < r_run_idx);
 }
 
-void MergeSorter::GetIntersection(const idx_t diagonal, idx_t &l_idx, idx_t &r_idx) {
-	const idx_t l_count = left->sb->Count();
-	const idx_t r_count = right->sb->Count();
-	// Cover some edge cases
-	// Code coverage off because these edge cases cannot happen unless other code changes
-	// Edge cases have been tested extensively while developing Merge Path in a script
-	// LCOV_EXCL_START
-	if (diagonal >= l_count + r_count) {
-		l_idx = l_count;
-		r_idx = r_count;
-		return;
-	} else if (diagonal == 0) {
-		l_idx = 0;
-		r_idx = 0;
-		return;
-	} else if (l_count == 0) {
-		l_idx = 0;
-		r_idx = diagonal;
-		return;
-	} else if (r_count == 0) {
-		r_idx = 0;
-		l_idx = diagonal;
-		return;
-	}
-	// LCOV_EXCL_STOP
-	// Determine offsets for the binary search
-	const idx_t l_offset = MinValue(l_count, diagonal);
-	const idx_t r_offset = diagonal > l_count ? diagonal - l_count : 0;
-	D_ASSERT(l_offset + r_offset == diagonal);
-	const idx_t search_space = diagonal > MaxValue(l_count, r_count) ? l_count + r_count - diagonal
-	                                                                 : MinValue(diagonal, MinValue(l_count, r_count));
-	// Double binary search
-	idx_t li = 0;
-	idx_t ri = search_space - 1;
-	idx_t middle;
-	int comp_res;
-	while (li <= ri) {
-		middle = (li + ri) / 2;
-		l_idx = l_offset - middle;
-		r_idx = r_offset + middle;
-		if (l_idx == l_count || r_idx == 0) {
-			comp_res = CompareUsingGlobalIndex(*left, *right, l_idx - 1, r_idx);
-			if (comp_res > 0) {
-				l_idx--;
-				r_idx++;
-			} else {
-				return;
-			}
-			if (l_idx == 0 || r_idx == r_count) {
-				// This case is incredibly difficult to cover as it is dependent on parallelism randomness
-				// But it has been tested extensively during development in a script
-				// LCOV_EXCL_START
-				return;
-				// LCOV_EXCL_STOP
-			} else {
-				break;
-			}
+//! Appends rows (and their heap data, if the rows are swizzled) to the last block of SortedData
+struct MergeSortedDataWriter {
+	MergeSortedDataWriter(BufferManager &buffer_manager_p, SortedData &target, bool external)
+	    : buffer_manager(buffer_manager_p), row_width(target.layout.GetRowWidth()),
+	      heap_pointer_offset(target.layout.GetHeapOffset()), copy_heap(!target.layout.AllConstant() && external),
+	      data_block(*target.data_blocks.back()) {
+		data_handle = buffer_manager.Pin(data_block.block);
+		data_ptr = data_handle.Ptr() + data_block.count * row_width;
+		if (copy_heap) {
+			heap_block = target.heap_blocks.back().get();
+			heap_handle = buffer_manager.Pin(heap_block->block);
 		}
-		comp_res = CompareUsingGlobalIndex(*left, *right, l_idx, r_idx);
-		if (comp_res > 0) {
-			li = middle + 1;
-		} else {
-			ri = middle - 1;
-		}
-	}
-	int l_r_min1 = CompareUsingGlobalIndex(*left, *right, l_idx, r_idx - 1);
-	int l_min1_r = CompareUsingGlobalIndex(*left, *right, l_idx - 1, r_idx);
-	if (l_r_min1 > 0 && l_min1_r < 0) {
-		return;
-	} else if (l_r_min1 > 0) {
-		l_idx--;
-		r_idx++;
-	} else if (l_min1_r < 0) {
-		l_idx++;
-		r_idx--;
 	}
-}
-
-void MergeSorter::ComputeMerge(const idx_t &count, bool left_smaller[]) {
-	auto &l = *left;
-	auto &r = *right;
-	auto &l_sorted_block = *l.sb;
-	auto &r_sorted_block = *r.sb;
-	// Save indices to restore afterwards
-	idx_t l_block_idx_before = l.block_idx;
-	idx_t l_entry_idx_before = l.entry_idx;
-	idx_t r_block_idx_before = r.block_idx;
-	idx_t r_entry_idx_before = r.entry_idx;
-	// Data pointers for both sides
-	data_ptr_t l_radix_ptr;
-	data_ptr_t r_radix_ptr;
-	// Compute the merge of the next 'count' tuples
-	idx_t compared = 0;
-	while (compared < count) {
-		// Move to the next block (if needed)
-		if (l.block_idx < l_sorted_block.radix_sorting_data.size() &&
-		    l.entry_idx == l_sorted_block.radix_sorting_data[l.block_idx]->count) {
-			l.block_idx++;
-			l.entry_idx = 0;
-		}
-		if (r.block_idx < r_sorted_block.radix_sorting_data.size() &&
-		    r.entry_idx == r_sorted_block.radix_sorting_data[r.block_idx]->count) {
-			r.block_idx++;
-			r.entry_idx = 0;
-		}
-		const bool l_done = l.block_idx == l_sorted_block.radix_sorting_data.size();
-		const bool r_done = r.block_idx == r_sorted_block.radix_sorting_data.size();
-		if (l_done || r_done) {
-			// One of the sides is exhausted, no need to compare
-			break;
-		}
-		// Pin the radix sorting data
-		left->PinRadix(l.block_idx);
-		l_radix_ptr = left->RadixPtr();
-		right->PinRadix(r.block_idx);
-		r_radix_ptr = right->RadixPtr();
 
-		const idx_t l_count = l_sorted_block.radix_sorting_data[l.block_idx]->count;
-		const idx_t r_count = r_sorted_block.radix_sorting_data[r.block_idx]->count;
-		// Compute the merge
-		if (sort_layout.all_constant) {
-			// All sorting columns are constant size
-			for (; compared < count && l.entry_idx < l_count && r.entry_idx < r_count; compared++) {
-				left_smaller[compared] = FastMemcmp(l_radix_ptr, r_radix_ptr, sort_layout.comparison_size) < 0;
-				const bool &l_smaller = left_smaller[compared];
-				const bool r_smaller = !l_smaller;
-				// Use comparison bool (0 or 1) to increment entries and pointers
-				l.entry_idx += l_smaller;
-				r.entry_idx += r_smaller;
-				l_radix_ptr += l_smaller * sort_layout.entry_size;
-				r_radix_ptr += r_smaller * sort_layout.entry_size;
-			}
-		} else {
-			// Pin the blob data
-			left->PinData(*l_sorted_block.blob_sorting_data);
-			right->PinData(*r_sorted_block.blob_sorting_data);
-			// Merge with variable size sorting columns
-			for (; compared < count && l.entry_idx < l_count && r.entry_idx < r_count; compared++) {
-				left_smaller[compared] =
-				    Comparators::CompareTuple(*left, *right, l_radix_ptr, r_radix_ptr, sort_layout, state.external) < 0;
-				const bool &l_smaller = left_smaller[compared];
-				const bool r_smaller = !l_smaller;
-				// Use comparison bool (0 or 1) to increment entries and pointers
-				l.entry_idx += l_smaller;
-				r.entry_idx += r_smaller;
-				l_radix_ptr += l_smaller * sort_layout.entry_size;
-				r_radix_ptr += r_smaller * sort_layout.entry_size;
+	void Append(const SBScanState &source, SortedData &source_data) {
+		D_ASSERT(data_block.count < data_block.capacity);
+		FastMemcpy(data_ptr, source.DataPtr(source_data), row_width);
+		if (copy_heap) {
+			// Copy the heap entry of the row, and point the row to its new location in the heap
+			const auto source_heap_ptr = source.HeapPtr(source_data);
+			const auto entry_size = Load<uint32_t>(source_heap_ptr);
+			D_ASSERT(entry_size >= sizeof(uint32_t));
+			if (heap_block->byte_offset + entry_size > heap_block->capacity) {
+				const auto new_capacity = MaxValue(heap_block->byte_offset + entry_size, 2 * heap_block->capacity);
+				buffer_manager.ReAllocate(heap_block->block, new_capacity);
+				heap_block->capacity = new_capacity;
 			}
+			Store<idx_t>(heap_block->byte_offset, data_ptr + heap_pointer_offset);
+			memcpy(heap_handle.Ptr() + heap_block->byte_offset, source_heap_ptr, entry_size);
+			heap_block->byte_offset += entry_size;
+			heap_block->count++;
 		}
+		data_ptr += row_width;
+		data_block.count++;
 	}
-	// Reset block indices
-	left->SetIndices(l_block_idx_before, l_entry_idx_before);
-	right->SetIndices(r_block_idx_before, r_entry_idx_before);
-}
-
-void MergeSorter::MergeRadix(const idx_t &count, const bool left_smaller[]) {
-	auto &l = *left;
-	auto &r = *right;
-	// Save indices to restore afterwards
-	idx_t l_block_idx_before = l.block_idx;
-	idx_t l_entry_idx_before = l.entry_idx;
-	idx_t r_block_idx_before = r.block_idx;
-	idx_t r_entry_idx_before = r.entry_idx;
 
-	auto &l_blocks = l.sb->radix_sorting_data;
-	auto &r_blocks = r.sb->radix_sorting_data;
-	RowDataBlock *l_block = nullptr;
-	RowDataBlock *r_block = nullptr;
+	BufferManager &buffer_manager;
+	const idx_t row_width;
+	const idx_t heap_pointer_offset;
+	const bool copy_heap;
 
-	data_ptr_t l_ptr;
-	data_ptr_t r_ptr;
+	RowDataBlock &data_block;
+	BufferHandle data_handle;
+	data_ptr_t data_ptr;
 
-	RowDataBlock *result_block = result->radix_sorting_data.back().get();
-	auto result_handle = buffer_manager.Pin(result_block->block);
-	data_ptr_t result_ptr = result_handle.Ptr() + result_block->count * sort_layout.entry_size;
+	RowDataBlock *heap_block = nullptr;
+	BufferHandle heap_handle;
+};
 
-	idx_t copied = 0;
-	while (copied < count) {
-		// Move to the next block (if needed)
-		if (l.block_idx < l_blocks.size() && l.entry_idx == l_blocks[l.block_idx]->count) {
-			// Delete reference to previous block
-			l_blocks[l.block_idx]->block = nullptr;
-			// Advance block
-			l.block_idx++;
-			l.entry_idx = 0;
-		}
-		if (r.block_idx < r_blocks.size() && r.entry_idx == r_blocks[r.block_idx]->count) {
-			// Delete reference to previous block
-			r_blocks[r.block_idx]->block = nullptr;
-			// Advance block
-			r.block_idx++;
-			r.entry_idx = 0;
-		}
-		const bool l_done = l.block_idx == l_blocks.size();
-		const bool r_done = r.block_idx == r_blocks.size();
-		// Pin the radix sortable blocks
-		idx_t l_count;
-		if (!l_done) {
-			l_block = l_blocks[l.block_idx].get();
-			left->PinRadix(l.block_idx);
-			l_ptr = l.RadixPtr();
-			l_count = l_block->count;
-		} else {
-			l_count = 0;
-		}
-		idx_t r_count;
-		if (!r_done) {
-			r_block = r_blocks[r.block_idx].get();
-			r.PinRadix(r.block_idx);
-			r_ptr = r.RadixPtr();
-			r_count = r_block->count;
-		} else {
-			r_count = 0;
-		}
-		// Copy using computed merge
-		if (!l_done && !r_done) {
-			// Both sides have data - merge
-			MergeRows(l_ptr, l.entry_idx, l_count, r_ptr, r.entry_idx, r_count, *result_block, result_ptr,
-			          sort_layout.entry_size, left_smaller, copied, count);
-		} else if (r_done) {
-			// Right side is exhausted
-			FlushRows(l_ptr, l.entry_idx, l_count, *result_block, result_ptr, sort_layout.entry_size, copied, count);
-		} else {
-			// Left side is exhausted
-			FlushRows(r_ptr, r.entry_idx, r_count, *result_block, result_ptr, sort_layout.entry_size, copied, count);
+void MergeSorter::MergePartition() {
+#ifdef DEBUG
+	idx_t input_count = 0;
+	for (auto &input : inputs) {
+		D_ASSERT(input->radix_sorting_data.size() == input->payload_data->data_blocks.size());
+		if (!sort_layout.all_constant) {
+			D_ASSERT(input->radix_sorting_data.size() == input->blob_sorting_data->data_blocks.size());
 		}
+		input_count += input->Count();
 	}
-	// Reset block indices
-	left->SetIndices(l_block_idx_before, l_entry_idx_before);
-	right->SetIndices(r_block_idx_before, r_entry_idx_before);
-}
-
-void MergeSorter::MergeData(SortedData &result_data, SortedData &l_data, SortedData &r_data, const idx_t &count,
-                            const bool left_smaller[], idx_t next_entry_sizes[], bool reset_indices) {
-	auto &l = *left;
-	auto &r = *right;
-	// Save indices to restore afterwards
-	idx_t l_block_idx_before = l.block_idx;
-	idx_t l_entry_idx_before = l.entry_idx;
-	idx_t r_block_idx_before = r.block_idx;
-	idx_t r_entry_idx_before = r.entry_idx;
-
-	const auto &layout = result_data.layout;
-	const idx_t row_width = layout.GetRowWidth();
-	const idx_t heap_pointer_offset = layout.GetHeapOffset();
-
-	// Left and right row data to merge
-	data_ptr_t l_ptr;
-	data_ptr_t r_ptr;
-	// Accompanying left and right heap data (if needed)
-	data_ptr_t l_heap_ptr;
-	data_ptr_t r_heap_ptr;
-
-	// Result rows to write to
-	RowDataBlock *result_data_block = result_data.data_blocks.back().get();
-	auto result_data_handle = buffer_manager.Pin(result_data_block->block);
-	data_ptr_t result_data_ptr = result_data_handle.Ptr() + result_data_block->count * row_width;
-	// Result heap to write to (if needed)
-	RowDataBlock *result_heap_block = nullptr;
-	BufferHandle result_heap_handle;
-	data_ptr_t result_heap_ptr;
-	if (!layout.AllConstant() && state.external) {
-		result_heap_block = result_data.heap_blocks.back().get();
-		result_heap_handle = buffer_manager.Pin(result_heap_block->block);
-		result_heap_ptr = result_heap_handle.Ptr() + result_heap_block->byte_offset;
+	D_ASSERT(input_count <= state.block_capacity);
+#endif
+	// Set up the write block
+	// Each merge task produces a SortedBlock with exactly state.block_capacity rows or less
+	result->InitializeWrite();
+	auto &radix_block = *result->radix_sorting_data.back();
+	auto radix_handle = buffer_manager.Pin(radix_block.block);
+	auto radix_ptr = radix_handle.Ptr();
+	unique_ptr<MergeSortedDataWriter> blob_writer;
+	if (!sort_layout.all_constant) {
+		blob_writer = make_uniq<MergeSortedDataWriter>(buffer_manager, *result->blob_sorting_data, state.external);
 	}
+	MergeSortedDataWriter payload_writer(buffer_manager, *result->payload_data, state.external);
 
-	idx_t copied = 0;
-	while (copied < count) {
-		// Move to new data blocks (if needed)
-		if (l.block_idx < l_data.data_blocks.size() && l.entry_idx == l_data.data_blocks[l.block_idx]->count) {
-			// Delete reference to previous block
-			l_data.data_blocks[l.block_idx]->block = nullptr;
-			if (!layout.AllConstant() && state.external) {
-				l_data.heap_blocks[l.block_idx]->block = nullptr;
-			}
-			// Advance block
-			l.block_idx++;
-			l.entry_idx = 0;
-		}
-		if (r.block_idx < r_data.data_blocks.size() && r.entry_idx == r_data.data_blocks[r.block_idx]->count) {
-			// Delete reference to previous block
-			r_data.data_blocks[r.block_idx]->block = nullptr;
-			if (!layout.AllConstant() && state.external) {
-				r_data.heap_blocks[r.block_idx]->block = nullptr;
-			}
-			// Advance block
-			r.block_idx++;
-			r.entry_idx = 0;
-		}
-		const bool l_done = l.block_idx == l_data.data_blocks.size();
-		const bool r_done = r.block_idx == r_data.data_blocks.size();
-		// Pin the row data blocks
-		if (!l_done) {
-			l.PinData(l_data);
-			l_ptr = l.DataPtr(l_data);
+	// Initialize the heap with the runs that have rows
+	heap.clear();
+	for (idx_t run_idx = 0; run_idx < runs.size(); run_idx++) {
+		auto &run = *runs[run_idx];
+		if (run.Remaining() == 0) {
+			continue;
 		}
-		if (!r_done) {
-			r.PinData(r_data);
-			r_ptr = r.DataPtr(r_data);
+		PinRun(run);
+		heap.push_back(run_idx);
+	}
+	for (idx_t heap_idx = heap.size() / 2; heap_idx > 0; heap_idx--) {
+		SiftDown(heap_idx - 1);
+	}
+
+	// Merge loop: repeatedly copy the smallest row to the result
+	while (!heap.empty()) {
+		auto &run = *runs[heap[0]];
+		auto &input = *run.sb;
+		FastMemcpy(radix_ptr, run.RadixPtr(), sort_layout.entry_size);
+		radix_ptr += sort_layout.entry_size;
+		radix_block.count++;
+		if (!sort_layout.all_constant) {
+			blob_writer->Append(run, *input.blob_sorting_data);
 		}
-		const idx_t &l_count = !l_done ? l_data.data_blocks[l.block_idx]->count : 0;
-		const idx_t &r_count = !r_done ? r_data.data_blocks[r.block_idx]->count : 0;
-		// Perform the merge
-		if (layout.AllConstant() || !state.external) {
-			// If all constant size, or if we are doing an in-memory sort, we do not need to touch the heap
-			if (!l_done && !r_done) {
-				// Both sides have data - merge
-				MergeRows(l_ptr, l.entry_idx, l_count, r_ptr, r.entry_idx, r_count, *result_data_block, result_data_ptr,
-				          row_width, left_smaller, copied, count);
-			} else if (r_done) {
-				// Right side is exhausted
-				FlushRows(l_ptr, l.entry_idx, l_count, *result_data_block, result_data_ptr, row_width, copied, count);
-			} else {
-				// Left side is exhausted
-				FlushRows(r_ptr, r.entry_idx, r_count, *result_data_block, result_data_ptr, row_width, copied, count);
-			}
-		} else {
-			// External sorting with variable size data. Pin the heap blocks too
-			if (!l_done) {
-				l_heap_ptr = l.BaseHeapPtr(l_data) + Load<idx_t>(l_ptr + heap_pointer_offset);
-				D_ASSERT(l_heap_ptr - l.BaseHeapPtr(l_data) >= 0);
-				D_ASSERT((idx_t)(l_heap_ptr - l.BaseHeapPtr(l_data)) < l_data.heap_blocks[l.block_idx]->byte_offset);
-			}
-			if (!r_done) {
-				r_heap_ptr = r.BaseHeapPtr(r_data) + Load<idx_t>(r_ptr + heap_pointer_offset);
-				D_ASSERT(r_heap_ptr - r.BaseHeapPtr(r_data) >= 0);
-				D_ASSERT((idx_t)(r_heap_ptr - r.BaseHeapPtr(r_data)) < r_data.heap_blocks[r.block_idx]->byte_offset);
-			}
-			// Both the row and heap data need to be dealt with
-			if (!l_done && !r_done) {
-				// Both sides have data - merge
-				idx_t l_idx_copy = l.entry_idx;
-				idx_t r_idx_copy = r.entry_idx;
-				data_ptr_t result_data_ptr_copy = result_data_ptr;
-				idx_t copied_copy = copied;
-				// Merge row data
-				MergeRows(l_ptr, l_idx_copy, l_count, r_ptr, r_idx_copy, r_count, *result_data_block,
-				          result_data_ptr_copy, row_width, left_smaller, copied_copy, count);
-				const idx_t merged = copied_copy - copied;
-				// Compute the entry sizes and number of heap bytes that will be copied
-				idx_t copy_bytes = 0;
-				data_ptr_t l_heap_ptr_copy = l_heap_ptr;
-				data_ptr_t r_heap_ptr_copy = r_heap_ptr;
-				for (idx_t i = 0; i < merged; i++) {
-					// Store base heap offset in the row data
-					Store<idx_t>(result_heap_block->byte_offset + copy_bytes, result_data_ptr + heap_pointer_offset);
-					result_data_ptr += row_width;
-					// Compute entry size and add to total
-					const bool &l_smaller = left_smaller[copied + i];
-					const bool r_smaller = !l_smaller;
-					auto &entry_size = next_entry_sizes[copied + i];
-					entry_size =
-					    l_smaller * Load<uint32_t>(l_heap_ptr_copy) + r_smaller * Load<uint32_t>(r_heap_ptr_copy);
-					D_ASSERT(entry_size >= sizeof(uint32_t));
-					D_ASSERT(NumericCast<idx_t>(l_heap_ptr_copy - l.BaseHeapPtr(l_data)) + l_smaller * entry_size <=
-					         l_data.heap_blocks[l.block_idx]->byte_offset);
-					D_ASSERT(NumericCast<idx_t>(r_heap_ptr_copy - r.BaseHeapPtr(r_data)) + r_smaller * entry_size <=
-					         r_data.heap_blocks[r.block_idx]->byte_offset);
-					l_heap_ptr_copy += l_smaller * entry_size;
-					r_heap_ptr_copy += r_smaller * entry_size;
-					copy_bytes += entry_size;
-				}
-				// Reallocate result heap block size (if needed)
-				if (result_heap_block->byte_offset + copy_bytes > result_heap_block->capacity) {
-					idx_t new_capacity = result_heap_block->byte_offset + copy_bytes;
-					buffer_manager.ReAllocate(result_heap_block->block, new_capacity);
-					result_heap_block->capacity = new_capacity;
-					result_heap_ptr = result_heap_handle.Ptr() + result_heap_block->byte_offset;
-				}
-				D_ASSERT(result_heap_block->byte_offset + copy_bytes <= result_heap_block->capacity);
-				// Now copy the heap data
-				for (idx_t i = 0; i < merged; i++) {
-					const bool &l_smaller = left_smaller[copied + i];
-					const bool r_smaller = !l_smaller;
-					const auto &entry_size = next_entry_sizes[copied + i];
-					memcpy(result_heap_ptr,
-					       reinterpret_cast<data_ptr_t>(l_smaller * CastPointerToValue(l_heap_ptr) +
-					                                    r_smaller * CastPointerToValue(r_heap_ptr)),
-					       entry_size);
-					D_ASSERT(Load<uint32_t>(result_heap_ptr) == entry_size);
-					result_heap_ptr += entry_size;
-					l_heap_ptr += l_smaller * entry_size;
-					r_heap_ptr += r_smaller * entry_size;
-					l.entry_idx += l_smaller;
-					r.entry_idx += r_smaller;
+		payload_writer.Append(run, *input.payload_data);
+
+		// Advance the run, moving to the next block (if needed)
+		if (++run.entry_idx == input.radix_sorting_data[run.block_idx]->count) {
+			run.SetIndices(run.block_idx + 1, 0);
+			if (run.Remaining() == 0) {
+				// The run is exhausted, remove it from the heap
+				heap[0] = heap.back();
+				heap.pop_back();
+				if (heap.empty()) {
+					break;
 				}
-				// Update result indices and pointers
-				result_heap_block->count += merged;
-				result_heap_block->byte_offset += copy_bytes;
-				copied += merged;
-			} else if (r_done) {
-				// Right side is exhausted - flush left
-				FlushBlobs(layout, l_count, l_ptr, l.entry_idx, l_heap_ptr, *result_data_block, result_data_ptr,
-				           *result_heap_block, result_heap_handle, result_heap_ptr, copied, count);
 			} else {
-				// Left side is exhausted - flush right
-				FlushBlobs(layout, r_count, r_ptr, r.entry_idx, r_heap_ptr, *result_data_block, result_data_ptr,
-				           *result_heap_block, result_heap_handle, result_heap_ptr, copied, count);
+				PinRun(run);
 			}
-			D_ASSERT(result_data_block->count == result_heap_block->count);
 		}
+		SiftDown(0);
 	}
-	if (reset_indices) {
-		left->SetIndices(l_block_idx_before, l_entry_idx_before);
-		right->SetIndices(r_block_idx_before, r_entry_idx_before);
-	}
+#ifdef DEBUG
+	D_ASSERT(result->Count() == input_count);
+#endif
 }
 
-void MergeSorter::MergeRows(data_ptr_t &l_ptr, idx_t &l_entry_idx, const idx_t &l_count, data_ptr_t &r_ptr,
-                            idx_t &r_entry_idx, const idx_t &r_count, RowDataBlock &target_block,
-                            data_ptr_t &target_ptr, const idx_t &entry_size, const bool left_smaller[], idx_t &copied,
-                            const idx_t &count) {
-	const idx_t next = MinValue(count - copied, target_block.capacity - target_block.count);
-	idx_t i;
-	for (i = 0; i < next && l_entry_idx < l_count && r_entry_idx < r_count; i++) {
-		const bool &l_smaller = left_smaller[copied + i];
-		const bool r_smaller = !l_smaller;
-		// Use comparison bool (0 or 1) to copy an entry from either side
-		FastMemcpy(
-		    target_ptr,
-		    reinterpret_cast<data_ptr_t>(l_smaller * CastPointerToValue(l_ptr) + r_smaller * CastPointerToValue(r_ptr)),
-		    entry_size);
-		target_ptr += entry_size;
-		// Use the comparison bool to increment entries and pointers
-		l_entry_idx += l_smaller;
-		r_entry_idx += r_smaller;
-		l_ptr += l_smaller * entry_size;
-		r_ptr += r_smaller * entry_size;
+bool MergeSorter::RunLessThan(const idx_t l_run_idx, const idx_t r_run_idx) {
+	auto &l = *runs[l_run_idx];
+	auto &r = *runs[r_run_idx];
+	int comp_res;
+	if (sort_layout.all_constant) {
+		comp_res = FastMemcmp(l.RadixPtr(), r.RadixPtr(), sort_layout.comparison_size);
+	} else {
+		comp_res = Comparators::CompareTuple(l, r, l.RadixPtr(), r.RadixPtr(), sort_layout, state.external);
 	}
-	// Update counts
-	target_block.count += i;
-	copied += i;
+	return comp_res < 0 || (comp_res == 0 && l_run_idx < r_run_idx);
 }
 
-void MergeSorter::FlushRows(data_ptr_t &source_ptr, idx_t &source_entry_idx, const idx_t &source_count,
-                            RowDataBlock &target_block, data_ptr_t &target_ptr, const idx_t &entry_size, idx_t &copied,
-                            const idx_t &count) {
-	// Compute how many entries we can fit
-	idx_t next = MinValue(count - copied, target_block.capacity - target_block.count);
-	next = MinValue(next, source_count - source_entry_idx);
-	// Copy them all in a single memcpy
-	const idx_t copy_bytes = next * entry_size;
-	memcpy(target_ptr, source_ptr, copy_bytes);
-	target_ptr += copy_bytes;
-	source_ptr += copy_bytes;
-	// Update counts
-	source_entry_idx += next;
-	target_block.count += next;
-	copied += next;
+void MergeSorter::SiftDown(idx_t heap_idx) {
+	const auto heap_size = heap.size();
+	while (true) {
+		auto smallest = heap_idx;
+		const auto left_child = 2 * heap_idx + 1;
+		const auto right_child = left_child + 1;
+		if (left_child < heap_size && RunLessThan(heap[left_child], heap[smallest])) {
+			smallest = left_child;
+		}
+		if (right_child < heap_size && RunLessThan(heap[right_child], heap[smallest])) {
+			smallest = right_child;
+		}
+		if (smallest == heap_idx) {
+			return;
+		}
+		std::swap(heap[heap_idx], heap[smallest]);
+		heap_idx = smallest;
+	}
 }
 
-void MergeSorter::FlushBlobs(const RowLayout &layout, const idx_t &source_count, data_ptr_t &source_data_ptr,
-                             idx_t &source_entry_idx, data_ptr_t &source_heap_ptr, RowDataBlock &target_data_block,
-                             data_ptr_t &target_data_ptr, RowDataBlock &target_heap_block,
-                             BufferHandle &target_heap_handle, data_ptr_t &target_heap_ptr, idx_t &copied,
-                             const idx_t &count) {
-	const idx_t row_width = layout.GetRowWidth();
-	const idx_t heap_pointer_offset = layout.GetHeapOffset();
-	idx_t source_entry_idx_copy = source_entry_idx;
-	data_ptr_t target_data_ptr_copy = target_data_ptr;
-	idx_t copied_copy = copied;
-	// Flush row data
-	FlushRows(source_data_ptr, source_entry_idx_copy, source_count, target_data_block, target_data_ptr_copy, row_width,
-	          copied_copy, count);
-	const idx_t flushed = copied_copy - copied;
-	// Compute the entry sizes and number of heap bytes that will be copied
-	idx_t copy_bytes = 0;
-	data_ptr_t source_heap_ptr_copy = source_heap_ptr;
-	for (idx_t i = 0; i < flushed; i++) {
-		// Store base heap offset in the row data
-		Store<idx_t>(target_heap_block.byte_offset + copy_bytes, target_data_ptr + heap_pointer_offset);
-		target_data_ptr += row_width;
-		// Compute entry size and add to total
-		auto entry_size = Load<uint32_t>(source_heap_ptr_copy);
-		D_ASSERT(entry_size >= sizeof(uint32_t));
-		source_heap_ptr_copy += entry_size;
-		copy_bytes += entry_size;
-	}
-	// Reallocate result heap block size (if needed)
-	if (target_heap_block.byte_offset + copy_bytes > target_heap_block.capacity) {
-		idx_t new_capacity = target_heap_block.byte_offset + copy_bytes;
-		buffer_manager.ReAllocate(target_heap_block.block, new_capacity);
-		target_heap_block.capacity = new_capacity;
-		target_heap_ptr = target_heap_handle.Ptr() + target_heap_block.byte_offset;
+void MergeSorter::PinRun(SBScanState &run) {
+	run.PinRadix(run.block_idx);
+	if (!sort_layout.all_constant) {
+		run.PinData(*run.sb->blob_sorting_data);
 	}
-	D_ASSERT(target_heap_block.byte_offset + copy_bytes <= target_heap_block.capacity);
-	// Copy the heap data in one go
-	memcpy(target_heap_ptr, source_heap_ptr, copy_bytes);
-	target_heap_ptr += copy_bytes;
-	source_heap_ptr += copy_bytes;
-	source_entry_idx += flushed;
-	copied += flushed;
-	// Update result indices and pointers
-	target_heap_block.count += flushed;
-	target_heap_block.byte_offset += copy_bytes;
-	D_ASSERT(target_heap_block.byte_offset <= target_heap_block.capacity);
+	run.PinData(*run.sb->payload_data);
 }
 
 } // namespace duckdb
@@ -3,6 +3,7 @@
 #include "duckdb/common/row_operations/row_operations.hpp"
 #include "duckdb/common/sort/sort.hpp"
 #include "duckdb/common/sort/sorted_block.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/storage/buffer/buffer_pool.hpp"
 
 #include <algorithm>
@@ -366,7 +367,7 @@ void LocalSortState::ReOrder(GlobalSortState &gstate, bool reorder_heap) {
 GlobalSortState::GlobalSortState(BufferManager &buffer_manager, const vector<BoundOrderByNode> &orders,
                                  RowLayout &payload_layout)
     : buffer_manager(buffer_manager), sort_layout(SortLayout(orders)), payload_layout(payload_layout),
-      block_capacity(0), external(false) {
+      block_capacity(0), external(false), merge_fan_in(0), group_idx(0), num_groups(0), group_start(0) {
 }
 
 void GlobalSortState::AddLocalState(LocalSortState &local_sort_state) {
@@ -432,23 +433,47 @@ void GlobalSortState::PrepareMergePhase() {
 	}
 }
 
+idx_t GlobalSortState::ComputeMergeFanIn() const {
+	if (!external) {
+		// Everything fits in memory, merge all sorted blocks in a single pass
+		return sorted_blocks.size();
+	}
+	// Every thread keeps one block of each of the sorted blocks that it merges pinned, make sure that fits
+	idx_t max_block_size = 0;
+	for (auto &sb : sorted_blocks) {
+		if (sb->radix_sorting_data.empty()) {
+			continue;
+		}
+		max_block_size = MaxValue(max_block_size, sb->SizeInBytes() / sb->radix_sorting_data.size());
+	}
+	auto &scheduler = TaskScheduler::GetScheduler(buffer_manager.GetDatabase());
+	const auto num_threads = NumericCast<idx_t>(scheduler.NumberOfThreads());
+	// Leave half of the memory for the output and the heaps
+	const auto memory_per_thread = buffer_manager.GetQueryMaxMemory() / (2 * num_threads);
+	const auto fan_in = memory_per_thread / MaxValue<idx_t>(max_block_size, 1);
+	return MinValue(sorted_blocks.size(), MaxValue<idx_t>(fan_in, 2));
+}
+
 void GlobalSortState::InitializeMergeRound() {
 	D_ASSERT(sorted_blocks_temp.empty());
 	// If we reverse this list, the blocks that were merged last will be merged first in the next round
 	// These are still in memory, therefore this reduces the amount of read/write to disk!
 	std::reverse(sorted_blocks.begin(), sorted_blocks.end());
-	// Uneven number of blocks - keep one on the side
-	if (sorted_blocks.size() % 2 == 1) {
+	// Divide the blocks into groups that are merged at once
+	merge_fan_in = ComputeMergeFanIn();
+	D_ASSERT(merge_fan_in >= 2);
+	// Only one block in the last group - keep it on the side
+	if (sorted_blocks.size() % merge_fan_in == 1) {
 		odd_one_out = std::move(sorted_blocks.back());
 		sorted_blocks.pop_back();
 	}
 	// Init merge path path indices
-	pair_idx = 0;
-	num_pairs = sorted_blocks.size() / 2;
-	l_start = 0;
-	r_start = 0;
+	group_idx = 0;
+	num_groups = (sorted_blocks.size() + merge_fan_in - 1) / merge_fan_in;
+	group_start = 0;
+	run_starts.clear();
 	// Allocate room for merge results
-	for (idx_t p_idx = 0; p_idx < num_pairs; p_idx++) {
+	for (idx_t g_idx = 0; g_idx < num_groups; g_idx++) {
 		sorted_blocks_temp.emplace_back();
 	}
 }
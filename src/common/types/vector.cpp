@@ -383,7 +383,7 @@ void Vector::Resize(idx_t current_size, idx_t new_size) {
 		// Copy the data buffer to a resized buffer.
 		auto new_data = make_unsafe_uniq_array_uninitialized<data_t>(target_size);
 		memcpy(new_data.get(), resize_info_entry.data, old_size);
-		resize_info_entry.buffer->SetData(std::move(new_data));
+		resize_info_entry.buffer->SetData(std::move(new_data), target_size);
 		resize_info_entry.vec.data = resize_info_entry.buffer->GetData();
 	}
 }
@@ -44,6 +44,11 @@ public:
 		}
 	}
 
+	bool OwnsData(const_data_ptr_t ptr, idx_t size) const override {
+		auto owned_ptr = owned_data.get();
+		return owned_ptr && ptr >= owned_ptr && ptr + size <= owned_ptr + owned_data.GetSize();
+	}
+
 	void ResetFromCache(Vector &result, const buffer_ptr<VectorBuffer> &buffer) {
 		D_ASSERT(type == result.GetType());
 		auto internal_type = type.InternalType();
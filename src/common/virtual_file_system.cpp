@@ -54,6 +54,14 @@ void VirtualFileSystem::Write(FileHandle &handle, void *buffer, int64_t nr_bytes
 	handle.file_system.Write(handle, buffer, nr_bytes, location);
 }
 
+unique_ptr<PendingFileReads> VirtualFileSystem::SubmitReads(FileHandle &handle, vector<FileReadRequest> requests) {
+	return handle.file_system.SubmitReads(handle, std::move(requests));
+}
+
+bool VirtualFileSystem::SupportsAsyncReads(FileHandle &handle) {
+	return handle.file_system.SupportsAsyncReads(handle);
+}
+
 int64_t VirtualFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes) {
 	return handle.file_system.Read(handle, buffer, nr_bytes);
 }
@@ -69,6 +69,10 @@ struct AverageSetOperation {
 	static void AddValues(STATE &state, idx_t count) {
 		state.count += count;
 	}
+	template <class STATE>
+	static void RemoveValues(STATE &state, idx_t count) {
+		state.count -= count;
+	}
 };
 
 template <class T>
@@ -139,23 +143,29 @@ struct KahanAverageOperation : public BaseSumOperation<AverageSetOperation, Kaha
 	}
 };
 
+template <class STATE, class INPUT_TYPE, class OP>
+static AggregateFunction GetIntegerAverageAggregate(const LogicalType &input_type) {
+	auto function = AggregateFunction::UnaryAggregate<STATE, INPUT_TYPE, double, OP>(input_type, LogicalType::DOUBLE);
+	function.inverse_update = AggregateFunction::UnaryScatterInverse<STATE, INPUT_TYPE, OP>;
+	return function;
+}
+
 AggregateFunction GetAverageAggregate(PhysicalType type) {
 	switch (type) {
 	case PhysicalType::INT16: {
-		return AggregateFunction::UnaryAggregate<AvgState<int64_t>, int16_t, double, IntegerAverageOperation>(
-		    LogicalType::SMALLINT, LogicalType::DOUBLE);
+		return GetIntegerAverageAggregate<AvgState<int64_t>, int16_t, IntegerAverageOperation>(LogicalType::SMALLINT);
 	}
 	case PhysicalType::INT32: {
-		return AggregateFunction::UnaryAggregate<AvgState<hugeint_t>, int32_t, double, IntegerAverageOperationHugeint>(
-		    LogicalType::INTEGER, LogicalType::DOUBLE);
+		return GetIntegerAverageAggregate<AvgState<hugeint_t>, int32_t, IntegerAverageOperationHugeint>(
+		    LogicalType::INTEGER);
 	}
 	case PhysicalType::INT64: {
-		return AggregateFunction::UnaryAggregate<AvgState<hugeint_t>, int64_t, double, IntegerAverageOperationHugeint>(
-		    LogicalType::BIGINT, LogicalType::DOUBLE);
+		return GetIntegerAverageAggregate<AvgState<hugeint_t>, int64_t, IntegerAverageOperationHugeint>(
+		    LogicalType::BIGINT);
 	}
 	case PhysicalType::INT128: {
-		return AggregateFunction::UnaryAggregate<AvgState<hugeint_t>, hugeint_t, double, HugeintAverageOperation>(
-		    LogicalType::HUGEINT, LogicalType::DOUBLE);
+		return GetIntegerAverageAggregate<AvgState<hugeint_t>, hugeint_t, HugeintAverageOperation>(
+		    LogicalType::HUGEINT);
 	}
 	default:
 		throw InternalException("Unimplemented average aggregate");
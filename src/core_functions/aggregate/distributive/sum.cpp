@@ -20,6 +20,10 @@ struct SumSetOperation {
 	static void AddValues(STATE &state, idx_t count) {
 		state.isset = true;
 	}
+	template <class STATE>
+	static void RemoveValues(STATE &state, idx_t count) {
+		// the window aggregate re-initializes the states of frames without any values, so isset can stay set
+	}
 };
 
 struct IntegerSumOperation : public BaseSumOperation<SumSetOperation, RegularAdd> {
@@ -91,6 +95,8 @@ AggregateFunction GetSumAggregateNoOverflow(PhysicalType type) {
 		auto function = AggregateFunction::UnaryAggregate<SumState<int64_t>, int32_t, hugeint_t, IntegerSumOperation>(
 		    LogicalType::INTEGER, LogicalType::HUGEINT);
 		function.name = "sum_no_overflow";
+		function.inverse_update =
+		    AggregateFunction::UnaryScatterInverse<SumState<int64_t>, int32_t, IntegerSumOperation>;
 		function.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
 		function.bind = SumNoOverflowBind;
 		function.serialize = SumNoOverflowSerialize;
@@ -101,6 +107,8 @@ AggregateFunction GetSumAggregateNoOverflow(PhysicalType type) {
 		auto function = AggregateFunction::UnaryAggregate<SumState<int64_t>, int64_t, hugeint_t, IntegerSumOperation>(
 		    LogicalType::BIGINT, LogicalType::HUGEINT);
 		function.name = "sum_no_overflow";
+		function.inverse_update =
+		    AggregateFunction::UnaryScatterInverse<SumState<int64_t>, int64_t, IntegerSumOperation>;
 		function.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
 		function.bind = SumNoOverflowBind;
 		function.serialize = SumNoOverflowSerialize;
@@ -160,6 +168,8 @@ AggregateFunction GetSumAggregate(PhysicalType type) {
 	case PhysicalType::INT16: {
 		auto function = AggregateFunction::UnaryAggregate<SumState<int64_t>, int16_t, hugeint_t, IntegerSumOperation>(
 		    LogicalType::SMALLINT, LogicalType::HUGEINT);
+		function.inverse_update =
+		    AggregateFunction::UnaryScatterInverse<SumState<int64_t>, int16_t, IntegerSumOperation>;
 		function.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
 		return function;
 	}
@@ -168,6 +178,8 @@ AggregateFunction GetSumAggregate(PhysicalType type) {
 		auto function =
 		    AggregateFunction::UnaryAggregate<SumState<hugeint_t>, int32_t, hugeint_t, SumToHugeintOperation>(
 		        LogicalType::INTEGER, LogicalType::HUGEINT);
+		function.inverse_update =
+		    AggregateFunction::UnaryScatterInverse<SumState<hugeint_t>, int32_t, SumToHugeintOperation>;
 		function.statistics = SumPropagateStats;
 		function.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
 		return function;
@@ -176,6 +188,8 @@ AggregateFunction GetSumAggregate(PhysicalType type) {
 		auto function =
 		    AggregateFunction::UnaryAggregate<SumState<hugeint_t>, int64_t, hugeint_t, SumToHugeintOperation>(
 		        LogicalType::BIGINT, LogicalType::HUGEINT);
+		function.inverse_update =
+		    AggregateFunction::UnaryScatterInverse<SumState<hugeint_t>, int64_t, SumToHugeintOperation>;
 		function.statistics = SumPropagateStats;
 		function.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
 		return function;
@@ -184,6 +198,8 @@ AggregateFunction GetSumAggregate(PhysicalType type) {
 		auto function =
 		    AggregateFunction::UnaryAggregate<SumState<hugeint_t>, hugeint_t, hugeint_t, HugeintSumOperation>(
 		        LogicalType::HUGEINT, LogicalType::HUGEINT);
+		function.inverse_update =
+		    AggregateFunction::UnaryScatterInverse<SumState<hugeint_t>, hugeint_t, HugeintSumOperation>;
 		function.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
 		return function;
 	}
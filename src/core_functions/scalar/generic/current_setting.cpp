@@ -62,6 +62,7 @@ unique_ptr<FunctionData> CurrentSettingBind(ClientContext &context, ScalarFuncti
 ScalarFunction CurrentSettingFun::GetFunction() {
 	auto fun = ScalarFunction({LogicalType::VARCHAR}, LogicalType::ANY, CurrentSettingFunction, CurrentSettingBind);
 	fun.null_handling = FunctionNullHandling::SPECIAL_HANDLING;
+	fun.stability = FunctionStability::CONSISTENT_WITHIN_QUERY;
 	return fun;
 }
 
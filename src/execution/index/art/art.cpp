@@ -486,6 +486,10 @@ ErrorData ART::Insert(IndexLock &lock, DataChunk &input, Vector &row_ids) {
 	unsafe_vector<ARTKey> row_id_keys(row_count);
 	GenerateKeyVectors(allocator, input, row_ids, keys, row_id_keys);
 
+	// Inserts are serialized by the index lock. We only block lookups while changing the tree,
+	// i.e., they can run concurrently to the key generation, but not to the insertion of the keys.
+	auto exclusive_lock = tree_lock.GetExclusiveLock();
+
 	// Insert the entries into the index.
 	idx_t failed_index = DConstants::INVALID_INDEX;
 	auto was_empty = !tree.HasMetadata();
@@ -516,6 +520,7 @@ ErrorData ART::Insert(IndexLock &lock, DataChunk &input, Vector &row_ids) {
 	}
 
 	if (failed_index != DConstants::INVALID_INDEX) {
+		exclusive_lock.reset();
 		auto msg = AppendRowError(input, failed_index);
 		return ErrorData(ConstraintException("PRIMARY KEY or UNIQUE constraint violated: duplicate key \"%s\"", msg));
 	}
@@ -652,6 +657,7 @@ bool ART::Insert(Node &node, const ARTKey &key, idx_t depth, const ARTKey &row_i
 //===--------------------------------------------------------------------===//
 
 void ART::CommitDrop(IndexLock &index_lock) {
+	auto exclusive_lock = tree_lock.GetExclusiveLock();
 	for (auto &allocator : *allocators) {
 		allocator->Reset();
 	}
@@ -670,6 +676,7 @@ void ART::Delete(IndexLock &state, DataChunk &input, Vector &row_ids) {
 	unsafe_vector<ARTKey> row_id_keys(row_count);
 	GenerateKeyVectors(allocator, expr_chunk, row_ids, keys, row_id_keys);
 
+	auto exclusive_lock = tree_lock.GetExclusiveLock();
 	for (idx_t i = 0; i < row_count; i++) {
 		if (keys[i].Empty()) {
 			continue;
@@ -903,7 +910,7 @@ bool ART::Scan(IndexScanState &state, const idx_t max_count, unsafe_vector<row_t
 
 	if (scan_state.values[1].IsNull()) {
 		// Single predicate.
-		lock_guard<mutex> l(lock);
+		auto shared_lock = tree_lock.GetSharedLock();
 		switch (scan_state.expressions[0]) {
 		case ExpressionType::COMPARE_EQUAL:
 			return SearchEqual(key, max_count, row_ids);
@@ -921,7 +928,7 @@ bool ART::Scan(IndexScanState &state, const idx_t max_count, unsafe_vector<row_t
 	}
 
 	// Two predicates.
-	lock_guard<mutex> l(lock);
+	auto shared_lock = tree_lock.GetSharedLock();
 	D_ASSERT(scan_state.values[1].type().InternalType() == types[0]);
 	auto upper_bound = ARTKey::CreateKey(arena_allocator, types[0], scan_state.values[1]);
 	bool left_equal = scan_state.expressions[0] == ExpressionType ::COMPARE_GREATERTHANOREQUALTO;
@@ -929,6 +936,72 @@ bool ART::Scan(IndexScanState &state, const idx_t max_count, unsafe_vector<row_t
 	return SearchCloseRange(key, upper_bound, left_equal, right_equal, max_count, row_ids);
 }
 
+static bool ExceedsBound(IteratorKey &key, const ARTKey &upper_bound) {
+	for (idx_t i = 0; i < MinValue<idx_t>(key.Size(), upper_bound.len); i++) {
+		if (key[i] != upper_bound.data[i]) {
+			return key[i] > upper_bound.data[i];
+		}
+	}
+	return false;
+}
+
+static bool IsKey(IteratorKey &key, const idx_t key_size, const unsafe_vector<uint8_t> &other) {
+	if (key_size != other.size()) {
+		return false;
+	}
+	for (idx_t i = 0; i < key_size; i++) {
+		if (key[i] != other[i]) {
+			return false;
+		}
+	}
+	return true;
+}
+
+bool ART::ScanOrdered(const ARTKey &prefix, const ARTKey &upper_bound, const idx_t max_count,
+                      unsafe_vector<row_t> &row_ids, unsafe_vector<uint8_t> &last_key) {
+	// We do not keep the iterator between calls, as the tree can change in between.
+	// Instead, we find the lower bound of the next key.
+	auto shared_lock = tree_lock.GetSharedLock();
+	Iterator it(*this);
+	if (last_key.empty()) {
+		if (!it.LowerBound(tree, prefix, true, 0)) {
+			return false;
+		}
+	} else {
+		ARTKey key(last_key.data(), last_key.size());
+		if (!it.LowerBound(tree, key, false, 0)) {
+			return false;
+		}
+	}
+
+	while (true) {
+		if (!it.current_key.Contains(prefix)) {
+			return false;
+		}
+		if (!upper_bound.Empty() && ExceedsBound(it.current_key, upper_bound)) {
+			return false;
+		}
+
+		// Scan all row IDs of the current key. Duplicate keys are stored in a nested leaf.
+		auto key_size = it.GetKeySize();
+		last_key.resize(key_size);
+		for (idx_t i = 0; i < key_size; i++) {
+			last_key[i] = it.current_key[i];
+		}
+		bool has_next;
+		do {
+			has_next = it.ScanLeaf(row_ids);
+		} while (has_next && IsKey(it.current_key, it.GetKeySize(), last_key));
+
+		if (!has_next) {
+			return false;
+		}
+		if (row_ids.size() >= max_count) {
+			return true;
+		}
+	}
+}
+
 //===--------------------------------------------------------------------===//
 // More Constraint Checking
 //===--------------------------------------------------------------------===//
@@ -936,7 +1009,7 @@ bool ART::Scan(IndexScanState &state, const idx_t max_count, unsafe_vector<row_t
 string ART::GenerateErrorKeyName(DataChunk &input, idx_t row_idx) {
 	DataChunk expr_chunk;
 	expr_chunk.Initialize(Allocator::DefaultAllocator(), logical_types);
-	ExecuteExpressions(input, expr_chunk);
+	ExecuteExpressionsUnlocked(input, expr_chunk);
 
 	string key_name;
 	for (idx_t k = 0; k < expr_chunk.ColumnCount(); k++) {
@@ -976,17 +1049,18 @@ string ART::GenerateConstraintErrorMessage(VerifyExistenceType verify_type, cons
 }
 
 void ART::CheckConstraintsForChunk(DataChunk &input, ConflictManager &conflict_manager) {
-	// Lock the index during constraint checking.
-	lock_guard<mutex> l(lock);
-
+	// Constraint checks do not hold the index lock.
 	DataChunk expr_chunk;
 	expr_chunk.Initialize(Allocator::DefaultAllocator(), logical_types);
-	ExecuteExpressions(input, expr_chunk);
+	ExecuteExpressionsUnlocked(input, expr_chunk);
 
 	ArenaAllocator arena_allocator(BufferAllocator::Get(db));
 	unsafe_vector<ARTKey> keys(expr_chunk.size());
 	GenerateKeys<>(arena_allocator, expr_chunk, keys);
 
+	// Lookups only hold a shared lock, i.e., the constraint checks of concurrent appends can run in parallel.
+	// The appends themselves still insert into the tree one at a time.
+	auto shared_lock = tree_lock.GetSharedLock();
 	auto found_conflict = DConstants::INVALID_INDEX;
 	for (idx_t i = 0; found_conflict == DConstants::INVALID_INDEX && i < input.size(); i++) {
 		if (keys[i].Empty()) {
@@ -1013,6 +1087,7 @@ void ART::CheckConstraintsForChunk(DataChunk &input, ConflictManager &conflict_m
 	}
 
 	conflict_manager.FinishLookup();
+	shared_lock.reset();
 	if (found_conflict == DConstants::INVALID_INDEX) {
 		return;
 	}
@@ -1058,6 +1133,9 @@ void ART::TransformToDeprecated() {
 }
 
 IndexStorageInfo ART::GetStorageInfo(const case_insensitive_map_t<Value> &options, const bool to_wal) {
+	// Serialization can transform nodes and unload buffers.
+	auto exclusive_lock = tree_lock.GetExclusiveLock();
+
 	// If the storage format uses deprecated leaf storage,
 	// then we need to transform all nested leaves before serialization.
 	auto v1_0_0_option = options.find("v1_0_0_storage");
@@ -1195,6 +1273,7 @@ void ART::FinalizeVacuum(const unordered_set<uint8_t> &indexes) {
 
 void ART::Vacuum(IndexLock &state) {
 	D_ASSERT(owns_data);
+	auto exclusive_lock = tree_lock.GetExclusiveLock();
 
 	if (!tree.HasMetadata()) {
 		for (auto &allocator : *allocators) {
@@ -1235,6 +1314,7 @@ bool ART::MergeIndexes(IndexLock &state, BoundIndex &other_index) {
 	if (!other_art.tree.HasMetadata()) {
 		return true;
 	}
+	auto exclusive_lock = tree_lock.GetExclusiveLock();
 
 	if (other_art.owns_data) {
 		if (tree.HasMetadata()) {
@@ -1263,6 +1343,7 @@ bool ART::MergeIndexes(IndexLock &state, BoundIndex &other_index) {
 //===--------------------------------------------------------------------===//
 
 string ART::VerifyAndToString(IndexLock &state, const bool only_verify) {
+	auto shared_lock = tree_lock.GetSharedLock();
 	return VerifyAndToStringInternal(only_verify);
 }
 
@@ -52,43 +52,50 @@ bool Iterator::Scan(const ARTKey &upper_bound, const idx_t max_count, unsafe_vec
 			}
 		}
 
-		switch (last_leaf.GetType()) {
-		case NType::LEAF_INLINED:
+		if (!GetRowIds(row_ids, max_count)) {
+			return false;
+		}
+		has_next = Next();
+	} while (has_next);
+	return true;
+}
+
+bool Iterator::ScanLeaf(unsafe_vector<row_t> &row_ids) {
+	GetRowIds(row_ids, NumericLimits<idx_t>::Maximum());
+	return Next();
+}
+
+bool Iterator::GetRowIds(unsafe_vector<row_t> &row_ids, const idx_t max_count) {
+	switch (last_leaf.GetType()) {
+	case NType::LEAF_INLINED:
+		if (row_ids.size() + 1 > max_count) {
+			return false;
+		}
+		row_ids.push_back(last_leaf.GetRowId());
+		return true;
+	case NType::LEAF:
+		return Leaf::DeprecatedGetRowIds(art, last_leaf, row_ids, max_count);
+	case NType::NODE_7_LEAF:
+	case NType::NODE_15_LEAF:
+	case NType::NODE_256_LEAF: {
+		uint8_t byte = 0;
+		while (last_leaf.GetNextByte(art, byte)) {
 			if (row_ids.size() + 1 > max_count) {
 				return false;
 			}
-			row_ids.push_back(last_leaf.GetRowId());
-			break;
-		case NType::LEAF:
-			if (!Leaf::DeprecatedGetRowIds(art, last_leaf, row_ids, max_count)) {
-				return false;
-			}
-			break;
-		case NType::NODE_7_LEAF:
-		case NType::NODE_15_LEAF:
-		case NType::NODE_256_LEAF: {
-			uint8_t byte = 0;
-			while (last_leaf.GetNextByte(art, byte)) {
-				if (row_ids.size() + 1 > max_count) {
-					return false;
-				}
-				row_id[ROW_ID_SIZE - 1] = byte;
-				ARTKey key(&row_id[0], ROW_ID_SIZE);
-				row_ids.push_back(key.GetRowId());
-				if (byte == NumericLimits<uint8_t>::Maximum()) {
-					break;
-				}
-				byte++;
+			row_id[ROW_ID_SIZE - 1] = byte;
+			ARTKey key(&row_id[0], ROW_ID_SIZE);
+			row_ids.push_back(key.GetRowId());
+			if (byte == NumericLimits<uint8_t>::Maximum()) {
+				break;
 			}
-			break;
-		}
-		default:
-			throw InternalException("Invalid leaf type for index scan.");
+			byte++;
 		}
-
-		has_next = Next();
-	} while (has_next);
-	return true;
+		return true;
+	}
+	default:
+		throw InternalException("Invalid leaf type for index scan.");
+	}
 }
 
 void Iterator::FindMinimum(const Node &node) {
@@ -160,6 +167,12 @@ bool Iterator::LowerBound(const Node &node, const ARTKey &key, const bool equal,
 	}
 
 	D_ASSERT(node.GetGateStatus() == GateStatus::GATE_NOT_SET);
+	if (depth == key.len) {
+		// The key is a prefix of all keys in this subtree.
+		FindMinimum(node);
+		return true;
+	}
+
 	if (node.GetType() != NType::PREFIX) {
 		auto next_byte = key[depth];
 		auto child = node.GetNextChild(art, next_byte);
@@ -191,6 +204,12 @@ bool Iterator::LowerBound(const Node &node, const ARTKey &key, const bool equal,
 
 	// We compare the prefix bytes with the key bytes.
 	for (idx_t i = 0; i < prefix.data[Prefix::Count(art)]; i++) {
+		// The key is a prefix of all keys in this subtree.
+		if (depth + i == key.len) {
+			FindMinimum(*prefix.ptr);
+			return true;
+		}
+
 		// We found a prefix byte that is less than its corresponding key byte.
 		// I.e., the subsequent node is lesser than the key. Thus, the next node
 		// is the lower bound.
@@ -196,20 +196,22 @@ void Node::DeleteChild(ART &art, Node &node, Node &prefix, const uint8_t byte, c
 // Get child and byte.
 //===--------------------------------------------------------------------===//
 
-template <class NODE>
-unsafe_optional_ptr<Node> GetChildInternal(ART &art, NODE &node, const uint8_t byte) {
+template <bool IS_MUTABLE>
+unsafe_optional_ptr<Node> GetChildInternal(ART &art, const Node &node, const uint8_t byte) {
 	D_ASSERT(node.HasMetadata());
 
+	// Lookups must not mark the buffers as dirty, as they can run concurrently.
 	auto type = node.GetType();
+	auto &allocator = Node::GetAllocator(art, type);
 	switch (type) {
 	case NType::NODE_4:
-		return Node4::GetChild(Node::Ref<Node4>(art, node, type), byte);
+		return Node4::GetChild(*allocator.Get<Node4>(node, IS_MUTABLE), byte);
 	case NType::NODE_16:
-		return Node16::GetChild(Node::Ref<Node16>(art, node, type), byte);
+		return Node16::GetChild(*allocator.Get<Node16>(node, IS_MUTABLE), byte);
 	case NType::NODE_48:
-		return Node48::GetChild(Node::Ref<Node48>(art, node, type), byte);
+		return Node48::GetChild(*allocator.Get<Node48>(node, IS_MUTABLE), byte);
 	case NType::NODE_256: {
-		return Node256::GetChild(Node::Ref<Node256>(art, node, type), byte);
+		return Node256::GetChild(*allocator.Get<Node256>(node, IS_MUTABLE), byte);
 	}
 	default:
 		throw InternalException("Invalid node type for GetChildInternal: %d.", static_cast<uint8_t>(type));
@@ -217,38 +219,39 @@ unsafe_optional_ptr<Node> GetChildInternal(ART &art, NODE &node, const uint8_t b
 }
 
 const unsafe_optional_ptr<Node> Node::GetChild(ART &art, const uint8_t byte) const {
-	return GetChildInternal(art, *this, byte);
+	return GetChildInternal<false>(art, *this, byte);
 }
 
 unsafe_optional_ptr<Node> Node::GetChildMutable(ART &art, const uint8_t byte) const {
-	return GetChildInternal(art, *this, byte);
+	return GetChildInternal<true>(art, *this, byte);
 }
 
-template <class NODE>
-unsafe_optional_ptr<Node> GetNextChildInternal(ART &art, NODE &node, uint8_t &byte) {
+template <bool IS_MUTABLE>
+unsafe_optional_ptr<Node> GetNextChildInternal(ART &art, const Node &node, uint8_t &byte) {
 	D_ASSERT(node.HasMetadata());
 
 	auto type = node.GetType();
+	auto &allocator = Node::GetAllocator(art, type);
 	switch (type) {
 	case NType::NODE_4:
-		return Node4::GetNextChild(Node::Ref<Node4>(art, node, type), byte);
+		return Node4::GetNextChild(*allocator.Get<Node4>(node, IS_MUTABLE), byte);
 	case NType::NODE_16:
-		return Node16::GetNextChild(Node::Ref<Node16>(art, node, type), byte);
+		return Node16::GetNextChild(*allocator.Get<Node16>(node, IS_MUTABLE), byte);
 	case NType::NODE_48:
-		return Node48::GetNextChild(Node::Ref<Node48>(art, node, type), byte);
+		return Node48::GetNextChild(*allocator.Get<Node48>(node, IS_MUTABLE), byte);
 	case NType::NODE_256:
-		return Node256::GetNextChild(Node::Ref<Node256>(art, node, type), byte);
+		return Node256::GetNextChild(*allocator.Get<Node256>(node, IS_MUTABLE), byte);
 	default:
 		throw InternalException("Invalid node type for GetNextChildInternal: %d.", static_cast<uint8_t>(type));
 	}
 }
 
 const unsafe_optional_ptr<Node> Node::GetNextChild(ART &art, uint8_t &byte) const {
-	return GetNextChildInternal(art, *this, byte);
+	return GetNextChildInternal<false>(art, *this, byte);
 }
 
 unsafe_optional_ptr<Node> Node::GetNextChildMutable(ART &art, uint8_t &byte) const {
-	return GetNextChildInternal(art, *this, byte);
+	return GetNextChildInternal<true>(art, *this, byte);
 }
 
 bool Node::HasByte(ART &art, uint8_t &byte) const {
@@ -261,7 +264,7 @@ bool Node::HasByte(ART &art, uint8_t &byte) const {
 	case NType::NODE_15_LEAF:
 		return Ref<const Node15Leaf>(art, *this, NType::NODE_15_LEAF).HasByte(byte);
 	case NType::NODE_256_LEAF:
-		return Ref<Node256Leaf>(art, *this, NType::NODE_256_LEAF).HasByte(byte);
+		return GetAllocator(art, NType::NODE_256_LEAF).Get<Node256Leaf>(*this, false)->HasByte(byte);
 	default:
 		throw InternalException("Invalid node type for GetNextByte: %d.", static_cast<uint8_t>(type));
 	}
@@ -277,7 +280,7 @@ bool Node::GetNextByte(ART &art, uint8_t &byte) const {
 	case NType::NODE_15_LEAF:
 		return Ref<const Node15Leaf>(art, *this, NType::NODE_15_LEAF).GetNextByte(byte);
 	case NType::NODE_256_LEAF:
-		return Ref<Node256Leaf>(art, *this, NType::NODE_256_LEAF).GetNextByte(byte);
+		return GetAllocator(art, NType::NODE_256_LEAF).Get<Node256Leaf>(*this, false)->GetNextByte(byte);
 	default:
 		throw InternalException("Invalid node type for GetNextByte: %d.", static_cast<uint8_t>(type));
 	}
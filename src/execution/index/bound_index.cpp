@@ -84,6 +84,11 @@ void BoundIndex::ExecuteExpressions(DataChunk &input, DataChunk &result) {
 	executor.Execute(input, result);
 }
 
+void BoundIndex::ExecuteExpressionsUnlocked(DataChunk &input, DataChunk &result) const {
+	ExpressionExecutor local_executor(bound_expressions);
+	local_executor.Execute(input, result);
+}
+
 unique_ptr<Expression> BoundIndex::BindExpression(unique_ptr<Expression> expr) {
 	if (expr->type == ExpressionType::BOUND_COLUMN_REF) {
 		auto &bound_colref = expr->Cast<BoundColumnRefExpression>();
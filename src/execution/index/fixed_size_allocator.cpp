@@ -335,6 +335,13 @@ void FixedSizeAllocator::Deserialize(MetadataManager &metadata_manager, const Bl
 	}
 }
 
+void FixedSizeAllocator::Pin(FixedSizeBuffer &buffer) {
+	lock_guard<mutex> guard(pin_lock);
+	if (!buffer.InMemory()) {
+		buffer.Pin();
+	}
+}
+
 idx_t FixedSizeAllocator::GetAvailableBufferId() const {
 	idx_t buffer_id = buffers.size();
 	while (buffers.find(buffer_id) != buffers.end()) {
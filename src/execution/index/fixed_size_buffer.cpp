@@ -37,7 +37,7 @@ constexpr uint8_t FixedSizeBuffer::SHIFT[];
 
 FixedSizeBuffer::FixedSizeBuffer(BlockManager &block_manager)
     : block_manager(block_manager), segment_count(0), allocation_size(0), dirty(false), vacuum(false), block_pointer(),
-      block_handle(nullptr) {
+      block_handle(nullptr), in_memory(true) {
 
 	auto &buffer_manager = block_manager.buffer_manager;
 	buffer_handle = buffer_manager.Allocate(MemoryTag::ART_INDEX, block_manager.GetBlockSize(), false);
@@ -47,17 +47,26 @@ FixedSizeBuffer::FixedSizeBuffer(BlockManager &block_manager)
 FixedSizeBuffer::FixedSizeBuffer(BlockManager &block_manager, const idx_t segment_count, const idx_t allocation_size,
                                  const BlockPointer &block_pointer)
     : block_manager(block_manager), segment_count(segment_count), allocation_size(allocation_size), dirty(false),
-      vacuum(false), block_pointer(block_pointer) {
+      vacuum(false), block_pointer(block_pointer), in_memory(false) {
 
 	D_ASSERT(block_pointer.IsValid());
 	block_handle = block_manager.RegisterBlock(block_pointer.block_id);
 	D_ASSERT(block_handle->BlockId() < MAXIMUM_BLOCK);
 }
 
+FixedSizeBuffer::FixedSizeBuffer(FixedSizeBuffer &&other) noexcept
+    : block_manager(other.block_manager), segment_count(other.segment_count), allocation_size(other.allocation_size),
+      dirty(other.dirty), vacuum(other.vacuum), block_pointer(other.block_pointer),
+      buffer_handle(std::move(other.buffer_handle)), block_handle(std::move(other.block_handle)),
+      in_memory(other.in_memory.load()) {
+	other.in_memory = false;
+}
+
 void FixedSizeBuffer::Destroy() {
 	if (InMemory()) {
 		// we can have multiple readers on a pinned block, and unpinning the buffer handle
 		// decrements the reader count on the underlying block handle (Destroy() unpins)
+		in_memory = false;
 		buffer_handle.Destroy();
 	}
 	if (OnDisk()) {
@@ -120,6 +129,7 @@ void FixedSizeBuffer::Serialize(PartialBlockManager &partial_block_manager, cons
 	partial_block_manager.RegisterPartialBlock(std::move(allocation));
 
 	// resetting this buffer
+	in_memory = false;
 	buffer_handle.Destroy();
 	block_handle = block_manager.RegisterBlock(block_pointer.block_id);
 	D_ASSERT(block_handle->BlockId() < MAXIMUM_BLOCK);
@@ -134,16 +144,18 @@ void FixedSizeBuffer::Pin() {
 	D_ASSERT(block_handle && block_handle->BlockId() < MAXIMUM_BLOCK);
 	D_ASSERT(!dirty);
 
-	buffer_handle = buffer_manager.Pin(block_handle);
+	auto disk_buffer_handle = buffer_manager.Pin(block_handle);
 
 	// Copy the (partial) data into a new (not yet disk-backed) buffer handle.
 	shared_ptr<BlockHandle> new_block_handle;
 	auto new_buffer_handle = buffer_manager.Allocate(MemoryTag::ART_INDEX, block_manager.GetBlockSize(), false);
 	new_block_handle = new_buffer_handle.GetBlockHandle();
-	memcpy(new_buffer_handle.Ptr(), buffer_handle.Ptr() + block_pointer.offset, allocation_size);
+	memcpy(new_buffer_handle.Ptr(), disk_buffer_handle.Ptr() + block_pointer.offset, allocation_size);
 
 	buffer_handle = std::move(new_buffer_handle);
 	block_handle = std::move(new_block_handle);
+	// Publish the buffer to readers that do not hold the pin lock.
+	in_memory = true;
 }
 
 uint32_t FixedSizeBuffer::GetOffset(const idx_t bitmask_count) {
@@ -151,6 +151,26 @@ static void ApplyBitmaskAndGetSaltBuild(Vector &hashes_v, const idx_t &count, co
 	}
 }
 
+//! Number of keys of which the HT entries are prefetched ahead of the keys that are being probed
+static constexpr idx_t PROBE_PREFETCH_GROUP_SIZE = 64;
+
+//! Hints the CPU to start loading the cache line containing "ptr" - this never faults, so "ptr" can be invalid (e.g.,
+//! nullptr)
+static inline void PrefetchForRead(const void *ptr) {
+#if defined(__GNUC__) || defined(__clang__)
+	__builtin_prefetch(ptr, 0, 3);
+#else
+	(void)ptr;
+#endif
+}
+
+static inline void PrefetchEntries(const ht_entry_t *entries, const idx_t *ht_offsets, const idx_t start,
+                                   const idx_t end) {
+	for (idx_t i = start; i < end; i++) {
+		PrefetchForRead(entries + ht_offsets[i]);
+	}
+}
+
 //! Gets a pointer to the entry in the HT for each of the hashes_v using linear probing. Will update the key_match_sel
 //! vector and the count argument to the number and position of the matches
 template <bool USE_SALTS>
@@ -179,13 +199,21 @@ static inline void GetRowPointersInternal(DataChunk &keys, TupleDataChunkState &
 	}
 
 	// have a dense loop to have as few instructions as possible while producing cache misses as this is the
-	// first location where we access the big entries array
-	for (idx_t i = 0; i < count; i++) {
-		idx_t ht_offset = ht_offsets_dense[i];
-		auto &entry = entries[ht_offset];
-		bool occupied = entry.IsOccupied();
-		state.non_empty_sel.set_index(non_empty_count, i);
-		non_empty_count += occupied;
+	// first location where we access the big entries array. The keys are processed in groups: the entries of the next
+	// group are prefetched before the entries of the current group are checked, so the cache misses of a group overlap
+	// with the work on the previous one instead of stalling the probe when the HT does not fit in the cache
+	PrefetchEntries(entries, ht_offsets_dense, 0, MinValue<idx_t>(count, PROBE_PREFETCH_GROUP_SIZE));
+	for (idx_t group_start = 0; group_start < count; group_start += PROBE_PREFETCH_GROUP_SIZE) {
+		const auto group_end = MinValue<idx_t>(group_start + PROBE_PREFETCH_GROUP_SIZE, count);
+		PrefetchEntries(entries, ht_offsets_dense, group_end,
+		                MinValue<idx_t>(group_end + PROBE_PREFETCH_GROUP_SIZE, count));
+		for (idx_t i = group_start; i < group_end; i++) {
+			idx_t ht_offset = ht_offsets_dense[i];
+			auto &entry = entries[ht_offset];
+			bool occupied = entry.IsOccupied();
+			state.non_empty_sel.set_index(non_empty_count, i);
+			non_empty_count += occupied;
+		}
 	}
 
 	for (idx_t i = 0; i < non_empty_count; i++) {
@@ -254,6 +282,9 @@ static inline void GetRowPointersInternal(DataChunk &keys, TupleDataChunkState &
 			// entry might be empty, so the pointer in the entry is nullptr, but this does not matter as the row
 			// will not be compared anyway as with an empty entry we are already done
 			row_ptr_insert_to[row_index] = entry.GetPointerOrNull();
+
+			// the candidate row is only compared once all keys have been probed, start loading it already
+			PrefetchForRead(row_ptr_insert_to[row_index]);
 		}
 
 		if (salt_match_count != 0) {
@@ -876,6 +907,8 @@ void ScanStructure::AdvancePointers(const SelectionVector &sel, const idx_t sel_
 	for (idx_t i = 0; i < sel_count; i++) {
 		auto idx = sel.get_index(i);
 		ptrs[idx] = LoadPointer(ptrs[idx] + ht.pointer_offset);
+		// the next row in the chain is only accessed once all pointers have been advanced, start loading it already
+		PrefetchForRead(ptrs[idx]);
 		if (ptrs[idx]) {
 			this->sel_vector.set_index(new_count++, idx);
 		}
@@ -894,6 +894,21 @@ double PhysicalHashAggregate::GetProgress(ClientContext &context, GlobalSourceSt
 	return total_progress / double(groupings.size());
 }
 
+InsertionOrderPreservingMap<string> PhysicalHashAggregate::ExtraSourceParams(GlobalSourceState &gstate,
+                                                                           LocalSourceState &lstate) const {
+	InsertionOrderPreservingMap<string> result;
+	auto &sink_gstate = sink_state->Cast<HashAggregateGlobalSinkState>();
+	idx_t skipped_lookup_count = 0;
+	for (auto &grouping_state : sink_gstate.grouping_states) {
+		skipped_lookup_count += RadixPartitionedHashTable::SkippedLookupCount(*grouping_state.table_state);
+	}
+	if (skipped_lookup_count != 0) {
+		// Pre-aggregation did not reduce the data, so (some) rows were partitioned without aggregating them first
+		result["Pre-Aggregation"] = StringUtil::Format("Skipped for %llu Rows", skipped_lookup_count);
+	}
+	return result;
+}
+
 InsertionOrderPreservingMap<string> PhysicalHashAggregate::ParamsToString() const {
 	InsertionOrderPreservingMap<string> result;
 	auto &groups = grouped_aggregate_data.groups;
@@ -9,6 +9,7 @@
 #include "duckdb/execution/operator/csv_scanner/skip_scanner.hpp"
 #include "duckdb/function/cast/cast_function_set.hpp"
 #include "duckdb/main/client_data.hpp"
+#include "duckdb/storage/table/column_segment.hpp"
 #include "utf8proc_wrapper.hpp"
 
 #include <algorithm>
@@ -921,7 +922,53 @@ StringValueResult &StringValueScanner::ParseChunk() {
 	return result;
 }
 
+//! If the parsed vector already holds the values of the result type, in which case it can be reinterpreted
+static bool CanReinterpretParsedVector(const LogicalType &type, const LogicalType &parse_type) {
+	return !type.IsJSONType() &&
+	       (type == LogicalType::VARCHAR || (type != LogicalType::VARCHAR && parse_type != LogicalType::VARCHAR));
+}
+
+void StringValueScanner::FilterParsedChunk(DataChunk &parse_chunk, DataChunk &insert_chunk, SelectionVector &sel,
+                                           idx_t &count, vector<idx_t> &deferred_filters) {
+	auto &reader_data = csv_file_scan->reader_data;
+	auto &projection_ids = csv_file_scan->projection_ids;
+	for (auto &entry : reader_data.filters->filters) {
+		if (count == 0) {
+			return;
+		}
+		auto &filter_entry = reader_data.filter_map[entry.first];
+		if (filter_entry.is_constant) {
+			// the filter is over a constant column (e.g., filename or a hive partition), it either keeps or
+			// removes all rows
+			Vector constant_vector(reader_data.constant_map[filter_entry.index].value);
+			UnifiedVectorFormat vdata;
+			constant_vector.ToUnifiedFormat(1, vdata);
+			ColumnSegment::FilterSelection(sel, constant_vector, vdata, *entry.second, parse_chunk.size(), count);
+			continue;
+		}
+		idx_t col_idx = filter_entry.index;
+		for (idx_t p = 0; p < projection_ids.size(); p++) {
+			if (projection_ids[p].second == filter_entry.index) {
+				col_idx = p;
+				break;
+			}
+		}
+		auto &parse_vector = parse_chunk.data[col_idx];
+		auto &type = insert_chunk.data[reader_data.column_mapping[filter_entry.index]].GetType();
+		if (!CanReinterpretParsedVector(type, parse_vector.GetType())) {
+			// the values still have to be cast, we can only evaluate this filter after the cast
+			deferred_filters.push_back(entry.first);
+			continue;
+		}
+		UnifiedVectorFormat vdata;
+		parse_vector.ToUnifiedFormat(parse_chunk.size(), vdata);
+		ColumnSegment::FilterSelection(sel, parse_vector, vdata, *entry.second, parse_chunk.size(), count);
+	}
+}
+
 void StringValueScanner::Flush(DataChunk &insert_chunk) {
+	// the previous call might have sliced the chunk when none of its rows passed the filters
+	insert_chunk.Reset();
 	auto &process_result = ParseChunk();
 	// First Get Parsed Chunk
 	auto &parse_chunk = process_result.ToChunk();
@@ -930,13 +977,26 @@ void StringValueScanner::Flush(DataChunk &insert_chunk) {
 	if (parse_chunk.size() == 0) {
 		return;
 	}
-	// convert the columns in the parsed chunk to the types of the table
-	insert_chunk.SetCardinality(parse_chunk);
-
 	// We keep track of the borked lines, in case we are ignoring errors
 	D_ASSERT(csv_file_scan);
 
 	auto &reader_data = csv_file_scan->reader_data;
+	// The rows of the parsed chunk that must be converted - rows that could not be parsed are still converted, so
+	// that all of their errors are reported
+	SelectionVector sel;
+	sel.Initialize(nullptr);
+	idx_t count = parse_chunk.size();
+	// Evaluate the pushed down filters on the parsed values, so we only convert the rows that pass them
+	vector<idx_t> deferred_filters;
+	if (reader_data.filters) {
+		FilterParsedChunk(parse_chunk, insert_chunk, sel, count, deferred_filters);
+	}
+	// convert the columns in the parsed chunk to the types of the table
+	insert_chunk.SetCardinality(count);
+	if (count == 0) {
+		return;
+	}
+
 	// Now Do the cast-aroo
 	for (idx_t c = 0; c < reader_data.column_ids.size(); c++) {
 		idx_t col_idx = c;
@@ -947,46 +1007,50 @@ void StringValueScanner::Flush(DataChunk &insert_chunk) {
 		if (col_idx >= parse_chunk.ColumnCount()) {
 			throw InvalidInputException("Mismatch between the schema of different files");
 		}
-		auto &parse_vector = parse_chunk.data[col_idx];
 		auto &result_vector = insert_chunk.data[result_idx];
 		auto &type = result_vector.GetType();
+		// only the selected rows of the parsed vector are converted
+		Vector parse_vector(parse_chunk.data[col_idx]);
+		if (sel.IsSet()) {
+			parse_vector.Slice(sel, count);
+		}
 		auto &parse_type = parse_vector.GetType();
-		if (!type.IsJSONType() &&
-		    (type == LogicalType::VARCHAR || (type != LogicalType::VARCHAR && parse_type != LogicalType::VARCHAR))) {
+		if (CanReinterpretParsedVector(type, parse_type)) {
 			// reinterpret rather than reference
 			result_vector.Reinterpret(parse_vector);
 		} else {
 			string error_message;
 			idx_t line_error = 0;
-			if (VectorOperations::TryCast(buffer_manager->context, parse_vector, result_vector, parse_chunk.size(),
-			                              &error_message, false, true)) {
+			if (VectorOperations::TryCast(buffer_manager->context, parse_vector, result_vector, count, &error_message,
+			                              false, true)) {
 				continue;
 			}
 			// An error happened, to propagate it we need to figure out the exact line where the casting failed.
 			UnifiedVectorFormat inserted_column_data;
-			result_vector.ToUnifiedFormat(parse_chunk.size(), inserted_column_data);
+			result_vector.ToUnifiedFormat(count, inserted_column_data);
 			UnifiedVectorFormat parse_column_data;
-			parse_vector.ToUnifiedFormat(parse_chunk.size(), parse_column_data);
+			parse_vector.ToUnifiedFormat(count, parse_column_data);
 
-			for (; line_error < parse_chunk.size(); line_error++) {
+			for (; line_error < count; line_error++) {
 				if (!inserted_column_data.validity.RowIsValid(line_error) &&
 				    parse_column_data.validity.RowIsValid(line_error)) {
 					break;
 				}
 			}
 			{
-
+				// the row of the parsed chunk the error happened in
+				auto row_error = sel.get_index(line_error);
 				if (state_machine->options.ignore_errors.GetValue()) {
 					vector<Value> row;
 					for (idx_t col = 0; col < parse_chunk.ColumnCount(); col++) {
-						row.push_back(parse_chunk.GetValue(col, line_error));
+						row.push_back(parse_chunk.GetValue(col, row_error));
 					}
 				}
 				if (!state_machine->options.IgnoreErrors()) {
 					LinesPerBoundary lines_per_batch(iterator.GetBoundaryIdx(),
-					                                 lines_read - parse_chunk.size() + line_error);
+					                                 lines_read - parse_chunk.size() + row_error);
 					bool first_nl;
-					auto borked_line = result.line_positions_per_row[line_error].ReconstructCurrentLine(
+					auto borked_line = result.line_positions_per_row[row_error].ReconstructCurrentLine(
 					    first_nl, result.buffer_handles, result.PrintErrorLine());
 					std::ostringstream error;
 					error << "Could not convert string \"" << parse_vector.GetValue(line_error) << "\" to \'"
@@ -996,27 +1060,29 @@ void StringValueScanner::Flush(DataChunk &insert_chunk) {
 					auto csv_error = CSVError::CastError(
 					    state_machine->options, csv_file_scan->names[col_idx], error_msg, col_idx, borked_line,
 					    lines_per_batch,
-					    result.line_positions_per_row[line_error].begin.GetGlobalPosition(result.result_size, first_nl),
+					    result.line_positions_per_row[row_error].begin.GetGlobalPosition(result.result_size, first_nl),
 					    optional_idx::Invalid(), result_vector.GetType().id(), result.path);
 					error_handler->Error(csv_error);
 				}
+				result.borked_rows.insert(row_error);
 			}
-			result.borked_rows.insert(line_error++);
+			line_error++;
 			D_ASSERT(state_machine->options.ignore_errors.GetValue());
 			// We are ignoring errors. We must continue but ignoring borked rows
-			for (; line_error < parse_chunk.size(); line_error++) {
+			for (; line_error < count; line_error++) {
 				if (!inserted_column_data.validity.RowIsValid(line_error) &&
 				    parse_column_data.validity.RowIsValid(line_error)) {
-					result.borked_rows.insert(line_error);
+					auto row_error = sel.get_index(line_error);
+					result.borked_rows.insert(row_error);
 					vector<Value> row;
 					for (idx_t col = 0; col < parse_chunk.ColumnCount(); col++) {
-						row.push_back(parse_chunk.GetValue(col, line_error));
+						row.push_back(parse_chunk.GetValue(col, row_error));
 					}
 					if (!state_machine->options.IgnoreErrors()) {
 						LinesPerBoundary lines_per_batch(iterator.GetBoundaryIdx(),
-						                                 lines_read - parse_chunk.size() + line_error);
+						                                 lines_read - parse_chunk.size() + row_error);
 						bool first_nl;
-						auto borked_line = result.line_positions_per_row[line_error].ReconstructCurrentLine(
+						auto borked_line = result.line_positions_per_row[row_error].ReconstructCurrentLine(
 						    first_nl, result.buffer_handles, result.PrintErrorLine());
 						std::ostringstream error;
 						// Casting Error Message
@@ -1027,7 +1093,7 @@ void StringValueScanner::Flush(DataChunk &insert_chunk) {
 						auto csv_error =
 						    CSVError::CastError(state_machine->options, csv_file_scan->names[col_idx], error_msg,
 						                        col_idx, borked_line, lines_per_batch,
-						                        result.line_positions_per_row[line_error].begin.GetGlobalPosition(
+						                        result.line_positions_per_row[row_error].begin.GetGlobalPosition(
 						                            result.result_size, first_nl),
 						                        optional_idx::Invalid(), result_vector.GetType().id(), result.path);
 						error_handler->Error(csv_error);
@@ -1036,15 +1102,35 @@ void StringValueScanner::Flush(DataChunk &insert_chunk) {
 			}
 		}
 	}
-	if (!result.borked_rows.empty()) {
-		// We must remove the borked lines from our chunk
-		SelectionVector succesful_rows(parse_chunk.size());
-		idx_t sel_idx = 0;
-		for (idx_t row_idx = 0; row_idx < parse_chunk.size(); row_idx++) {
-			if (result.borked_rows.find(row_idx) == result.borked_rows.end()) {
+	if (result.borked_rows.empty() && deferred_filters.empty()) {
+		return;
+	}
+	// We must remove the borked lines from our chunk, and the rows that do not pass the remaining filters
+	SelectionVector succesful_rows;
+	idx_t sel_idx = count;
+	if (result.borked_rows.empty()) {
+		succesful_rows.Initialize(nullptr);
+	} else {
+		succesful_rows.Initialize(count);
+		sel_idx = 0;
+		for (idx_t row_idx = 0; row_idx < count; row_idx++) {
+			if (result.borked_rows.find(sel.get_index(row_idx)) == result.borked_rows.end()) {
 				succesful_rows.set_index(sel_idx++, row_idx);
 			}
 		}
+	}
+	for (auto &filter_idx : deferred_filters) {
+		if (sel_idx == 0) {
+			break;
+		}
+		// filters are keyed on the column index of the output chunk
+		auto &result_vector = insert_chunk.data[filter_idx];
+		UnifiedVectorFormat vdata;
+		result_vector.ToUnifiedFormat(count, vdata);
+		auto &filter = *reader_data.filters->filters[filter_idx];
+		ColumnSegment::FilterSelection(succesful_rows, result_vector, vdata, filter, count, sel_idx);
+	}
+	if (sel_idx < count) {
 		// Now we slice the result
 		insert_chunk.Slice(succesful_rows, sel_idx);
 	}
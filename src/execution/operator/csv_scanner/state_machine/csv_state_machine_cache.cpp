@@ -10,12 +10,6 @@ void InitializeTransitionArray(StateMachine &transition_array, const CSVState cu
 	}
 }
 
-// Shift and OR to replicate across all bytes
-void ShiftAndReplicateBits(uint64_t &value) {
-	value |= value << 8;
-	value |= value << 16;
-	value |= value << 32;
-}
 void CSVStateMachineCache::Insert(const CSVStateMachineOptions &state_machine_options) {
 	D_ASSERT(state_machine_cache.find(state_machine_options) == state_machine_cache.end());
 	// Initialize transition array with default values to the Standard option
@@ -212,19 +206,14 @@ void CSVStateMachineCache::Insert(const CSVStateMachineOptions &state_machine_op
 	transition_array.skip_comment[static_cast<uint8_t>('\r')] = false;
 	transition_array.skip_comment[static_cast<uint8_t>('\n')] = false;
 
-	transition_array.delimiter = delimiter;
-	transition_array.new_line = static_cast<uint8_t>('\n');
-	transition_array.carriage_return = static_cast<uint8_t>('\r');
-	transition_array.quote = quote;
-	transition_array.escape = escape;
-
-	// Shift and OR to replicate across all bytes
-	ShiftAndReplicateBits(transition_array.delimiter);
-	ShiftAndReplicateBits(transition_array.new_line);
-	ShiftAndReplicateBits(transition_array.carriage_return);
-	ShiftAndReplicateBits(transition_array.quote);
-	ShiftAndReplicateBits(transition_array.escape);
-	ShiftAndReplicateBits(transition_array.comment);
+	// The structural characters are a superset of the characters we can't skip in any of the states
+	auto &structural = transition_array.structural_characters.characters;
+	structural[0] = delimiter;
+	structural[1] = quote;
+	structural[2] = escape;
+	structural[3] = comment;
+	structural[4] = static_cast<uint8_t>('\n');
+	structural[5] = static_cast<uint8_t>('\r');
 }
 
 CSVStateMachineCache::CSVStateMachineCache() {
@@ -0,0 +1,104 @@
+#include "duckdb/execution/operator/csv_scanner/csv_structural_mask.hpp"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+#include <emmintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+namespace duckdb {
+
+#if defined(__AVX2__)
+
+static uint64_t ComputeMaskInternal(const CSVStructuralCharacters &characters, const uint8_t *ptr) {
+	uint64_t result = 0;
+	for (idx_t i = 0; i < CSVStructuralMask::BLOCK_SIZE; i += 32) {
+		auto block = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(ptr + i));
+		auto matches = _mm256_setzero_si256();
+		for (idx_t c = 0; c < CSVStructuralCharacters::COUNT; c++) {
+			auto character = _mm256_set1_epi8(static_cast<char>(characters.characters[c]));
+			matches = _mm256_or_si256(matches, _mm256_cmpeq_epi8(block, character));
+		}
+		result |= static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(matches))) << i;
+	}
+	return result;
+}
+
+#elif defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+
+static uint64_t ComputeMaskInternal(const CSVStructuralCharacters &characters, const uint8_t *ptr) {
+	uint64_t result = 0;
+	for (idx_t i = 0; i < CSVStructuralMask::BLOCK_SIZE; i += 16) {
+		auto block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(ptr + i));
+		auto matches = _mm_setzero_si128();
+		for (idx_t c = 0; c < CSVStructuralCharacters::COUNT; c++) {
+			auto character = _mm_set1_epi8(static_cast<char>(characters.characters[c]));
+			matches = _mm_or_si128(matches, _mm_cmpeq_epi8(block, character));
+		}
+		result |= static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(matches))) << i;
+	}
+	return result;
+}
+
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+
+static uint64_t ComputeMaskInternal(const CSVStructuralCharacters &characters, const uint8_t *ptr) {
+	// NEON has no movemask, every matching byte is reduced to its bit in the mask instead
+	static const uint8_t BIT_WEIGHTS[16] = {1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128};
+	auto weights = vld1q_u8(BIT_WEIGHTS);
+	uint64_t result = 0;
+	for (idx_t i = 0; i < CSVStructuralMask::BLOCK_SIZE; i += 16) {
+		auto block = vld1q_u8(ptr + i);
+		auto matches = vdupq_n_u8(0);
+		for (idx_t c = 0; c < CSVStructuralCharacters::COUNT; c++) {
+			matches = vorrq_u8(matches, vceqq_u8(block, vdupq_n_u8(characters.characters[c])));
+		}
+		matches = vandq_u8(matches, weights);
+		uint64_t low = vaddv_u8(vget_low_u8(matches));
+		uint64_t high = vaddv_u8(vget_high_u8(matches));
+		result |= (low | (high << 8)) << i;
+	}
+	return result;
+}
+
+#else
+
+//! Returns 0x80 in every byte of value that is zero, and 0 in all other bytes
+static inline uint64_t ZeroBytes(uint64_t value) {
+	constexpr uint64_t LOW_BITS = UINT64_C(0x7F7F7F7F7F7F7F7F);
+	return ~(((value & LOW_BITS) + LOW_BITS) | value | LOW_BITS);
+}
+
+static uint64_t ComputeMaskInternal(const CSVStructuralCharacters &characters, const uint8_t *ptr) {
+	uint64_t result = 0;
+	for (idx_t i = 0; i < CSVStructuralMask::BLOCK_SIZE; i += 8) {
+		// assemble the word byte by byte, so byte b always ends up in bits [8b, 8b + 8) regardless of endianness
+		uint64_t value = 0;
+		for (idx_t b = 0; b < 8; b++) {
+			value |= static_cast<uint64_t>(ptr[i + b]) << (8 * b);
+		}
+		uint64_t matches = 0;
+		for (idx_t c = 0; c < CSVStructuralCharacters::COUNT; c++) {
+			matches |= ZeroBytes(value ^ (UINT64_C(0x0101010101010101) * characters.characters[c]));
+		}
+		// gather the high bit of every byte into the lowest 8 bits
+		result |= (((matches >> 7) * UINT64_C(0x0102040810204080)) >> 56) << i;
+	}
+	return result;
+}
+
+#endif
+
+uint64_t CSVStructuralMask::ComputeMask(const CSVStructuralCharacters &characters, const char *ptr) {
+	return ComputeMaskInternal(characters, reinterpret_cast<const uint8_t *>(ptr));
+}
+
+void CSVStructuralMask::Compute(const CSVStructuralCharacters &characters, const char *buffer, idx_t position) {
+	block_start = position;
+	mask = ComputeMask(characters, buffer + position);
+	initialized = true;
+}
+
+} // namespace duckdb
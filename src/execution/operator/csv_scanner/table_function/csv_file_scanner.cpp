@@ -10,7 +10,8 @@ CSVUnionData::~CSVUnionData() {
 
 CSVFileScan::CSVFileScan(ClientContext &context, shared_ptr<CSVBufferManager> buffer_manager_p,
                          shared_ptr<CSVStateMachine> state_machine_p, const CSVReaderOptions &options_p,
-                         const ReadCSVData &bind_data, const vector<column_t> &column_ids, CSVSchema &file_schema)
+                         const ReadCSVData &bind_data, const vector<column_t> &column_ids, CSVSchema &file_schema,
+                         optional_ptr<TableFilterSet> filters)
     : file_path(options_p.file_path), file_idx(0), buffer_manager(std::move(buffer_manager_p)),
       state_machine(std::move(state_machine_p)), file_size(buffer_manager->file_handle->FileSize()),
       error_handler(make_shared_ptr<CSVErrorHandler>(options_p.ignore_errors.GetValue())),
@@ -23,7 +24,7 @@ CSVFileScan::CSVFileScan(ClientContext &context, shared_ptr<CSVBufferManager> bu
 		options = union_reader.options;
 		types = union_reader.GetTypes();
 		multi_file_reader->InitializeReader(*this, options.file_options, bind_data.reader_bind, bind_data.return_types,
-		                                    bind_data.return_names, column_ids, nullptr, file_path, context, nullptr);
+		                                    bind_data.return_names, column_ids, filters, file_path, context, nullptr);
 		InitializeFileNamesTypes();
 		return;
 	}
@@ -32,7 +33,7 @@ CSVFileScan::CSVFileScan(ClientContext &context, shared_ptr<CSVBufferManager> bu
 		names = bind_data.column_info[0].names;
 		types = bind_data.column_info[0].types;
 		multi_file_reader->InitializeReader(*this, options.file_options, bind_data.reader_bind, bind_data.return_types,
-		                                    bind_data.return_names, column_ids, nullptr, file_path, context, nullptr);
+		                                    bind_data.return_names, column_ids, filters, file_path, context, nullptr);
 		InitializeFileNamesTypes();
 		return;
 	}
@@ -40,7 +41,7 @@ CSVFileScan::CSVFileScan(ClientContext &context, shared_ptr<CSVBufferManager> bu
 	types = bind_data.csv_types;
 	file_schema.Initialize(names, types, file_path);
 	multi_file_reader->InitializeReader(*this, options.file_options, bind_data.reader_bind, bind_data.return_types,
-	                                    bind_data.return_names, column_ids, nullptr, file_path, context, nullptr);
+	                                    bind_data.return_names, column_ids, filters, file_path, context, nullptr);
 
 	InitializeFileNamesTypes();
 	SetStart();
@@ -61,7 +62,7 @@ void CSVFileScan::SetStart() {
 
 CSVFileScan::CSVFileScan(ClientContext &context, const string &file_path_p, const CSVReaderOptions &options_p,
                          const idx_t file_idx_p, const ReadCSVData &bind_data, const vector<column_t> &column_ids,
-                         CSVSchema &file_schema, bool per_file_single_threaded)
+                         CSVSchema &file_schema, bool per_file_single_threaded, optional_ptr<TableFilterSet> filters)
     : file_path(file_path_p), file_idx(file_idx_p),
       error_handler(make_shared_ptr<CSVErrorHandler>(options_p.ignore_errors.GetValue())), options(options_p) {
 	auto multi_file_reader = MultiFileReader::CreateDefault("CSV Scan");
@@ -77,7 +78,7 @@ CSVFileScan::CSVFileScan(ClientContext &context, const string &file_path_p, cons
 		types = union_reader.GetTypes();
 		state_machine = union_reader.state_machine;
 		multi_file_reader->InitializeReader(*this, options.file_options, bind_data.reader_bind, bind_data.return_types,
-		                                    bind_data.return_names, column_ids, nullptr, file_path, context, nullptr);
+		                                    bind_data.return_names, column_ids, filters, file_path, context, nullptr);
 
 		InitializeFileNamesTypes();
 		SetStart();
@@ -113,7 +114,7 @@ CSVFileScan::CSVFileScan(ClientContext &context, const string &file_path_p, cons
 		    state_machine_cache.Get(options.dialect_options.state_machine_options), options);
 
 		multi_file_reader->InitializeReader(*this, options.file_options, bind_data.reader_bind, bind_data.return_types,
-		                                    bind_data.return_names, column_ids, nullptr, file_path, context, nullptr);
+		                                    bind_data.return_names, column_ids, filters, file_path, context, nullptr);
 		InitializeFileNamesTypes();
 		SetStart();
 		return;
@@ -144,7 +145,7 @@ CSVFileScan::CSVFileScan(ClientContext &context, const string &file_path_p, cons
 	state_machine = make_shared_ptr<CSVStateMachine>(
 	    state_machine_cache.Get(options.dialect_options.state_machine_options), options);
 	multi_file_reader->InitializeReader(*this, options.file_options, bind_data.reader_bind, bind_data.return_types,
-	                                    bind_data.return_names, column_ids, nullptr, file_path, context, nullptr);
+	                                    bind_data.return_names, column_ids, filters, file_path, context, nullptr);
 	InitializeFileNamesTypes();
 	SetStart();
 }
@@ -1,6 +1,8 @@
 #include "duckdb/execution/operator/join/physical_hash_join.hpp"
 
 #include "duckdb/common/radix_partitioning.hpp"
+#include "duckdb/common/types/value_map.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/execution/expression_executor.hpp"
 #include "duckdb/execution/operator/aggregate/ungrouped_aggregate_state.hpp"
 #include "duckdb/function/aggregate/distributive_functions.hpp"
@@ -14,6 +16,8 @@
 #include "duckdb/parallel/thread_context.hpp"
 #include "duckdb/planner/expression/bound_aggregate_expression.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/planner/filter/bloom_filter.hpp"
+#include "duckdb/planner/filter/in_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
 #include "duckdb/planner/filter/null_filter.hpp"
 #include "duckdb/planner/table_filter.hpp"
@@ -560,7 +564,83 @@ public:
 	}
 };
 
-void JoinFilterPushdownInfo::PushFilters(JoinFilterGlobalState &gstate, const PhysicalOperator &op) const {
+void JoinFilterPushdownInfo::PushMembershipFilters(JoinHashTable &ht, const vector<idx_t> &filter_idxs,
+                                                   const PhysicalOperator &op) const {
+	// columns with few distinct keys get an exact IN filter, the other columns get an approximate bloom filter
+	vector<column_t> column_ids;
+	vector<shared_ptr<BlockedBloomFilter>> bloom_filters;
+	vector<unordered_set<hash_t>> distinct_hashes(filter_idxs.size());
+	for (auto &filter_idx : filter_idxs) {
+		column_ids.push_back(filters[filter_idx].join_condition);
+		bloom_filters.push_back(make_shared_ptr<BlockedBloomFilter>(ht.Count()));
+	}
+	auto &data_collection = ht.GetDataCollection();
+	TupleDataScanState scan_state;
+	data_collection.InitializeScan(scan_state, column_ids);
+	DataChunk keys;
+	data_collection.InitializeScanChunk(scan_state, keys);
+
+	// scan the join keys of the filter columns from the hash table
+	// we build the bloom filters and count the distinct hashes of the keys in a single pass
+	Vector hashes(LogicalType::HASH);
+	auto hash_data = FlatVector::GetData<hash_t>(hashes);
+	while (data_collection.Scan(scan_state, keys)) {
+		for (idx_t col_idx = 0; col_idx < column_ids.size(); col_idx++) {
+			auto &key_vector = keys.data[col_idx];
+			VectorOperations::Hash(key_vector, hashes, keys.size());
+			bloom_filters[col_idx]->Insert(hashes, keys.size());
+
+			auto &column_hashes = distinct_hashes[col_idx];
+			if (column_hashes.size() > IN_FILTER_MAX_DISTINCT_KEYS) {
+				// too many distinct keys for an IN filter
+				continue;
+			}
+			for (idx_t row_idx = 0; row_idx < keys.size(); row_idx++) {
+				column_hashes.insert(hash_data[row_idx]);
+			}
+		}
+	}
+
+	vector<idx_t> in_filter_cols;
+	for (idx_t col_idx = 0; col_idx < column_ids.size(); col_idx++) {
+		if (distinct_hashes[col_idx].size() <= IN_FILTER_MAX_DISTINCT_KEYS) {
+			in_filter_cols.push_back(col_idx);
+		}
+	}
+	vector<value_set_t> in_values(column_ids.size());
+	if (!in_filter_cols.empty()) {
+		// collect the distinct (non-NULL) keys of the columns that get an IN filter
+		// we compare the actual values - equal hashes do not imply equal keys
+		data_collection.InitializeScan(scan_state, column_ids);
+		while (data_collection.Scan(scan_state, keys)) {
+			for (auto &col_idx : in_filter_cols) {
+				auto &key_vector = keys.data[col_idx];
+				for (idx_t row_idx = 0; row_idx < keys.size(); row_idx++) {
+					auto key = key_vector.GetValue(row_idx);
+					if (!key.IsNull()) {
+						in_values[col_idx].insert(std::move(key));
+					}
+				}
+			}
+		}
+	}
+
+	for (idx_t i = 0; i < filter_idxs.size(); i++) {
+		auto filter_col_idx = filters[filter_idxs[i]].probe_column_index.column_index;
+		if (distinct_hashes[i].size() > IN_FILTER_MAX_DISTINCT_KEYS) {
+			dynamic_filters->PushFilter(op, filter_col_idx, make_uniq<BloomFilter>(std::move(bloom_filters[i])));
+			continue;
+		}
+		vector<Value> values(in_values[i].begin(), in_values[i].end());
+		if (values.empty()) {
+			continue;
+		}
+		dynamic_filters->PushFilter(op, filter_col_idx, make_uniq<InFilter>(std::move(values)));
+	}
+}
+
+void JoinFilterPushdownInfo::PushFilters(JoinFilterGlobalState &gstate, JoinHashTable &ht,
+                                         const PhysicalOperator &op) const {
 	// finalize the min/max aggregates
 	vector<LogicalType> min_max_types;
 	for (auto &aggr_expr : min_max_aggregates) {
@@ -572,6 +652,7 @@ void JoinFilterPushdownInfo::PushFilters(JoinFilterGlobalState &gstate, const Ph
 	gstate.global_aggregate_state->Finalize(final_min_max);
 
 	// create a filter for each of the aggregates
+	vector<idx_t> membership_filter_idxs;
 	for (idx_t filter_idx = 0; filter_idx < filters.size(); filter_idx++) {
 		auto &filter = filters[filter_idx];
 		auto filter_col_idx = filter.probe_column_index.column_index;
@@ -597,10 +678,15 @@ void JoinFilterPushdownInfo::PushFilters(JoinFilterGlobalState &gstate, const Ph
 			dynamic_filters->PushFilter(op, filter_col_idx, std::move(greater_equals));
 			auto less_equals = make_uniq<ConstantFilter>(ExpressionType::COMPARE_LESSTHANOREQUALTO, std::move(max_val));
 			dynamic_filters->PushFilter(op, filter_col_idx, std::move(less_equals));
+			// the keys can be scattered over the range - also try to push a membership filter
+			membership_filter_idxs.push_back(filter_idx);
 		}
 		// not null filter
 		dynamic_filters->PushFilter(op, filter_col_idx, make_uniq<IsNotNullFilter>());
 	}
+	if (!membership_filter_idxs.empty() && ht.Count() <= BLOOM_FILTER_MAX_BUILD_SIZE) {
+		PushMembershipFilters(ht, membership_filter_idxs, op);
+	}
 }
 
 SinkFinalizeType PhysicalHashJoin::Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
@@ -646,7 +732,7 @@ SinkFinalizeType PhysicalHashJoin::Finalize(Pipeline &pipeline, Event &event, Cl
 	ht.Unpartition();
 
 	if (filter_pushdown && ht.Count() > 0) {
-		filter_pushdown->PushFilters(*sink.global_filter_state, *this);
+		filter_pushdown->PushFilters(*sink.global_filter_state, ht, *this);
 	}
 
 	// check for possible perfect hash table
@@ -120,6 +120,15 @@ double PhysicalTableScan::GetProgress(ClientContext &context, GlobalSourceState
 	return -1;
 }
 
+InsertionOrderPreservingMap<string> PhysicalTableScan::ExtraSourceParams(GlobalSourceState &gstate_p,
+                                                                       LocalSourceState &lstate) const {
+	auto &gstate = gstate_p.Cast<TableScanGlobalSourceState>();
+	if (function.dynamic_to_string) {
+		return function.dynamic_to_string(gstate.global_state.get());
+	}
+	return InsertionOrderPreservingMap<string>();
+}
+
 idx_t PhysicalTableScan::GetBatchIndex(ExecutionContext &context, DataChunk &chunk, GlobalSourceState &gstate_p,
                                        LocalSourceState &lstate) const {
 	D_ASSERT(SupportsBatchIndex());
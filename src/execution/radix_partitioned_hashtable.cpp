@@ -139,6 +139,11 @@ public:
 	static constexpr const double BLOCK_FILL_FACTOR = 1.8;
 	//! By how many bits to repartition if a repartition is triggered
 	static constexpr const idx_t REPARTITION_RADIX_BITS = 2;
+	//! If a thread-local HT fills up and the fraction of rows that created a new group exceeds this, pre-aggregation
+	//! is not reducing the data, and we skip the lookups (rows are then only aggregated when finalizing partitions)
+	static constexpr const double SKIP_LOOKUPS_THRESHOLD = 0.95;
+	//! After skipping lookups for this many HT fills, we try pre-aggregating again, as the data may have changed
+	static constexpr const idx_t SKIP_LOOKUPS_RETRY_FILLS = 8;
 };
 
 class RadixHTGlobalSinkState : public GlobalSinkState {
@@ -169,6 +174,8 @@ public:
 	const idx_t number_of_threads;
 	//! If any thread has called combine
 	atomic<bool> any_combined;
+	//! Number of rows that were sunk without looking up their group (pre-aggregation was skipped)
+	atomic<idx_t> skipped_lookup_count;
 
 	//! Uncombined partitioned data that will be put into the AggregatePartitions
 	unique_ptr<PartitionedTupleData> uncombined_data;
@@ -192,7 +199,7 @@ RadixHTGlobalSinkState::RadixHTGlobalSinkState(ClientContext &context_p, const R
     : context(context_p), temporary_memory_state(TemporaryMemoryManager::Get(context).Register(context)),
       radix_ht(radix_ht_p), config(context, *this), finalized(false), external(false), active_threads(0),
       number_of_threads(NumericCast<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads())),
-      any_combined(false), finalize_done(0), scan_pin_properties(TupleDataPinProperties::DESTROY_AFTER_DONE),
+      any_combined(false), skipped_lookup_count(0), finalize_done(0), scan_pin_properties(TupleDataPinProperties::DESTROY_AFTER_DONE),
       count_before_combining(0), max_partition_size(0) {
 
 	// Compute minimum reservation
@@ -330,9 +337,17 @@ public:
 
 	//! Data that is abandoned ends up here (only if we're doing external aggregation)
 	unique_ptr<PartitionedTupleData> abandoned_data;
+
+	//! Number of rows sunk into the HT since it was last reset
+	idx_t sink_count;
+	//! How many times the HT was filled while skipping lookups
+	idx_t skipped_fills;
+	//! Number of rows that were sunk while skipping lookups
+	idx_t skipped_lookup_count;
 };
 
-RadixHTLocalSinkState::RadixHTLocalSinkState(ClientContext &, const RadixPartitionedHashTable &radix_ht) {
+RadixHTLocalSinkState::RadixHTLocalSinkState(ClientContext &, const RadixPartitionedHashTable &radix_ht)
+    : sink_count(0), skipped_fills(0), skipped_lookup_count(0) {
 	// If there are no groups we create a fake group so everything has the same group
 	group_chunk.InitializeEmpty(radix_ht.group_types);
 	if (radix_ht.grouping_set.empty()) {
@@ -436,6 +451,22 @@ bool MaybeRepartition(ClientContext &context, RadixHTGlobalSinkState &gstate, Ra
 	return true;
 }
 
+void DecideSkipLookups(const RadixHTConfig &config, RadixHTLocalSinkState &lstate) {
+	auto &ht = *lstate.ht;
+	if (ht.SkipLookups()) {
+		if (++lstate.skipped_fills == config.SKIP_LOOKUPS_RETRY_FILLS) {
+			// Measure the reduction again
+			ht.SetSkipLookups(false);
+		}
+	} else if (static_cast<double>(ht.Count()) >
+	           config.SKIP_LOOKUPS_THRESHOLD * static_cast<double>(lstate.sink_count)) {
+		// Almost every row created a new group, so the lookups are just overhead
+		ht.SetSkipLookups(true);
+		lstate.skipped_fills = 0;
+	}
+	lstate.sink_count = 0;
+}
+
 void RadixPartitionedHashTable::Sink(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input,
                                      DataChunk &payload_input, const unsafe_vector<idx_t> &filter) const {
 	auto &gstate = input.global_state.Cast<RadixHTGlobalSinkState>();
@@ -450,12 +481,18 @@ void RadixPartitionedHashTable::Sink(ExecutionContext &context, DataChunk &chunk
 
 	auto &ht = *lstate.ht;
 	ht.AddChunk(group_chunk, payload_input, filter);
+	lstate.sink_count += group_chunk.size();
+	if (ht.SkipLookups()) {
+		lstate.skipped_lookup_count += group_chunk.size();
+	}
 
 	if (ht.Count() + STANDARD_VECTOR_SIZE < ht.ResizeThreshold()) {
 		return; // We can fit another chunk
 	}
 
 	if (gstate.number_of_threads > 2) {
+		// Decide whether pre-aggregating in the thread-local HT is worth it before we reset it
+		DecideSkipLookups(gstate.config, lstate);
 		// 'Reset' the HT without taking its data, we can just keep appending to the same collection
 		// This only works because we never resize the HT
 		ht.ClearPointerTable();
@@ -485,6 +522,7 @@ void RadixPartitionedHashTable::Combine(ExecutionContext &context, GlobalSinkSta
 
 	// Set any_combined, then check one last time whether we need to repartition
 	gstate.any_combined = true;
+	gstate.skipped_lookup_count += lstate.skipped_lookup_count;
 	MaybeRepartition(context.client, gstate, lstate);
 
 	auto &ht = *lstate.ht;
@@ -574,6 +612,11 @@ void RadixPartitionedHashTable::SetMultiScan(GlobalSinkState &sink_p) {
 	sink.scan_pin_properties = TupleDataPinProperties::UNPIN_AFTER_DONE;
 }
 
+idx_t RadixPartitionedHashTable::SkippedLookupCount(GlobalSinkState &sink_p) {
+	auto &sink = sink_p.Cast<RadixHTGlobalSinkState>();
+	return sink.skipped_lookup_count;
+}
+
 enum class RadixHTSourceTaskType : uint8_t { NO_TASK, FINALIZE, SCAN };
 
 class RadixHTLocalSourceState;
@@ -925,6 +925,7 @@ public:
 	bool IsConstantAggregate();
 	bool IsCustomAggregate();
 	bool IsDistinctAggregate();
+	bool IsRemovableAggregate();
 
 	WindowAggregateExecutorGlobalState(const WindowAggregateExecutor &executor, const idx_t payload_count,
 	                                   const ValidityMask &partition_mask, const ValidityMask &order_mask);
@@ -1020,6 +1021,40 @@ bool WindowAggregateExecutorGlobalState::IsCustomAggregate() {
 	return (mode < WindowAggregationMode::COMBINE);
 }
 
+static bool IsSlidingBoundary(WindowBoundary boundary, const unique_ptr<Expression> &expr) {
+	switch (boundary) {
+	case WindowBoundary::CURRENT_ROW_ROWS:
+		return true;
+	case WindowBoundary::EXPR_PRECEDING_ROWS:
+	case WindowBoundary::EXPR_FOLLOWING_ROWS:
+		//	Constant offsets move the frame by one row for every row
+		return expr->IsFoldable();
+	default:
+		return false;
+	}
+}
+
+bool WindowAggregateExecutorGlobalState::IsRemovableAggregate() {
+	const auto &wexpr = executor.wexpr;
+	const auto &mode = reinterpret_cast<const WindowAggregateExecutor &>(executor).mode;
+
+	if (!wexpr.aggregate || mode >= WindowAggregationMode::COMBINE) {
+		return false;
+	}
+
+	if (!WindowRemovableAggregator::CanRemove(AggregateObject(wexpr))) {
+		return false;
+	}
+
+	//	Excluded rows split the frame
+	if (wexpr.exclude_clause != WindowExcludeMode::NO_OTHER) {
+		return false;
+	}
+
+	//	Only frames that slide through the partition touch O(1) rows per row
+	return IsSlidingBoundary(wexpr.start, wexpr.start_expr) && IsSlidingBoundary(wexpr.end, wexpr.end_expr);
+}
+
 void WindowExecutor::Evaluate(idx_t row_idx, DataChunk &input_chunk, Vector &result, WindowExecutorLocalState &lstate,
                               WindowExecutorGlobalState &gstate) const {
 	auto &lbstate = lstate.Cast<WindowExecutorBoundsState>();
@@ -1060,6 +1095,9 @@ WindowAggregateExecutorGlobalState::WindowAggregateExecutorGlobalState(const Win
 		aggregator = make_uniq<WindowConstantAggregator>(aggr, arg_types, return_type, wexpr.exclude_clause);
 	} else if (IsCustomAggregate()) {
 		aggregator = make_uniq<WindowCustomAggregator>(aggr, arg_types, return_type, wexpr.exclude_clause);
+	} else if (IsRemovableAggregate()) {
+		// add the rows entering and remove the rows leaving the sliding frame
+		aggregator = make_uniq<WindowRemovableAggregator>(aggr, arg_types, return_type, wexpr.exclude_clause);
 	} else {
 		// build a segment tree for frame-adhering aggregates
 		// see http://www.vldb.org/pvldb/vol8/p1058-leis.pdf
@@ -820,6 +820,242 @@ void WindowNaiveAggregator::Evaluate(const WindowAggregatorState &gsink, WindowA
 	lnstate.Evaluate(gnstate, bounds, result, count, row_idx);
 }
 
+//===--------------------------------------------------------------------===//
+// WindowRemovableAggregator
+//===--------------------------------------------------------------------===//
+WindowRemovableAggregator::WindowRemovableAggregator(AggregateObject aggr, const vector<LogicalType> &arg_types,
+                                                     const LogicalType &result_type,
+                                                     const WindowExcludeMode exclude_mode)
+    : WindowAggregator(std::move(aggr), arg_types, result_type, exclude_mode) {
+}
+
+WindowRemovableAggregator::~WindowRemovableAggregator() {
+}
+
+bool WindowRemovableAggregator::CanRemove(const AggregateObject &aggr) {
+	//	The frame state is copied into the result states, so the states cannot own any data
+	return aggr.function.inverse_update && aggr.function.combine && !aggr.function.destructor && !aggr.IsDistinct();
+}
+
+class WindowRemovableState : public WindowAggregatorState {
+public:
+	//! Rows that are added to (or removed from) the change states
+	struct UpdateBuffer {
+		explicit UpdateBuffer(aggregate_update_t update) : update(update), statep(LogicalType::POINTER), count(0) {
+			sel.Initialize();
+		}
+
+		//! The update (or inverse update) function of the aggregate
+		aggregate_update_t update;
+		//! The change state of each buffered row
+		Vector statep;
+		//! The buffered rows
+		SelectionVector sel;
+		//! Count of buffered rows
+		idx_t count;
+	};
+
+	explicit WindowRemovableState(const WindowRemovableAggregator &aggregator);
+	~WindowRemovableState() override;
+
+	void Evaluate(const WindowAggregatorGlobalState &gsink, const DataChunk &bounds, Vector &result, idx_t count);
+
+protected:
+	//! Whether the row is aggregated, i.e., it passes the filter and none of its arguments are NULL
+	static bool IsAggregated(const WindowAggregatorGlobalState &gsink, idx_t row);
+	//! Buffers the aggregated rows in [begin, end) for the change state, returns the number of buffered rows
+	idx_t Update(const WindowAggregatorGlobalState &gsink, UpdateBuffer &buffer, idx_t begin, idx_t end,
+	             data_ptr_t change_state);
+	//! Flush the buffered rows into the change states
+	void FlushStates(const WindowAggregatorGlobalState &gsink, UpdateBuffer &buffer);
+
+	//! The aggregator
+	const WindowRemovableAggregator &aggregator;
+	//! The state of the frame of the previous row
+	vector<data_t> frame_state;
+	//! The frame of the previous row, empty if there is none
+	idx_t frame_begin;
+	idx_t frame_end;
+	//! The number of aggregated rows in the frame of the previous row
+	idx_t frame_count;
+	//! For each row, the change to the previous frame state. These are then replaced by the result states.
+	vector<data_t> state;
+	//! Reused result state container for the aggregate
+	Vector statef;
+	//! Reused state pointers for combining the change states into the frame state
+	Vector changep;
+	Vector framep;
+	//! The rows entering and leaving the frames
+	UpdateBuffer added;
+	UpdateBuffer removed;
+	//! Input data chunk, used for updating the change states
+	DataChunk leaves;
+	//! For each row, the change to the number of aggregated rows in the frame
+	vector<int64_t> count_changes;
+	//! For each row, whether the change state replaces the frame state
+	vector<bool> resets;
+};
+
+WindowRemovableState::WindowRemovableState(const WindowRemovableAggregator &aggregator_p)
+    : aggregator(aggregator_p), frame_state(aggregator.state_size), frame_begin(0), frame_end(0), frame_count(0),
+      state(aggregator.state_size * STANDARD_VECTOR_SIZE), statef(LogicalType::POINTER),
+      changep(Value::POINTER(0)), framep(Value::POINTER(CastPointerToValue(frame_state.data()))),
+      added(aggregator.aggr.function.update), removed(aggregator.aggr.function.inverse_update),
+      count_changes(STANDARD_VECTOR_SIZE), resets(STANDARD_VECTOR_SIZE) {
+	auto &aggr = aggregator.aggr;
+	aggr.function.initialize(aggr.function, frame_state.data());
+
+	if (!aggregator.arg_types.empty()) {
+		leaves.Initialize(Allocator::DefaultAllocator(), aggregator.arg_types);
+	}
+
+	//	Build the finalise vector that just points to the result states
+	data_ptr_t state_ptr = state.data();
+	D_ASSERT(statef.GetVectorType() == VectorType::FLAT_VECTOR);
+	statef.SetVectorType(VectorType::CONSTANT_VECTOR);
+	statef.Flatten(STANDARD_VECTOR_SIZE);
+	auto fdata = FlatVector::GetData<data_ptr_t>(statef);
+	for (idx_t i = 0; i < STANDARD_VECTOR_SIZE; ++i) {
+		fdata[i] = state_ptr;
+		state_ptr += aggregator.state_size;
+	}
+}
+
+WindowRemovableState::~WindowRemovableState() {
+}
+
+bool WindowRemovableState::IsAggregated(const WindowAggregatorGlobalState &gsink, idx_t row) {
+	if (!gsink.filter_mask.RowIsValid(row)) {
+		return false;
+	}
+	for (auto &input : gsink.inputs.data) {
+		if (!FlatVector::Validity(input).RowIsValid(row)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+idx_t WindowRemovableState::Update(const WindowAggregatorGlobalState &gsink, UpdateBuffer &buffer, idx_t begin,
+                                   idx_t end, data_ptr_t change_state) {
+	auto pdata = FlatVector::GetData<data_ptr_t>(buffer.statep);
+
+	idx_t updated = 0;
+	for (auto row = begin; row < end; ++row) {
+		if (!IsAggregated(gsink, row)) {
+			continue;
+		}
+		pdata[buffer.count] = change_state;
+		buffer.sel.set_index(buffer.count++, row);
+		++updated;
+		if (buffer.count >= STANDARD_VECTOR_SIZE) {
+			FlushStates(gsink, buffer);
+		}
+	}
+
+	return updated;
+}
+
+void WindowRemovableState::FlushStates(const WindowAggregatorGlobalState &gsink, UpdateBuffer &buffer) {
+	if (!buffer.count) {
+		return;
+	}
+
+	auto &inputs = gsink.inputs;
+	if (inputs.ColumnCount()) {
+		leaves.Slice(inputs, buffer.sel, buffer.count);
+	}
+
+	auto &aggr = aggregator.aggr;
+	AggregateInputData aggr_input_data(aggr.GetFunctionData(), allocator);
+	buffer.update(leaves.data.data(), aggr_input_data, leaves.ColumnCount(), buffer.statep, buffer.count);
+
+	buffer.count = 0;
+}
+
+void WindowRemovableState::Evaluate(const WindowAggregatorGlobalState &gsink, const DataChunk &bounds, Vector &result,
+                                    idx_t count) {
+	auto &aggr = aggregator.aggr;
+	const auto state_size = aggregator.state_size;
+	auto window_begin = FlatVector::GetData<const idx_t>(bounds.data[WINDOW_BEGIN]);
+	auto window_end = FlatVector::GetData<const idx_t>(bounds.data[WINDOW_END]);
+	auto fdata = FlatVector::GetData<data_ptr_t>(statef);
+
+	//	First pass: collect the rows that enter and leave the frame of each row into its change state
+	for (idx_t rid = 0; rid < count; ++rid) {
+		auto change_state = fdata[rid];
+		aggr.function.initialize(aggr.function, change_state);
+
+		const auto begin = window_begin[rid];
+		const auto end = MaxValue(window_begin[rid], window_end[rid]);
+
+		//	Start from scratch if the frame does not overlap the previous frame,
+		//	or if sliding the previous frame would touch more rows than aggregating the frame
+		const auto overlaps = MaxValue(begin, frame_begin) < MinValue(end, frame_end);
+		const auto moved = MaxValue(begin, frame_begin) - MinValue(begin, frame_begin) +
+		                   (MaxValue(end, frame_end) - MinValue(end, frame_end));
+		resets[rid] = !overlaps || moved >= end - begin;
+
+		int64_t count_change = 0;
+		if (resets[rid]) {
+			count_change += int64_t(Update(gsink, added, begin, end, change_state));
+		} else {
+			if (begin < frame_begin) {
+				count_change += int64_t(Update(gsink, added, begin, frame_begin, change_state));
+			} else {
+				count_change -= int64_t(Update(gsink, removed, frame_begin, begin, change_state));
+			}
+			if (end > frame_end) {
+				count_change += int64_t(Update(gsink, added, frame_end, end, change_state));
+			} else {
+				count_change -= int64_t(Update(gsink, removed, end, frame_end, change_state));
+			}
+		}
+		count_changes[rid] = count_change;
+
+		frame_begin = begin;
+		frame_end = end;
+	}
+	FlushStates(gsink, added);
+	FlushStates(gsink, removed);
+
+	//	Second pass: apply the changes to the frame state in row order, and copy it into the result states
+	AggregateInputData aggr_input_data(aggr.GetFunctionData(), allocator);
+	auto cdata = FlatVector::GetData<data_ptr_t>(changep);
+	for (idx_t rid = 0; rid < count; ++rid) {
+		auto change_state = fdata[rid];
+		if (resets[rid]) {
+			memcpy(frame_state.data(), change_state, state_size);
+			frame_count = UnsafeNumericCast<idx_t>(count_changes[rid]);
+		} else {
+			cdata[0] = change_state;
+			aggr.function.combine(changep, framep, aggr_input_data, 1);
+			frame_count = UnsafeNumericCast<idx_t>(int64_t(frame_count) + count_changes[rid]);
+		}
+
+		//	Frames without any aggregated rows produce the result of an empty aggregate (e.g., NULL for SUM)
+		if (frame_count) {
+			memcpy(change_state, frame_state.data(), state_size);
+		} else {
+			aggr.function.initialize(aggr.function, change_state);
+		}
+	}
+
+	//	Finalise the result aggregates and write to the result
+	aggr.function.finalize(statef, aggr_input_data, result, count, 0);
+}
+
+unique_ptr<WindowAggregatorState> WindowRemovableAggregator::GetLocalState(const WindowAggregatorState &gstate) const {
+	return make_uniq<WindowRemovableState>(*this);
+}
+
+void WindowRemovableAggregator::Evaluate(const WindowAggregatorState &gsink, WindowAggregatorState &lstate,
+                                         const DataChunk &bounds, Vector &result, idx_t count, idx_t row_idx) const {
+	const auto &gasink = gsink.Cast<WindowAggregatorGlobalState>();
+	auto &lrstate = lstate.Cast<WindowRemovableState>();
+	lrstate.Evaluate(gasink, bounds, result, count);
+}
+
 //===--------------------------------------------------------------------===//
 // WindowSegmentTree
 //===--------------------------------------------------------------------===//
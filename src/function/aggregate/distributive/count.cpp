@@ -139,6 +139,19 @@ struct CountFunction : public BaseCountFunction {
 		}
 	}
 
+	static void CountScatterInverse(Vector inputs[], AggregateInputData &aggr_input_data, idx_t input_count,
+	                                Vector &states, idx_t count) {
+		UnifiedVectorFormat idata, sdata;
+		inputs[0].ToUnifiedFormat(count, idata);
+		states.ToUnifiedFormat(count, sdata);
+		auto state_data = reinterpret_cast<STATE **>(sdata.data);
+		for (idx_t i = 0; i < count; i++) {
+			if (idata.validity.RowIsValid(idata.sel->get_index(i))) {
+				*state_data[sdata.sel->get_index(i)] -= 1;
+			}
+		}
+	}
+
 	static inline void CountFlatUpdateLoop(STATE &result, ValidityMask &mask, idx_t count) {
 		idx_t base_idx = 0;
 		auto entry_count = ValidityMask::EntryCount(count);
@@ -217,6 +230,7 @@ AggregateFunction CountFun::GetFunction() {
 	                      AggregateFunction::StateFinalize<int64_t, int64_t, CountFunction>,
 	                      FunctionNullHandling::SPECIAL_HANDLING, CountFunction::CountUpdate);
 	fun.name = "count";
+	fun.inverse_update = CountFunction::CountScatterInverse;
 	fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
 	return fun;
 }
@@ -196,7 +196,8 @@ static unique_ptr<GlobalTableFunctionState> ReadCSVInitGlobal(ClientContext &con
 		return nullptr;
 	}
 	return make_uniq<CSVGlobalState>(context, bind_data.buffer_manager, bind_data.options,
-	                                 context.db->NumberOfThreads(), bind_data.files, input.column_ids, bind_data);
+	                                 context.db->NumberOfThreads(), bind_data.files, input.column_ids, bind_data,
+	                                 input.filters);
 }
 
 unique_ptr<LocalTableFunctionState> ReadCSVInitLocal(ExecutionContext &context, TableFunctionInitInput &input,
@@ -368,6 +369,10 @@ TableFunction ReadCSVTableFunction::GetFunction() {
 	read_csv.get_batch_index = CSVReaderGetBatchIndex;
 	read_csv.cardinality = CSVReaderCardinality;
 	read_csv.projection_pushdown = true;
+	// Pushed down filters are evaluated on the parsed chunk, before the values are cast to their final types. Every
+	// row is still tokenized and primitive types are converted while tokenizing, so the filters only save the casts
+	// after parsing (e.g., HUGEINT, nested and JSON types) of the rows they remove - not the parsing itself.
+	read_csv.filter_pushdown = true;
 	read_csv.type_pushdown = PushdownTypeToCSVScanner;
 	ReadCSVAddNamedParameters(read_csv);
 	return read_csv;
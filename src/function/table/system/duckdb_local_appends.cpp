@@ -0,0 +1,70 @@
+#include "duckdb/function/table/system_functions.hpp"
+
+#include "duckdb/catalog/catalog.hpp"
+#include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
+#include "duckdb/parser/qualified_name.hpp"
+#include "duckdb/storage/data_table.hpp"
+#include "duckdb/storage/table/scan_state.hpp"
+#include "duckdb/transaction/duck_transaction.hpp"
+#include "duckdb/transaction/local_storage.hpp"
+
+namespace duckdb {
+
+struct DuckDBLocalAppendsBindData : public TableFunctionData {
+	explicit DuckDBLocalAppendsBindData(TableCatalogEntry &table) : table(table) {
+	}
+
+	TableCatalogEntry &table;
+};
+
+struct DuckDBLocalAppendsData : public GlobalTableFunctionState {
+	TableScanState scan_state;
+};
+
+static unique_ptr<FunctionData> DuckDBLocalAppendsBind(ClientContext &context, TableFunctionBindInput &input,
+                                                       vector<LogicalType> &return_types, vector<string> &names) {
+	if (input.inputs[0].IsNull()) {
+		throw BinderException("duckdb_local_appends requires a table name");
+	}
+	auto qname = QualifiedName::Parse(StringValue::Get(input.inputs[0]));
+	auto &table = Catalog::GetEntry<TableCatalogEntry>(context, qname.catalog, qname.schema, qname.name);
+	if (!table.IsDuckTable()) {
+		throw BinderException("duckdb_local_appends can only be used on DuckDB tables");
+	}
+	for (auto &column : table.GetColumns().Physical()) {
+		names.push_back(column.Name());
+		return_types.push_back(column.Type());
+	}
+	return make_uniq<DuckDBLocalAppendsBindData>(table);
+}
+
+unique_ptr<GlobalTableFunctionState> DuckDBLocalAppendsInit(ClientContext &context, TableFunctionInitInput &input) {
+	auto &bind_data = input.bind_data->Cast<DuckDBLocalAppendsBindData>();
+	auto result = make_uniq<DuckDBLocalAppendsData>();
+
+	auto &storage = bind_data.table.GetStorage();
+	auto &transaction = DuckTransaction::Get(context, bind_data.table.catalog);
+	vector<storage_t> column_ids;
+	for (idx_t i = 0; i < bind_data.table.GetColumns().PhysicalColumnCount(); i++) {
+		column_ids.push_back(i);
+	}
+	// only the rows appended by the current transaction are scanned - these live in the transaction-local storage
+	result->scan_state.checkpoint_lock = transaction.SharedLockTable(*storage.GetDataTableInfo());
+	result->scan_state.Initialize(std::move(column_ids));
+	LocalStorage::Get(transaction).InitializeScan(storage, result->scan_state.local_state, nullptr);
+	return std::move(result);
+}
+
+void DuckDBLocalAppendsFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &bind_data = data_p.bind_data->Cast<DuckDBLocalAppendsBindData>();
+	auto &data = data_p.global_state->Cast<DuckDBLocalAppendsData>();
+	auto &transaction = DuckTransaction::Get(context, bind_data.table.catalog);
+	LocalStorage::Get(transaction).Scan(data.scan_state.local_state, data.scan_state.GetColumnIds(), output);
+}
+
+void DuckDBLocalAppendsFun::RegisterFunction(BuiltinFunctions &set) {
+	set.AddFunction(TableFunction("duckdb_local_appends", {LogicalType::VARCHAR}, DuckDBLocalAppendsFunction,
+	                              DuckDBLocalAppendsBind, DuckDBLocalAppendsInit));
+}
+
+} // namespace duckdb
@@ -1,5 +1,6 @@
 #include "duckdb/function/table/system_functions.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
+#include "duckdb/storage/buffer/buffer_pool.hpp"
 
 namespace duckdb {
 
@@ -8,6 +9,7 @@ struct DuckDBMemoryData : public GlobalTableFunctionState {
 	}
 
 	vector<MemoryInformation> entries;
+	BufferEvictionPolicy eviction_policy;
 	idx_t offset;
 };
 
@@ -22,13 +24,27 @@ static unique_ptr<FunctionData> DuckDBMemoryBind(ClientContext &context, TableFu
 	names.emplace_back("temporary_storage_bytes");
 	return_types.emplace_back(LogicalType::BIGINT);
 
+	names.emplace_back("eviction_policy");
+	return_types.emplace_back(LogicalType::VARCHAR);
+
+	names.emplace_back("buffer_hits");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("buffer_misses");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("buffer_evictions");
+	return_types.emplace_back(LogicalType::BIGINT);
+
 	return nullptr;
 }
 
 unique_ptr<GlobalTableFunctionState> DuckDBMemoryInit(ClientContext &context, TableFunctionInitInput &input) {
 	auto result = make_uniq<DuckDBMemoryData>();
 
-	result->entries = BufferManager::GetBufferManager(context).GetMemoryUsageInfo();
+	auto &buffer_manager = BufferManager::GetBufferManager(context);
+	result->entries = buffer_manager.GetMemoryUsageInfo();
+	result->eviction_policy = buffer_manager.GetBufferPool().GetEvictionPolicy();
 	return std::move(result);
 }
 
@@ -51,6 +67,14 @@ void DuckDBMemoryFunction(ClientContext &context, TableFunctionInput &data_p, Da
 		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.size)));
 		// temporary_storage_bytes, BIGINT
 		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.evicted_data)));
+		// eviction_policy, VARCHAR
+		output.SetValue(col++, count, EnumUtil::ToString(data.eviction_policy));
+		// buffer_hits, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.buffer_hits)));
+		// buffer_misses, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.buffer_misses)));
+		// buffer_evictions, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.buffer_evictions)));
 		count++;
 	}
 	output.SetCardinality(count);
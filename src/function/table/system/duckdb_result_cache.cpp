@@ -0,0 +1,78 @@
+#include "duckdb/function/table/system_functions.hpp"
+#include "duckdb/main/result_cache.hpp"
+
+namespace duckdb {
+
+struct DuckDBResultCacheData : public GlobalTableFunctionState {
+	DuckDBResultCacheData() : finished(false) {
+	}
+
+	ResultCacheStatistics statistics;
+	bool finished;
+};
+
+static unique_ptr<FunctionData> DuckDBResultCacheBind(ClientContext &context, TableFunctionBindInput &input,
+                                                      vector<LogicalType> &return_types, vector<string> &names) {
+	names.emplace_back("hits");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("misses");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("entries");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("memory_usage_bytes");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("memory_limit_bytes");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("evictions");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("invalidations");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	return nullptr;
+}
+
+unique_ptr<GlobalTableFunctionState> DuckDBResultCacheInit(ClientContext &context, TableFunctionInitInput &input) {
+	auto result = make_uniq<DuckDBResultCacheData>();
+
+	result->statistics = ResultCache::Get(context).GetStatistics();
+	return std::move(result);
+}
+
+void DuckDBResultCacheFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &data = data_p.global_state->Cast<DuckDBResultCacheData>();
+	if (data.finished) {
+		// finished returning values
+		return;
+	}
+	auto &statistics = data.statistics;
+	idx_t col = 0;
+	// hits, BIGINT
+	output.SetValue(col++, 0, Value::BIGINT(NumericCast<int64_t>(statistics.hits)));
+	// misses, BIGINT
+	output.SetValue(col++, 0, Value::BIGINT(NumericCast<int64_t>(statistics.misses)));
+	// entries, BIGINT
+	output.SetValue(col++, 0, Value::BIGINT(NumericCast<int64_t>(statistics.entries)));
+	// memory_usage_bytes, BIGINT
+	output.SetValue(col++, 0, Value::BIGINT(NumericCast<int64_t>(statistics.memory_usage)));
+	// memory_limit_bytes, BIGINT
+	output.SetValue(col++, 0, Value::BIGINT(NumericCast<int64_t>(statistics.memory_limit)));
+	// evictions, BIGINT
+	output.SetValue(col++, 0, Value::BIGINT(NumericCast<int64_t>(statistics.evictions)));
+	// invalidations, BIGINT
+	output.SetValue(col++, 0, Value::BIGINT(NumericCast<int64_t>(statistics.invalidations)));
+	output.SetCardinality(1);
+	data.finished = true;
+}
+
+void DuckDBResultCacheFun::RegisterFunction(BuiltinFunctions &set) {
+	set.AddFunction(TableFunction("duckdb_result_cache", {}, DuckDBResultCacheFunction, DuckDBResultCacheBind,
+	                              DuckDBResultCacheInit));
+}
+
+} // namespace duckdb
@@ -0,0 +1,89 @@
+#include "duckdb/function/table/system_functions.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
+
+namespace duckdb {
+
+struct DuckDBSchedulerData : public GlobalTableFunctionState {
+	DuckDBSchedulerData() : offset(0) {
+	}
+
+	vector<SchedulerWorkerInfo> entries;
+	idx_t offset;
+};
+
+static unique_ptr<FunctionData> DuckDBSchedulerBind(ClientContext &context, TableFunctionBindInput &input,
+                                                    vector<LogicalType> &return_types, vector<string> &names) {
+	names.emplace_back("worker_id");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("numa_node");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("queued_tasks");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("scheduled_tasks");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("executed_tasks");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("stolen_tasks");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("failed_steals");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("lock_contention");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	return nullptr;
+}
+
+unique_ptr<GlobalTableFunctionState> DuckDBSchedulerInit(ClientContext &context, TableFunctionInitInput &input) {
+	auto result = make_uniq<DuckDBSchedulerData>();
+
+	result->entries = TaskScheduler::GetScheduler(context).GetWorkerInfo();
+	return std::move(result);
+}
+
+void DuckDBSchedulerFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &data = data_p.global_state->Cast<DuckDBSchedulerData>();
+	if (data.offset >= data.entries.size()) {
+		// finished returning values
+		return;
+	}
+	// start returning values
+	// either fill up the chunk or return all the remaining columns
+	idx_t count = 0;
+	while (data.offset < data.entries.size() && count < STANDARD_VECTOR_SIZE) {
+		auto &entry = data.entries[data.offset++];
+		// return values:
+		idx_t col = 0;
+		// worker_id, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.worker_id)));
+		// numa_node, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.numa_node)));
+		// queued_tasks, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.queued_tasks)));
+		// scheduled_tasks, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.scheduled_tasks)));
+		// executed_tasks, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.executed_tasks)));
+		// stolen_tasks, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.stolen_tasks)));
+		// failed_steals, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.failed_steals)));
+		// lock_contention, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.lock_contention)));
+		count++;
+	}
+	output.SetCardinality(count);
+}
+
+void DuckDBSchedulerFun::RegisterFunction(BuiltinFunctions &set) {
+	set.AddFunction(
+	    TableFunction("duckdb_scheduler", {}, DuckDBSchedulerFunction, DuckDBSchedulerBind, DuckDBSchedulerInit));
+}
+
+} // namespace duckdb
@@ -6,12 +6,18 @@
 #include "duckdb/common/serializer/deserializer.hpp"
 #include "duckdb/common/serializer/serializer.hpp"
 #include "duckdb/execution/index/art/art.hpp"
+#include "duckdb/execution/index/art/art_key.hpp"
 #include "duckdb/function/function_set.hpp"
 #include "duckdb/main/attached_database.hpp"
 #include "duckdb/main/client_config.hpp"
 #include "duckdb/optimizer/matcher/expression_matcher.hpp"
 #include "duckdb/planner/expression/bound_between_expression.hpp"
 #include "duckdb/planner/expression_iterator.hpp"
+#include "duckdb/planner/filter/conjunction_filter.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/in_filter.hpp"
+#include "duckdb/parser/constraints/not_null_constraint.hpp"
+#include "duckdb/storage/table/column_segment.hpp"
 #include "duckdb/planner/operator/logical_get.hpp"
 #include "duckdb/storage/data_table.hpp"
 #include "duckdb/storage/table/scan_state.hpp"
@@ -32,6 +38,8 @@ struct TableScanLocalState : public LocalTableFunctionState {
 	TableScanState scan_state;
 	//! The DataChunk containing all read columns (even filter columns that are immediately removed)
 	DataChunk all_columns;
+	//! The fetch state, used when fetching rows by row id
+	ColumnFetchState fetch_state;
 };
 
 static storage_t GetStorageIndex(TableCatalogEntry &table, column_t column_id) {
@@ -55,6 +63,19 @@ struct TableScanGlobalState : public GlobalTableFunctionState {
 	vector<idx_t> projection_ids;
 	vector<LogicalType> scanned_types;
 
+	//! The table filters to apply in the scan
+	optional_ptr<TableFilterSet> filters;
+	//! The table filters excluding the filters on the row id column (if there were any)
+	unique_ptr<TableFilterSet> table_filters;
+	//! Whether or not the row ids to emit are known up front (see TableScanExtractRowIds)
+	bool fetch_rows = false;
+	//! The (sorted) row ids to fetch
+	vector<row_t> fetch_row_ids;
+	//! The offset into the row ids
+	idx_t fetch_offset = 0;
+	//! Lock protecting the fetch offset
+	mutex fetch_lock;
+
 	idx_t MaxThreads() const override {
 		return max_threads;
 	}
@@ -73,10 +94,12 @@ static unique_ptr<LocalTableFunctionState> TableScanInitLocal(ExecutionContext &
 		auto storage_idx = GetStorageIndex(bind_data.table, col);
 		col = storage_idx;
 	}
-	result->scan_state.Initialize(std::move(column_ids), input.filters.get());
-	TableScanParallelStateNext(context.client, input.bind_data.get(), result.get(), gstate);
+	auto &tsgs = gstate->Cast<TableScanGlobalState>();
+	result->scan_state.Initialize(std::move(column_ids), tsgs.filters);
+	if (!tsgs.fetch_rows) {
+		TableScanParallelStateNext(context.client, input.bind_data.get(), result.get(), gstate);
+	}
 	if (input.CanRemoveFilterColumns()) {
-		auto &tsgs = gstate->Cast<TableScanGlobalState>();
 		result->all_columns.Initialize(context.client, tsgs.scanned_types);
 	}
 
@@ -85,11 +108,77 @@ static unique_ptr<LocalTableFunctionState> TableScanInitLocal(ExecutionContext &
 	return std::move(result);
 }
 
+//! Extracts the exact set of row ids from a filter on the row id column, if there is one
+static bool TableScanExtractRowIds(const TableFilter &filter, vector<row_t> &row_ids) {
+	switch (filter.filter_type) {
+	case TableFilterType::IN_FILTER: {
+		auto &in_filter = filter.Cast<InFilter>();
+		for (auto &value : in_filter.values) {
+			row_ids.push_back(value.GetValue<row_t>());
+		}
+		return true;
+	}
+	case TableFilterType::CONSTANT_COMPARISON: {
+		auto &constant_filter = filter.Cast<ConstantFilter>();
+		if (constant_filter.comparison_type != ExpressionType::COMPARE_EQUAL) {
+			return false;
+		}
+		row_ids.push_back(constant_filter.constant.GetValue<row_t>());
+		return true;
+	}
+	case TableFilterType::CONJUNCTION_AND: {
+		auto &conjunction = filter.Cast<ConjunctionAndFilter>();
+		for (auto &child_filter : conjunction.child_filters) {
+			if (TableScanExtractRowIds(*child_filter, row_ids)) {
+				return true;
+			}
+		}
+		return false;
+	}
+	default:
+		return false;
+	}
+}
+
+//! Filters on the row id column can only be pushed by joins on the row id (e.g. by late materialization)
+//! If the filter pins down the exact row ids, the rows are fetched by row id and the other filters are applied to the
+//! fetched rows. Otherwise the filter is ignored - the join will filter the rows anyway
+static void TableScanInitializeRowIdFilter(TableScanGlobalState &gstate, TableFunctionInitInput &input) {
+	gstate.filters = input.filters;
+	if (!input.filters) {
+		return;
+	}
+	optional_ptr<TableFilter> row_id_filter;
+	auto table_filters = make_uniq<TableFilterSet>();
+	for (auto &entry : input.filters->filters) {
+		if (IsRowIdColumnId(input.column_ids[entry.first])) {
+			row_id_filter = entry.second.get();
+			continue;
+		}
+		table_filters->filters[entry.first] = entry.second->Copy();
+	}
+	if (!row_id_filter) {
+		return;
+	}
+	gstate.fetch_rows = TableScanExtractRowIds(*row_id_filter, gstate.fetch_row_ids);
+	if (table_filters->filters.empty()) {
+		gstate.filters = nullptr;
+	} else {
+		gstate.table_filters = std::move(table_filters);
+		gstate.filters = gstate.table_filters.get();
+	}
+	if (gstate.fetch_rows) {
+		sort(gstate.fetch_row_ids.begin(), gstate.fetch_row_ids.end());
+		gstate.max_threads = 1;
+	}
+}
+
 unique_ptr<GlobalTableFunctionState> TableScanInitGlobal(ClientContext &context, TableFunctionInitInput &input) {
 	D_ASSERT(input.bind_data);
 	auto &bind_data = input.bind_data->Cast<TableScanBindData>();
 	auto result = make_uniq<TableScanGlobalState>(context, input.bind_data.get());
 	bind_data.table.GetStorage().InitializeParallelScan(context, result->state);
+	TableScanInitializeRowIdFilter(*result, input);
 	if (input.CanRemoveFilterColumns()) {
 		result->projection_ids = input.projection_ids;
 		const auto &columns = bind_data.table.GetColumns();
@@ -115,6 +204,70 @@ static unique_ptr<BaseStatistics> TableScanStatistics(ClientContext &context, co
 	return bind_data.table.GetStatistics(context, column_id);
 }
 
+//! Applies the table filters to rows that were fetched by row id
+static void TableScanFilterFetchedRows(const TableFilterSet &filters, DataChunk &chunk) {
+	SelectionVector sel;
+	sel.Initialize(nullptr);
+	idx_t approved_tuple_count = chunk.size();
+	for (auto &entry : filters.filters) {
+		auto &vector = chunk.data[entry.first];
+		UnifiedVectorFormat vdata;
+		vector.ToUnifiedFormat(chunk.size(), vdata);
+		ColumnSegment::FilterSelection(sel, vector, vdata, *entry.second, chunk.size(), approved_tuple_count);
+		if (approved_tuple_count == 0) {
+			break;
+		}
+	}
+	if (approved_tuple_count != chunk.size()) {
+		chunk.Slice(sel, approved_tuple_count);
+	}
+}
+
+static void TableScanFetchRows(ClientContext &context, const TableScanBindData &bind_data, TableScanGlobalState &gstate,
+                               TableScanLocalState &state, DataChunk &output) {
+	auto &transaction = DuckTransaction::Get(context, bind_data.table.catalog);
+	auto &storage = bind_data.table.GetStorage();
+	auto &column_ids = state.scan_state.GetColumnIds();
+	auto &result = gstate.CanRemoveFilterColumns() ? state.all_columns : output;
+
+	lock_guard<mutex> guard(gstate.fetch_lock);
+	// the chunk still holds the rows of the previous call - these must not be emitted again once all rows are fetched
+	result.Reset();
+	while (gstate.fetch_offset < gstate.fetch_row_ids.size()) {
+		// fetch the next batch of row ids - the row ids are sorted, so transaction-local rows come last
+		auto start = gstate.fetch_offset;
+		auto is_local = gstate.fetch_row_ids[start] >= MAX_ROW_ID;
+		auto end = start;
+		while (end < gstate.fetch_row_ids.size() && end - start < STANDARD_VECTOR_SIZE &&
+		       (gstate.fetch_row_ids[end] >= MAX_ROW_ID) == is_local) {
+			end++;
+		}
+		gstate.fetch_offset = end;
+
+		auto fetch_count = end - start;
+		Vector row_ids(LogicalType::ROW_TYPE, data_ptr_cast(gstate.fetch_row_ids.data() + start));
+		result.Reset();
+		if (is_local) {
+			auto &local_storage = LocalStorage::Get(transaction);
+			if (!local_storage.Find(storage)) {
+				continue;
+			}
+			local_storage.FetchChunk(storage, row_ids, fetch_count, column_ids, result, state.fetch_state);
+		} else {
+			storage.Fetch(transaction, result, column_ids, row_ids, fetch_count, state.fetch_state);
+		}
+		if (gstate.filters && result.size() > 0) {
+			TableScanFilterFetchedRows(*gstate.filters, result);
+		}
+		if (result.size() > 0) {
+			break;
+		}
+	}
+	if (gstate.CanRemoveFilterColumns()) {
+		output.ReferenceColumns(state.all_columns, gstate.projection_ids);
+	}
+}
+
 static void TableScanFunc(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
 	auto &bind_data = data_p.bind_data->Cast<TableScanBindData>();
 	auto &gstate = data_p.global_state->Cast<TableScanGlobalState>();
@@ -122,6 +275,10 @@ static void TableScanFunc(ClientContext &context, TableFunctionInput &data_p, Da
 	auto &transaction = DuckTransaction::Get(context, bind_data.table.catalog);
 	auto &storage = bind_data.table.GetStorage();
 
+	if (gstate.fetch_rows) {
+		TableScanFetchRows(context, bind_data, gstate, state, output);
+		return;
+	}
 	state.scan_state.options.force_fetch_row = ClientConfig::GetConfig(context).force_fetch_row;
 	do {
 		if (bind_data.is_create_index) {
@@ -271,6 +428,322 @@ static void IndexScanFunction(ClientContext &context, TableFunctionInput &data_p
 	}
 }
 
+//===--------------------------------------------------------------------===//
+// Ordered Index Scan
+//===--------------------------------------------------------------------===//
+struct OrderedIndexScanGlobalState : public GlobalTableFunctionState {
+	explicit OrderedIndexScanGlobalState(ClientContext &context) : arena_allocator(BufferAllocator::Get(context)) {
+	}
+
+	//! Prevents checkpoints from changing the table while the index is followed
+	unique_ptr<StorageLockKey> checkpoint_lock;
+	//! The index to follow
+	optional_ptr<ART> index;
+	ArenaAllocator arena_allocator;
+	//! The key of the constant values of the leading index columns
+	ARTKey prefix;
+	//! Keys exceeding the upper bound cannot be in the Top-N - empty until "limit" rows were produced
+	ARTKey upper_bound;
+	//! The physical type of the ordered column
+	PhysicalType order_type;
+	//! The index of the ordered column in the scanned columns
+	idx_t order_column_idx;
+	//! The number of rows of the Top-N
+	idx_t limit;
+	//! The last key that was scanned in the index
+	unsafe_vector<uint8_t> last_key;
+	bool index_finished = false;
+	//! The row ids of the scanned keys that still need to be fetched
+	unsafe_vector<row_t> row_ids;
+	idx_t row_ids_offset = 0;
+	//! The number of rows produced from the index
+	idx_t index_rows = 0;
+	ColumnFetchState fetch_state;
+	TableScanState local_storage_state;
+	bool local_storage_finished = false;
+	vector<storage_t> column_ids;
+	vector<idx_t> projection_ids;
+	optional_ptr<TableFilterSet> filters;
+	//! The DataChunk containing all read columns (even filter columns that are immediately removed)
+	DataChunk all_columns;
+};
+
+static unique_ptr<GlobalTableFunctionState> OrderedIndexScanInitGlobal(ClientContext &context,
+                                                                       TableFunctionInitInput &input) {
+	auto &bind_data = input.bind_data->Cast<TableScanBindData>();
+	auto &storage = bind_data.table.GetStorage();
+	auto &local_storage = LocalStorage::Get(context, bind_data.table.catalog);
+	auto result = make_uniq<OrderedIndexScanGlobalState>(context);
+
+	result->checkpoint_lock = storage.GetSharedCheckpointLock();
+	auto &info = storage.GetDataTableInfo();
+	info->GetIndexes().BindAndScan<ART>(context, *info, [&](ART &art_index) {
+		if (art_index.GetIndexName() != bind_data.ordered_index_name) {
+			return false;
+		}
+		result->index = art_index;
+		return true;
+	});
+	if (!result->index) {
+		throw InternalException("Could not find index \"%s\" for the ordered index scan", bind_data.ordered_index_name);
+	}
+	auto &index = *result->index;
+	auto &prefix = bind_data.ordered_index_prefix;
+	for (idx_t i = 0; i < prefix.size(); i++) {
+		auto value = prefix[i];
+		auto key = ARTKey::CreateKey(result->arena_allocator, index.types[i], value);
+		if (i == 0) {
+			result->prefix = key;
+		} else {
+			result->prefix.Concat(result->arena_allocator, key);
+		}
+	}
+	result->order_type = index.types[prefix.size()];
+	result->limit = bind_data.ordered_limit;
+
+	vector<LogicalType> types;
+	const auto &columns = bind_data.table.GetColumns();
+	result->order_column_idx = DConstants::INVALID_INDEX;
+	for (idx_t i = 0; i < input.column_ids.size(); i++) {
+		auto id = input.column_ids[i];
+		if (id == bind_data.ordered_column) {
+			result->order_column_idx = i;
+		}
+		types.push_back(id == COLUMN_IDENTIFIER_ROW_ID ? LogicalType::ROW_TYPE
+		                                               : columns.GetColumn(LogicalIndex(id)).Type());
+		result->column_ids.push_back(GetStorageIndex(bind_data.table, id));
+	}
+	if (result->order_column_idx == DConstants::INVALID_INDEX) {
+		throw InternalException("The ordered column is not scanned by the ordered index scan");
+	}
+	result->all_columns.Initialize(context, types);
+	result->filters = input.filters;
+	if (input.CanRemoveFilterColumns()) {
+		result->projection_ids = input.projection_ids;
+	}
+
+	result->local_storage_state.options.force_fetch_row = ClientConfig::GetConfig(context).force_fetch_row;
+	result->local_storage_state.Initialize(result->column_ids, input.filters.get());
+	local_storage.InitializeScan(storage, result->local_storage_state.local_state, input.filters);
+	return std::move(result);
+}
+
+//! Applies the table filters to the fetched rows
+static void OrderedIndexScanFilter(DataChunk &chunk, TableFilterSet &filters) {
+	SelectionVector sel;
+	sel.Initialize(nullptr);
+	idx_t approved_tuple_count = chunk.size();
+	for (auto &entry : filters.filters) {
+		if (approved_tuple_count == 0) {
+			break;
+		}
+		auto &vector = chunk.data[entry.first];
+		UnifiedVectorFormat vdata;
+		vector.ToUnifiedFormat(chunk.size(), vdata);
+		ColumnSegment::FilterSelection(sel, vector, vdata, *entry.second, chunk.size(), approved_tuple_count);
+	}
+	if (approved_tuple_count < chunk.size()) {
+		chunk.Slice(sel, approved_tuple_count);
+	}
+}
+
+static void OrderedIndexScanFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &bind_data = data_p.bind_data->Cast<TableScanBindData>();
+	auto &state = data_p.global_state->Cast<OrderedIndexScanGlobalState>();
+	auto &transaction = DuckTransaction::Get(context, bind_data.table.catalog);
+	auto &local_storage = LocalStorage::Get(transaction);
+	auto &result = state.projection_ids.empty() ? output : state.all_columns;
+
+	// transaction-local rows are not in the index - we produce all of them first
+	if (!state.local_storage_finished) {
+		result.Reset();
+		local_storage.Scan(state.local_storage_state.local_state, state.column_ids, result);
+		if (result.size() > 0) {
+			if (!state.projection_ids.empty()) {
+				output.ReferenceColumns(state.all_columns, state.projection_ids);
+			}
+			return;
+		}
+		state.local_storage_finished = true;
+	}
+
+	while (true) {
+		if (state.row_ids_offset == state.row_ids.size()) {
+			if (state.index_finished) {
+				return;
+			}
+			// until we know the upper bound, we only scan as many keys as are needed for the Top-N
+			idx_t max_count = STANDARD_VECTOR_SIZE;
+			if (state.upper_bound.Empty()) {
+				max_count = MinValue<idx_t>(max_count, state.limit - state.index_rows);
+			}
+			state.row_ids.clear();
+			state.row_ids_offset = 0;
+			state.index_finished =
+			    !state.index->ScanOrdered(state.prefix, state.upper_bound, max_count, state.row_ids, state.last_key);
+			if (state.row_ids.empty()) {
+				return;
+			}
+		}
+
+		auto fetch_count = MinValue<idx_t>(state.row_ids.size() - state.row_ids_offset, STANDARD_VECTOR_SIZE);
+		Vector row_ids(LogicalType::ROW_TYPE, data_ptr_cast(state.row_ids.data() + state.row_ids_offset));
+		state.row_ids_offset += fetch_count;
+		result.Reset();
+		bind_data.table.GetStorage().Fetch(transaction, result, state.column_ids, row_ids, fetch_count,
+		                                   state.fetch_state);
+		if (state.filters) {
+			OrderedIndexScanFilter(result, *state.filters);
+		}
+		if (result.size() == 0) {
+			continue;
+		}
+
+		if (state.upper_bound.Empty() && state.index_rows + result.size() >= state.limit) {
+			// we produced "limit" rows - the Top-N can only contain rows that are not ordered after the last of them
+			auto &order_column = result.data[state.order_column_idx];
+			auto value = order_column.GetValue(state.limit - state.index_rows - 1);
+			auto key = ARTKey::CreateKey(state.arena_allocator, state.order_type, value);
+			if (state.prefix.Empty()) {
+				state.upper_bound = key;
+			} else {
+				state.upper_bound = state.prefix;
+				state.upper_bound.Concat(state.arena_allocator, key);
+			}
+		}
+		state.index_rows += result.size();
+		if (!state.projection_ids.empty()) {
+			output.ReferenceColumns(state.all_columns, state.projection_ids);
+		}
+		return;
+	}
+}
+
+//! Returns the constant of an equality filter
+static bool TableScanGetEqualityConstant(const TableFilter &filter, Value &result) {
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON: {
+		auto &constant_filter = filter.Cast<ConstantFilter>();
+		if (constant_filter.comparison_type != ExpressionType::COMPARE_EQUAL) {
+			return false;
+		}
+		result = constant_filter.constant;
+		return true;
+	}
+	case TableFilterType::CONJUNCTION_AND: {
+		auto &conjunction = filter.Cast<ConjunctionAndFilter>();
+		for (auto &child_filter : conjunction.child_filters) {
+			if (TableScanGetEqualityConstant(*child_filter, result)) {
+				return true;
+			}
+		}
+		return false;
+	}
+	default:
+		return false;
+	}
+}
+
+//! Returns true, if the filter removes all NULL values
+static bool TableScanFilterRemovesNulls(const TableFilter &filter) {
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON:
+	case TableFilterType::IS_NOT_NULL:
+	case TableFilterType::IN_FILTER:
+		return true;
+	case TableFilterType::CONJUNCTION_AND: {
+		auto &conjunction = filter.Cast<ConjunctionAndFilter>();
+		for (auto &child_filter : conjunction.child_filters) {
+			if (TableScanFilterRemovesNulls(*child_filter)) {
+				return true;
+			}
+		}
+		return false;
+	}
+	default:
+		return false;
+	}
+}
+
+static bool TableScanColumnIsNotNull(TableCatalogEntry &table, const TableFilterSet &table_filters,
+                                     column_t column_id) {
+	for (auto &constraint : table.GetConstraints()) {
+		if (constraint->type == ConstraintType::NOT_NULL &&
+		    constraint->Cast<NotNullConstraint>().index.index == column_id) {
+			return true;
+		}
+	}
+	auto entry = table_filters.filters.find(column_id);
+	return entry != table_filters.filters.end() && TableScanFilterRemovesNulls(*entry->second);
+}
+
+//! Rewrites the scan below a Top-N into an ordered index scan, if there is an index on the ordered column
+//! Any leading columns of the index need to be fixed by an equality filter, e.g. an index on (tenant_id, created_at)
+//! for "WHERE tenant_id = 42 ORDER BY created_at LIMIT 50"
+void TableScanPushdownTopN(ClientContext &context, LogicalGet &get, FunctionData *bind_data_p, idx_t column_index,
+                           idx_t limit) {
+	auto &bind_data = bind_data_p->Cast<TableScanBindData>();
+	auto &table = bind_data.table;
+	auto &storage = table.GetStorage();
+
+	auto &config = ClientConfig::GetConfig(context);
+	if (!config.enable_optimizer) {
+		return;
+	}
+	if (bind_data.is_index_scan || bind_data.is_create_index) {
+		return;
+	}
+	auto order_column = get.GetColumnIds()[column_index];
+	if (IsRowIdColumnId(order_column)) {
+		return;
+	}
+	// NULL values are not in the index
+	if (!TableScanColumnIsNotNull(table, get.table_filters, order_column)) {
+		return;
+	}
+	// the rows are fetched one by one - only use the index if we fetch few rows
+	auto &db_config = DBConfig::GetConfig(context);
+	auto total_rows = storage.GetTotalRows();
+	auto total_rows_from_percentage =
+	    LossyNumericCast<idx_t>(double(total_rows) * db_config.options.index_scan_percentage);
+	if (limit > MaxValue(db_config.options.index_scan_max_count, total_rows_from_percentage)) {
+		return;
+	}
+
+	auto checkpoint_lock = storage.GetSharedCheckpointLock();
+	auto &info = storage.GetDataTableInfo();
+	info->GetIndexes().BindAndScan<ART>(context, *info, [&](ART &art_index) {
+		auto &index_column_ids = art_index.GetColumnIds();
+		vector<Value> prefix;
+		for (idx_t i = 0; i < art_index.unbound_expressions.size(); i++) {
+			auto &expr = *art_index.unbound_expressions[i];
+			if (expr.type != ExpressionType::BOUND_COLUMN_REF) {
+				return false;
+			}
+			auto index_column = index_column_ids[expr.Cast<BoundColumnRefExpression>().binding.column_index];
+			if (index_column == order_column) {
+				bind_data.ordered_index_name = art_index.GetIndexName();
+				bind_data.ordered_index_prefix = std::move(prefix);
+				bind_data.ordered_column = order_column;
+				bind_data.ordered_limit = limit;
+				get.function = TableScanFunction::GetOrderedIndexScanFunction();
+				return true;
+			}
+			// the leading index columns need to be fixed by an equality filter
+			auto entry = get.table_filters.filters.find(index_column);
+			Value constant;
+			if (entry == get.table_filters.filters.end() || !TableScanGetEqualityConstant(*entry->second, constant)) {
+				return false;
+			}
+			if (constant.type().InternalType() != art_index.types[i]) {
+				return false;
+			}
+			prefix.push_back(std::move(constant));
+		}
+		return false;
+	});
+}
+
 static void RewriteIndexExpression(Index &index, LogicalGet &get, Expression &expr, bool &rewrite_possible) {
 	if (expr.type == ExpressionType::BOUND_COLUMN_REF) {
 		auto &bound_colref = expr.Cast<BoundColumnRefExpression>();
@@ -384,6 +857,11 @@ static void TableScanSerialize(Serializer &serializer, const optional_ptr<Functi
 	serializer.WriteProperty(103, "is_index_scan", bind_data.is_index_scan);
 	serializer.WriteProperty(104, "is_create_index", bind_data.is_create_index);
 	serializer.WriteProperty(105, "result_ids", bind_data.row_ids);
+	serializer.WritePropertyWithDefault<string>(106, "ordered_index_name", bind_data.ordered_index_name);
+	serializer.WritePropertyWithDefault<vector<Value>>(107, "ordered_index_prefix", bind_data.ordered_index_prefix);
+	serializer.WritePropertyWithDefault<column_t>(108, "ordered_column", bind_data.ordered_column,
+	                                              column_t(DConstants::INVALID_INDEX));
+	serializer.WritePropertyWithDefault<idx_t>(109, "ordered_limit", bind_data.ordered_limit);
 }
 
 static unique_ptr<FunctionData> TableScanDeserialize(Deserializer &deserializer, TableFunction &function) {
@@ -399,6 +877,11 @@ static unique_ptr<FunctionData> TableScanDeserialize(Deserializer &deserializer,
 	deserializer.ReadProperty(103, "is_index_scan", result->is_index_scan);
 	deserializer.ReadProperty(104, "is_create_index", result->is_create_index);
 	deserializer.ReadProperty(105, "result_ids", result->row_ids);
+	deserializer.ReadPropertyWithDefault<string>(106, "ordered_index_name", result->ordered_index_name);
+	deserializer.ReadPropertyWithDefault<vector<Value>>(107, "ordered_index_prefix", result->ordered_index_prefix);
+	deserializer.ReadPropertyWithExplicitDefault<column_t>(108, "ordered_column", result->ordered_column,
+	                                                       column_t(DConstants::INVALID_INDEX));
+	deserializer.ReadPropertyWithDefault<idx_t>(109, "ordered_limit", result->ordered_limit);
 	return std::move(result);
 }
 
@@ -421,6 +904,27 @@ TableFunction TableScanFunction::GetIndexScanFunction() {
 	return scan_function;
 }
 
+TableFunction TableScanFunction::GetOrderedIndexScanFunction() {
+	TableFunction scan_function("ordered_index_scan", {}, OrderedIndexScanFunction);
+	scan_function.init_local = nullptr;
+	scan_function.init_global = OrderedIndexScanInitGlobal;
+	scan_function.statistics = TableScanStatistics;
+	scan_function.dependency = TableScanDependency;
+	scan_function.cardinality = TableScanCardinality;
+	scan_function.pushdown_complex_filter = nullptr;
+	scan_function.to_string = TableScanToString;
+	scan_function.table_scan_progress = nullptr;
+	scan_function.get_batch_index = nullptr;
+	scan_function.projection_pushdown = true;
+	scan_function.filter_pushdown = true;
+	scan_function.filter_prune = true;
+	scan_function.dynamic_filter_pushdown = true;
+	scan_function.get_bind_info = TableScanGetBindInfo;
+	scan_function.serialize = TableScanSerialize;
+	scan_function.deserialize = TableScanDeserialize;
+	return scan_function;
+}
+
 TableFunction TableScanFunction::GetFunction() {
 	TableFunction scan_function("seq_scan", {}, TableScanFunc);
 	scan_function.init_local = TableScanInitLocal;
@@ -429,6 +933,7 @@ TableFunction TableScanFunction::GetFunction() {
 	scan_function.dependency = TableScanDependency;
 	scan_function.cardinality = TableScanCardinality;
 	scan_function.pushdown_complex_filter = TableScanPushdownComplexFilter;
+	scan_function.pushdown_top_n = TableScanPushdownTopN;
 	scan_function.to_string = TableScanToString;
 	scan_function.table_scan_progress = TableScanProgress;
 	scan_function.get_batch_index = TableScanGetBatchIndex;
@@ -436,6 +941,8 @@ TableFunction TableScanFunction::GetFunction() {
 	scan_function.projection_pushdown = true;
 	scan_function.filter_pushdown = true;
 	scan_function.filter_prune = true;
+	scan_function.row_id_filter_pushdown = true;
+	scan_function.dynamic_filter_pushdown = true;
 	scan_function.serialize = TableScanSerialize;
 	scan_function.deserialize = TableScanDeserialize;
 	return scan_function;
@@ -447,6 +954,7 @@ void TableScanFunction::RegisterFunction(BuiltinFunctions &set) {
 	set.AddFunction(std::move(table_scan_set));
 
 	set.AddFunction(GetIndexScanFunction());
+	set.AddFunction(GetOrderedIndexScanFunction());
 }
 
 void BuiltinFunctions::RegisterTableScanFunctions() {
@@ -12,6 +12,7 @@
 #include "duckdb/common/unordered_map.hpp"
 #include "duckdb/parser/column_list.hpp"
 #include "duckdb/parser/constraint.hpp"
+#include "duckdb/parser/statement/select_statement.hpp"
 #include "duckdb/planner/bound_constraint.hpp"
 #include "duckdb/planner/expression.hpp"
 #include "duckdb/common/case_insensitive_map.hpp"
@@ -96,6 +97,13 @@ public:
 		return false;
 	}
 
+	//! Whether or not the table is a materialized view
+	bool IsMaterializedView() const {
+		return view_query != nullptr;
+	}
+	//! Returns the query of the materialized view
+	DUCKDB_API const SelectStatement &GetViewQuery() const;
+
 	DUCKDB_API static string ColumnsToSQL(const ColumnList &columns, const vector<unique_ptr<Constraint>> &constraints);
 
 	//! Returns a list of segment information for this table, if exists
@@ -112,5 +120,7 @@ protected:
 	ColumnList columns;
 	//! A list of constraints that are part of this table
 	vector<unique_ptr<Constraint>> constraints;
+	//! The query of a materialized view, or nullptr if the table is not a materialized view
+	unique_ptr<SelectStatement> view_query;
 };
 } // namespace duckdb
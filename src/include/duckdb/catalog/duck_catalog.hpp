@@ -31,6 +31,13 @@ public:
 	mutex &GetWriteLock() {
 		return write_lock;
 	}
+	//! Whether or not a materialized view has ever been created in this catalog
+	bool HasMaterializedViews() const {
+		return has_materialized_views;
+	}
+	void SetHasMaterializedViews() {
+		has_materialized_views = true;
+	}
 
 public:
 	DUCKDB_API optional_ptr<CatalogEntry> CreateSchema(CatalogTransaction transaction, CreateSchemaInfo &info) override;
@@ -74,6 +81,8 @@ private:
 	mutex write_lock;
 	//! The catalog set holding the schemas
 	unique_ptr<CatalogSet> schemas;
+	//! Whether or not a materialized view has ever been created - avoids scanning the catalog on every commit
+	atomic<bool> has_materialized_views;
 };
 
 } // namespace duckdb
@@ -23,6 +23,13 @@ typedef void (*initialize_t)(ArrowAppendData &result, const LogicalType &type, i
 typedef void (*append_vector_t)(ArrowAppendData &append_data, Vector &input, idx_t from, idx_t to, idx_t input_size);
 typedef void (*finalize_t)(ArrowAppendData &append_data, const LogicalType &type, ArrowArray *result);
 
+//! A variadic data buffer of an arrow string view array that references (part of) a string heap of a vector
+struct ArrowVariadicBuffer {
+	const_data_ptr_t data;
+	//! The number of bytes that are referenced by the string views
+	idx_t size;
+};
+
 // This struct is used to save state for appending a column
 // afterwards the ownership is passed to the arrow array, as 'private_data'
 // FIXME: we should separate the append state variables from the variables required by the ArrowArray into
@@ -77,6 +84,19 @@ struct ArrowAppendData {
 	//! Offset used to keep data positions when producing a mix of inlined and not-inlined arrow string views.
 	idx_t offset = 0;
 
+	//! Whether the memory of the appended vectors can be borrowed, i.e., they are not modified after being appended
+	bool zero_copy = false;
+	//! Fixed-width data that is borrowed from the appended vector instead of being copied into the main buffer
+	const_data_ptr_t borrowed_data = nullptr;
+	//! Vector buffers whose memory is referenced by the arrow buffers, these are kept alive until the array is released
+	vector<buffer_ptr<VectorBuffer>> borrowed_buffers;
+	//! The string heaps that are referenced by arrow string views (in addition to the auxiliary buffer)
+	vector<ArrowVariadicBuffer> variadic_buffers;
+	//! The variadic buffers that belong to the most recently referenced string heap start at this index
+	idx_t heap_buffer_start = 0;
+	//! The buffers of the arrow array if there are more than four (variadic buffers of arrow string views)
+	vector<const void *> buffer_pointers;
+
 private:
 	//! The buffers of the arrow vector
 	vector<ArrowBuffer> arrow_buffers;
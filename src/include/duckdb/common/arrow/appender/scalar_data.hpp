@@ -96,6 +96,12 @@ struct ArrowScalarBaseData {
 		auto data = UnifiedVectorFormat::GetData<SRC>(format);
 		auto result_data = main_buffer.GetData<TGT>();
 
+		if (IsBitwiseCopy() && !format.sel->IsSet()) {
+			// the layout of the (flat) input already matches the arrow layout
+			memcpy(result_data + append_data.row_count, data + from, sizeof(TGT) * size);
+			append_data.row_count += size;
+			return;
+		}
 		for (idx_t i = from; i < to; i++) {
 			auto source_idx = format.sel->get_index(i);
 			auto result_idx = append_data.row_count + i - from;
@@ -108,17 +114,64 @@ struct ArrowScalarBaseData {
 		}
 		append_data.row_count += size;
 	}
+
+	//! Whether the values are copied as-is, i.e., the memory of the input has the same layout as the arrow buffer
+	static constexpr bool IsBitwiseCopy() {
+		return std::is_same<TGT, SRC>::value && std::is_same<OP, ArrowScalarConverter>::value;
+	}
 };
 
 template <class TGT, class SRC = TGT, class OP = ArrowScalarConverter>
 struct ArrowScalarData : public ArrowScalarBaseData<TGT, SRC, OP> {
+	using BASE = ArrowScalarBaseData<TGT, SRC, OP>;
+
 	static void Initialize(ArrowAppendData &result, const LogicalType &type, idx_t capacity) {
 		result.GetMainBuffer().reserve(capacity * sizeof(TGT));
 	}
 
+	static bool CanBorrow(ArrowAppendData &append_data, Vector &input, idx_t from, idx_t to) {
+		if (!BASE::IsBitwiseCopy() || !append_data.zero_copy || append_data.row_count != 0) {
+			return false;
+		}
+		if (input.GetVectorType() != VectorType::FLAT_VECTOR) {
+			return false;
+		}
+		// the memory is kept alive by holding on to the buffer of the vector - this only holds if the buffer owns it
+		// e.g., scans can point the vector into memory of storage blocks or collections that the buffer does not own
+		auto buffer = input.GetBuffer();
+		auto data = FlatVector::GetData(input) + sizeof(TGT) * from;
+		return buffer && buffer->OwnsData(data, sizeof(TGT) * (to - from));
+	}
+
+	static void Append(ArrowAppendData &append_data, Vector &input, idx_t from, idx_t to, idx_t input_size) {
+		if (CanBorrow(append_data, input, from, to)) {
+			// zero-copy: the main buffer points directly into the vector, only the validity mask is copied
+			UnifiedVectorFormat format;
+			input.ToUnifiedFormat(input_size, format);
+			AppendValidity(append_data, format, from, to);
+			append_data.borrowed_data = FlatVector::GetData(input) + sizeof(TGT) * from;
+			append_data.borrowed_buffers.push_back(input.GetBuffer());
+			append_data.row_count += to - from;
+			return;
+		}
+		if (append_data.borrowed_data) {
+			// we are appending more data after borrowing - copy the borrowed data into the main buffer after all
+			auto &main_buffer = append_data.GetMainBuffer();
+			main_buffer.resize(sizeof(TGT) * append_data.row_count);
+			memcpy(main_buffer.data(), append_data.borrowed_data, sizeof(TGT) * append_data.row_count);
+			append_data.borrowed_data = nullptr;
+			append_data.borrowed_buffers.clear();
+		}
+		BASE::Append(append_data, input, from, to, input_size);
+	}
+
 	static void Finalize(ArrowAppendData &append_data, const LogicalType &type, ArrowArray *result) {
 		result->n_buffers = 2;
-		result->buffers[1] = append_data.GetMainBuffer().data();
+		if (append_data.borrowed_data) {
+			result->buffers[1] = append_data.borrowed_data;
+		} else {
+			result->buffers[1] = append_data.GetMainBuffer().data();
+		}
 	}
 };
 
@@ -118,12 +118,51 @@ struct ArrowVarcharData {
 };
 
 struct ArrowVarcharToStringViewData {
+	//! An arena chunk of the string heap of the appended vector, and the variadic buffer that references it
+	struct HeapChunk {
+		const_data_ptr_t start;
+		const_data_ptr_t end;
+		idx_t buffer_idx;
+	};
+
 	static void Initialize(ArrowAppendData &result, const LogicalType &type, idx_t capacity) {
 		result.GetMainBuffer().reserve((capacity) * sizeof(arrow_string_view_t));
 		result.GetAuxBuffer().reserve(capacity);
 		result.GetBufferSizeBuffer().reserve(sizeof(int64_t));
 	}
 
+	//! Adds the arena chunks of the string heap of the input as variadic buffers, so that the (non-inlined) strings
+	//! that are stored in there can be referenced instead of copied
+	static void ReferenceStringHeap(ArrowAppendData &append_data, Vector &input, vector<HeapChunk> &heap_chunks) {
+		reference<Vector> source(input);
+		while (source.get().GetVectorType() == VectorType::DICTIONARY_VECTOR) {
+			source = DictionaryVector::Child(source.get());
+		}
+		auto auxiliary = source.get().GetAuxiliary();
+		if (!auxiliary || auxiliary->GetBufferType() != VectorBufferType::STRING_BUFFER) {
+			return;
+		}
+		if (append_data.borrowed_buffers.empty() || append_data.borrowed_buffers.back() != auxiliary) {
+			// the string heap of a different vector - keep it alive with the array
+			append_data.heap_buffer_start = append_data.variadic_buffers.size();
+			append_data.borrowed_buffers.push_back(auxiliary);
+		}
+		auto &allocator = auxiliary->Cast<VectorStringBuffer>().GetStringHeap().GetAllocator();
+		for (auto chunk = allocator.GetHead(); chunk; chunk = chunk->next.get()) {
+			const_data_ptr_t chunk_data = chunk->data.get();
+			// the buffer index of the view is offset by one, index 0 refers to the auxiliary buffer
+			idx_t buffer_idx = append_data.heap_buffer_start;
+			while (buffer_idx < append_data.variadic_buffers.size() &&
+			       append_data.variadic_buffers[buffer_idx].data != chunk_data) {
+				buffer_idx++;
+			}
+			if (buffer_idx == append_data.variadic_buffers.size()) {
+				append_data.variadic_buffers.push_back(ArrowVariadicBuffer {chunk_data, 0});
+			}
+			heap_chunks.push_back(HeapChunk {chunk_data, chunk_data + chunk->maximum_size, buffer_idx + 1});
+		}
+	}
+
 	static void Append(ArrowAppendData &append_data, Vector &input, idx_t from, idx_t to, idx_t input_size) {
 		idx_t size = to - from;
 		UnifiedVectorFormat format;
@@ -135,6 +174,11 @@ struct ArrowVarcharToStringViewData {
 		ResizeValidity(validity_buffer, append_data.row_count + size);
 		auto validity_data = (uint8_t *)validity_buffer.data();
 
+		// strings in the string heap of the input are referenced in place (zero-copy)
+		vector<HeapChunk> heap_chunks;
+		ReferenceStringHeap(append_data, input, heap_chunks);
+		idx_t chunk_idx = 0;
+
 		main_buffer.resize(main_buffer.size() + sizeof(arrow_string_view_t) * (size));
 		// resize the offset buffer - the offset buffer holds the offsets into the child array
 		auto data = UnifiedVectorFormat::GetData<string_t>(format);
@@ -161,34 +205,73 @@ struct ArrowVarcharToStringViewData {
 				//  |------------|---------------------------------------|
 				//  | length     | data (padded with 0)                  |
 				arrow_data[result_idx] = arrow_string_view_t(UnsafeNumericCast<int32_t>(string_length), string_data);
-			} else {
-				// This string is not inlined, we have to check a different buffer and offsets
-				//  | Bytes 0-3  | Bytes 4-7  | Bytes 8-11 | Bytes 12-15 |
-				//  |------------|------------|------------|-------------|
-				//  | length     | prefix     | buf. index | offset      |
-				arrow_data[result_idx] = arrow_string_view_t(UnsafeNumericCast<int32_t>(string_length), string_data, 0,
-				                                             UnsafeNumericCast<int32_t>(append_data.offset));
-				auto current_offset = append_data.offset + string_length;
-				aux_buffer.resize(current_offset);
-				ArrowVarcharConverter::WriteData(aux_buffer.data() + append_data.offset, data[source_idx]);
-				append_data.offset = current_offset;
+				continue;
+			}
+			// This string is not inlined, we have to check a different buffer and offsets
+			//  | Bytes 0-3  | Bytes 4-7  | Bytes 8-11 | Bytes 12-15 |
+			//  |------------|------------|------------|-------------|
+			//  | length     | prefix     | buf. index | offset      |
+			auto string_start = const_data_ptr_cast(string_data);
+			auto string_end = string_start + string_length;
+			if (!heap_chunks.empty() && !(string_start >= heap_chunks[chunk_idx].start &&
+			                              string_end <= heap_chunks[chunk_idx].end)) {
+				// subsequent strings are usually in the same chunk, only search if this one is not
+				for (chunk_idx = 0; chunk_idx < heap_chunks.size(); chunk_idx++) {
+					if (string_start >= heap_chunks[chunk_idx].start && string_end <= heap_chunks[chunk_idx].end) {
+						break;
+					}
+				}
 			}
+			if (chunk_idx < heap_chunks.size()) {
+				// the string is in the string heap, reference it
+				auto &heap_chunk = heap_chunks[chunk_idx];
+				auto chunk_offset = UnsafeNumericCast<idx_t>(string_start - heap_chunk.start);
+				auto &variadic_buffer = append_data.variadic_buffers[heap_chunk.buffer_idx - 1];
+				variadic_buffer.size = MaxValue<idx_t>(variadic_buffer.size, chunk_offset + string_length);
+				arrow_data[result_idx] =
+				    arrow_string_view_t(UnsafeNumericCast<int32_t>(string_length), string_data,
+				                        UnsafeNumericCast<int32_t>(heap_chunk.buffer_idx),
+				                        UnsafeNumericCast<int32_t>(chunk_offset));
+				continue;
+			}
+			// the string is stored elsewhere (e.g., in a buffer of the storage), copy it into the auxiliary buffer
+			chunk_idx = 0;
+			arrow_data[result_idx] = arrow_string_view_t(UnsafeNumericCast<int32_t>(string_length), string_data, 0,
+			                                             UnsafeNumericCast<int32_t>(append_data.offset));
+			auto current_offset = append_data.offset + string_length;
+			aux_buffer.resize(current_offset);
+			ArrowVarcharConverter::WriteData(aux_buffer.data() + append_data.offset, data[source_idx]);
+			append_data.offset = current_offset;
 		}
 		append_data.row_count += size;
 	}
 
 	static void Finalize(ArrowAppendData &append_data, const LogicalType &type, ArrowArray *result) {
-		// We output four buffers
-		result->n_buffers = 4;
+		// We output the validity mask, the string views, the data buffers, and the data-buffer lengths buffer
+		auto &buffers = append_data.buffer_pointers;
+		auto data_buffer_count = 1 + append_data.variadic_buffers.size();
+		buffers.reserve(3 + data_buffer_count);
 		// Buffer 0 is the validity mask
+		buffers.push_back(append_data.GetValidityBuffer().data());
 		// Buffer 1 is our string views (short/long strings)
-		result->buffers[1] = append_data.GetMainBuffer().data();
-		// Buffer 2 is our only data buffer, could theoretically be more [ buffers ]
-		result->buffers[2] = append_data.GetAuxBuffer().data();
-		// Buffer 3 is the data-buffer lengths buffer, and we also populate it in to finalize
-		reinterpret_cast<int64_t *>(append_data.GetBufferSizeBuffer().data())[0] =
-		    UnsafeNumericCast<int64_t>(append_data.offset);
-		result->buffers[3] = append_data.GetBufferSizeBuffer().data();
+		buffers.push_back(append_data.GetMainBuffer().data());
+		// Buffer 2 is the auxiliary buffer with the strings that were copied, followed by the referenced string heaps
+		buffers.push_back(append_data.GetAuxBuffer().data());
+		for (auto &variadic_buffer : append_data.variadic_buffers) {
+			buffers.push_back(variadic_buffer.data);
+		}
+		// The last buffer holds the lengths of the data buffers, we populate it in finalize
+		auto &size_buffer = append_data.GetBufferSizeBuffer();
+		size_buffer.resize(sizeof(int64_t) * data_buffer_count);
+		auto sizes = size_buffer.GetData<int64_t>();
+		sizes[0] = UnsafeNumericCast<int64_t>(append_data.offset);
+		for (idx_t buffer_idx = 0; buffer_idx < append_data.variadic_buffers.size(); buffer_idx++) {
+			sizes[buffer_idx + 1] = UnsafeNumericCast<int64_t>(append_data.variadic_buffers[buffer_idx].size);
+		}
+		buffers.push_back(size_buffer.data());
+
+		result->n_buffers = NumericCast<int64_t>(buffers.size());
+		result->buffers = buffers.data();
 	}
 };
 
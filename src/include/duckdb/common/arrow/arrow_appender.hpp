@@ -18,7 +18,10 @@ struct ArrowAppendData;
 //! The ArrowAppender class can be used to incrementally construct an arrow array by appending data chunks into it
 class ArrowAppender {
 public:
-	DUCKDB_API ArrowAppender(vector<LogicalType> types_p, const idx_t initial_capacity, ClientProperties options);
+	//! If zero_copy is set, the appended chunks must not be modified afterwards: the arrow array can then reference
+	//! the memory of their vectors instead of copying it
+	DUCKDB_API ArrowAppender(vector<LogicalType> types_p, const idx_t initial_capacity, ClientProperties options,
+	                         bool zero_copy = false);
 	DUCKDB_API ~ArrowAppender();
 
 public:
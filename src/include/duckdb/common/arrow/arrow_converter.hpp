@@ -17,7 +17,10 @@ namespace duckdb {
 struct ArrowConverter {
 	DUCKDB_API static void ToArrowSchema(ArrowSchema *out_schema, const vector<LogicalType> &types,
 	                                     const vector<string> &names, const ClientProperties &options);
-	DUCKDB_API static void ToArrowArray(DataChunk &input, ArrowArray *out_array, ClientProperties options);
+	//! Converts the chunk to an arrow array. If zero_copy is set, the chunk must not be modified afterwards: the
+	//! arrow array can then reference the memory of its vectors instead of copying it
+	DUCKDB_API static void ToArrowArray(DataChunk &input, ArrowArray *out_array, ClientProperties options,
+	                                    bool zero_copy = false);
 };
 
 } // namespace duckdb
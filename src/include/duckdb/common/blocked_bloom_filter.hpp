@@ -0,0 +1,80 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/blocked_bloom_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/types/selection_vector.hpp"
+
+namespace duckdb {
+class Serializer;
+class Deserializer;
+class Vector;
+
+//! A register-blocked bloom filter over 64-bit hashes
+//! Every key sets BITS_PER_HASH bits within a single 64-bit word, so a lookup touches exactly one word of memory
+class BlockedBloomFilter {
+public:
+	//! Number of bits that are reserved per key (determines the false positive rate)
+	static constexpr const idx_t BITS_PER_KEY = 16;
+	//! Number of bits that are set in a word for every key
+	static constexpr const idx_t BITS_PER_HASH = 4;
+
+public:
+	//! Creates an empty filter sized for (approximately) "key_count" keys
+	explicit BlockedBloomFilter(idx_t key_count);
+	//! Creates a filter from an existing set of words (must be a power of two)
+	explicit BlockedBloomFilter(vector<uint64_t> words);
+
+public:
+	//! Insert a single hash into the filter
+	inline void Insert(hash_t hash) {
+		words[hash & word_mask] |= GetWordMask(hash);
+	}
+	//! Returns true if the hash might be present in the filter, false if it is definitely not present
+	inline bool Lookup(hash_t hash) const {
+		auto mask = GetWordMask(hash);
+		return (words[hash & word_mask] & mask) == mask;
+	}
+
+	//! Insert "count" hashes from a hash vector
+	void Insert(Vector &hashes, idx_t count);
+	//! Probe the filter for the hashes of the rows in "sel", and write the rows that might be present to "result_sel"
+	//! Returns the number of rows that might be present
+	idx_t Lookup(Vector &hashes, const SelectionVector &sel, idx_t count, SelectionVector &result_sel) const;
+
+	//! Whether or not equal values of the type always have equal hashes, i.e. whether a bloom filter over the hashes of
+	//! a column of this type can be used to evaluate equality filters
+	static bool SupportsType(const LogicalType &type);
+
+	//! The size of the filter in bytes
+	idx_t SizeInBytes() const {
+		return words.size() * sizeof(uint64_t);
+	}
+	const vector<uint64_t> &GetWords() const {
+		return words;
+	}
+
+	void Serialize(Serializer &serializer) const;
+	static shared_ptr<BlockedBloomFilter> Deserialize(Deserializer &deserializer);
+
+private:
+	//! The bits within a word that are set for a hash - the low bits of the hash select the word, the high bits are
+	//! used to select the bits within the word
+	static inline uint64_t GetWordMask(hash_t hash) {
+		return (uint64_t(1) << ((hash >> 40) & 63)) | (uint64_t(1) << ((hash >> 46) & 63)) |
+		       (uint64_t(1) << ((hash >> 52) & 63)) | (uint64_t(1) << ((hash >> 58) & 63));
+	}
+
+private:
+	vector<uint64_t> words;
+	//! Mask used to select the word for a hash
+	hash_t word_mask;
+};
+
+} // namespace duckdb
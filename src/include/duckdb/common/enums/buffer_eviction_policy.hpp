@@ -0,0 +1,20 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/enums/buffer_eviction_policy.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/constants.hpp"
+
+namespace duckdb {
+
+enum class BufferEvictionPolicy : uint8_t {
+	LRU = 0,           //! Evict the least recently used blocks first
+	SCAN_RESISTANT = 1 //! Evict blocks that were loaded by a scan and not used since before any other blocks
+};
+
+} // namespace duckdb
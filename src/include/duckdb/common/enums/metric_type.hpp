@@ -56,6 +56,7 @@ enum class MetricsType : uint8_t {
     OPTIMIZER_BUILD_SIDE_PROBE_SIDE,
     OPTIMIZER_LIMIT_PUSHDOWN,
     OPTIMIZER_TOP_N,
+    OPTIMIZER_LATE_MATERIALIZATION,
     OPTIMIZER_COMPRESSED_MATERIALIZATION,
     OPTIMIZER_DUPLICATE_GROUPS,
     OPTIMIZER_REORDER_FILTER,
@@ -32,6 +32,7 @@ enum class OptimizerType : uint32_t {
 	BUILD_SIDE_PROBE_SIDE,
 	LIMIT_PUSHDOWN,
 	TOP_N,
+	LATE_MATERIALIZATION,
 	COMPRESSED_MATERIALIZATION,
 	DUPLICATE_GROUPS,
 	REORDER_FILTER,
@@ -51,6 +51,32 @@ enum class FileType {
 	FILE_TYPE_INVALID,
 };
 
+//! A single read of a batch of reads submitted through FileSystem::SubmitReads
+struct FileReadRequest {
+	FileReadRequest(data_ptr_t buffer, idx_t nr_bytes, idx_t location)
+	    : buffer(buffer), nr_bytes(nr_bytes), location(location) {
+	}
+
+	data_ptr_t buffer;
+	idx_t nr_bytes;
+	idx_t location;
+};
+
+//! A batch of reads that has been submitted to a file system, but that has not necessarily completed yet
+class PendingFileReads {
+public:
+	DUCKDB_API virtual ~PendingFileReads();
+
+	//! Wait until all reads of the batch have completed. Throws an IOException if any of the reads failed.
+	DUCKDB_API virtual void Wait();
+
+	template <class TARGET>
+	TARGET &Cast() {
+		DynamicCastCheck<TARGET>(this);
+		return reinterpret_cast<TARGET &>(*this);
+	}
+};
+
 struct FileHandle {
 public:
 	DUCKDB_API FileHandle(FileSystem &file_system, string path);
@@ -61,6 +87,9 @@ public:
 	DUCKDB_API int64_t Write(void *buffer, idx_t nr_bytes);
 	DUCKDB_API void Read(void *buffer, idx_t nr_bytes, idx_t location);
 	DUCKDB_API void Write(void *buffer, idx_t nr_bytes, idx_t location);
+	DUCKDB_API unique_ptr<PendingFileReads> SubmitReads(vector<FileReadRequest> requests);
+	DUCKDB_API void ReadBatch(vector<FileReadRequest> requests);
+	DUCKDB_API bool SupportsAsyncReads();
 	DUCKDB_API void Seek(idx_t location);
 	DUCKDB_API void Reset();
 	DUCKDB_API idx_t SeekPosition();
@@ -118,6 +147,11 @@ public:
 	//! Write exactly nr_bytes to the specified location in the file. Fails if nr_bytes could not be written. This is
 	//! equivalent to calling SetFilePointer(location) followed by calling Write().
 	DUCKDB_API virtual void Write(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location);
+	//! Submit a batch of reads of the file. The reads have only completed once Wait() has been called on the result,
+	//! until then the buffers of the requests must remain valid. The default implementation reads synchronously.
+	DUCKDB_API virtual unique_ptr<PendingFileReads> SubmitReads(FileHandle &handle, vector<FileReadRequest> requests);
+	//! Whether or not SubmitReads reads asynchronously, i.e. whether prefetching reads from this file is beneficial
+	DUCKDB_API virtual bool SupportsAsyncReads(FileHandle &handle);
 	//! Read nr_bytes from the specified file into the buffer, moving the file pointer forward by nr_bytes. Returns the
 	//! amount of bytes read.
 	DUCKDB_API virtual int64_t Read(FileHandle &handle, void *buffer, int64_t nr_bytes);
@@ -27,6 +27,10 @@ public:
 	//! Read nr_bytes from the specified file into the buffer, moving the file pointer forward by nr_bytes. Returns the
 	//! amount of bytes read.
 	int64_t Read(FileHandle &handle, void *buffer, int64_t nr_bytes) override;
+	//! Submit a batch of reads. On Linux the reads are submitted to an io_uring if the kernel supports it, otherwise
+	//! (or on other platforms) the reads are performed synchronously using pread.
+	unique_ptr<PendingFileReads> SubmitReads(FileHandle &handle, vector<FileReadRequest> requests) override;
+	bool SupportsAsyncReads(FileHandle &handle) override;
 	//! Write nr_bytes from the buffer into the file, moving the file pointer forward by nr_bytes.
 	int64_t Write(FileHandle &handle, void *buffer, int64_t nr_bytes) override;
 	//! Excise a range of the file. The file-system is free to deallocate this
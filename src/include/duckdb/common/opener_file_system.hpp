@@ -38,6 +38,14 @@ public:
 		GetFileSystem().Write(handle, buffer, nr_bytes, location);
 	}
 
+	unique_ptr<PendingFileReads> SubmitReads(FileHandle &handle, vector<FileReadRequest> requests) override {
+		return GetFileSystem().SubmitReads(handle, std::move(requests));
+	}
+
+	bool SupportsAsyncReads(FileHandle &handle) override {
+		return GetFileSystem().SupportsAsyncReads(handle);
+	}
+
 	int64_t Read(FileHandle &handle, void *buffer, int64_t nr_bytes) override {
 		return GetFileSystem().Read(handle, buffer, nr_bytes);
 	}
@@ -61,7 +61,7 @@ public:
 	void PrepareMergePhase();
 	//! Initializes the global sort state for another round of merging
 	void InitializeMergeRound();
-	//! Completes the cascaded merge sort round.
+	//! Completes the merge sort round.
 	//! Pass true if you wish to use the radix data for further comparisons.
 	void CompleteMergeRound(bool keep_radix_data = false);
 	//! Print the sorted data to the console.
@@ -91,11 +91,18 @@ public:
 	//! Whether we are doing an external sort
 	bool external;
 
+	//! How many sorted blocks are merged at once in a merge round
+	idx_t merge_fan_in;
 	//! Progress in merge path stage
-	idx_t pair_idx;
-	idx_t num_pairs;
-	idx_t l_start;
-	idx_t r_start;
+	idx_t group_idx;
+	idx_t num_groups;
+	//! How many rows of the current group have been assigned to a partition, and where each of its blocks was split
+	idx_t group_start;
+	vector<idx_t> run_starts;
+
+private:
+	//! Computes how many sorted blocks can be merged at once in the next merge round
+	idx_t ComputeMergeFanIn() const;
 };
 
 struct LocalSortState {
@@ -147,11 +154,14 @@ private:
 	Vector addresses = Vector(LogicalType::POINTER);
 };
 
+//! Merges groups of sorted blocks (runs) in a single pass. The output of a group is split into partitions of equal
+//! size using Merge Path: for every partition, the split point in each run is found such that the rows before the split
+//! points are exactly the smallest rows of the group. Each partition is then merged independently with a heap.
 struct MergeSorter {
 public:
 	MergeSorter(GlobalSortState &state, BufferManager &buffer_manager);
 
-	//! Finds and merges partitions until the current cascaded merge round is finished
+	//! Finds and merges partitions until the current merge round is finished
 	void PerformInMergeRound();
 
 private:
@@ -161,47 +171,36 @@ private:
 	BufferManager &buffer_manager;
 	const SortLayout &sort_layout;
 
-	//! The left and right reader
-	unique_ptr<SBScanState> left;
-	unique_ptr<SBScanState> right;
-
-	//! Input and output blocks
-	unique_ptr<SortedBlock> left_input;
-	unique_ptr<SortedBlock> right_input;
+	//! Readers for the runs of the current group, used to find the split points
+	vector<unique_ptr<SBScanState>> searchers;
+	//! Readers for the slices of the runs that will be merged into the next partition
+	vector<unique_ptr<SBScanState>> runs;
+	//! The slices of the runs
+	vector<unique_ptr<SortedBlock>> inputs;
+	//! Output block
 	SortedBlock *result;
+	//! Heap of run indices that still have rows, ordered by their current row
+	vector<idx_t> heap;
 
 private:
-	//! Computes the left and right block that will be merged next (Merge Path partition)
+	//! Computes the slices of the runs that will be merged next (Merge Path partition)
 	void GetNextPartition();
-	//! Finds the boundary of the next partition using binary search
-	void GetIntersection(const idx_t diagonal, idx_t &l_idx, idx_t &r_idx);
-	//! Compare values within SortedBlocks using a global index
-	int CompareUsingGlobalIndex(SBScanState &l, SBScanState &r, const idx_t l_idx, const idx_t r_idx);
-
-	//! Finds the next partition and merges it
+	//! Computes the split point in every run for the given diagonal, i.e., such that the rows before the split points
+	//! are the 'diagonal' smallest rows of the group. 'splits' must hold the split points of an earlier diagonal
+	void ComputeSplits(const idx_t diagonal, vector<idx_t> &splits);
+	//! Counts the rows of a run that sort before the given row of another run (using binary search)
+	idx_t CountSmaller(const idx_t run_idx, const idx_t pivot_run_idx, const idx_t pivot_idx);
+	//! Compare rows of different runs using a global index, ties are broken using the run indices
+	bool LessThanUsingGlobalIndex(const idx_t l_run_idx, const idx_t l_idx, const idx_t r_run_idx, const idx_t r_idx);
+
+	//! Merges the next partition
 	void MergePartition();
-
-	//! Computes how the next 'count' tuples should be merged by setting the 'left_smaller' array
-	void ComputeMerge(const idx_t &count, bool left_smaller[]);
-
-	//! Merges the radix sorting blocks according to the 'left_smaller' array
-	void MergeRadix(const idx_t &count, const bool left_smaller[]);
-	//! Merges SortedData according to the 'left_smaller' array
-	void MergeData(SortedData &result_data, SortedData &l_data, SortedData &r_data, const idx_t &count,
-	               const bool left_smaller[], idx_t next_entry_sizes[], bool reset_indices);
-	//! Merges constant size rows according to the 'left_smaller' array
-	void MergeRows(data_ptr_t &l_ptr, idx_t &l_entry_idx, const idx_t &l_count, data_ptr_t &r_ptr, idx_t &r_entry_idx,
-	               const idx_t &r_count, RowDataBlock &target_block, data_ptr_t &target_ptr, const idx_t &entry_size,
-	               const bool left_smaller[], idx_t &copied, const idx_t &count);
-	//! Flushes constant size rows into the result
-	void FlushRows(data_ptr_t &source_ptr, idx_t &source_entry_idx, const idx_t &source_count,
-	               RowDataBlock &target_block, data_ptr_t &target_ptr, const idx_t &entry_size, idx_t &copied,
-	               const idx_t &count);
-	//! Flushes blob rows and accompanying heap
-	void FlushBlobs(const RowLayout &layout, const idx_t &source_count, data_ptr_t &source_data_ptr,
-	                idx_t &source_entry_idx, data_ptr_t &source_heap_ptr, RowDataBlock &target_data_block,
-	                data_ptr_t &target_data_ptr, RowDataBlock &target_heap_block, BufferHandle &target_heap_handle,
-	                data_ptr_t &target_heap_ptr, idx_t &copied, const idx_t &count);
+	//! Compares the current rows of two runs, ties are broken using the run indices
+	bool RunLessThan(const idx_t l_run_idx, const idx_t r_run_idx);
+	//! Restores the heap property by moving the run at the given position down
+	void SiftDown(idx_t heap_idx);
+	//! Pins the current block of a run
+	void PinRun(SBScanState &run);
 };
 
 struct SBIterator {
@@ -43,6 +43,11 @@ public:
 	//! Total allocation size (cached)
 	DUCKDB_API idx_t AllocationSize() const;
 
+	//! The arena allocator the strings are stored in
+	ArenaAllocator &GetAllocator() {
+		return allocator;
+	}
+
 private:
 	ArenaAllocator allocator;
 };
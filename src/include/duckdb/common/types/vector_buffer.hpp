@@ -70,9 +70,10 @@ class VectorBuffer {
 public:
 	explicit VectorBuffer(VectorBufferType type) : buffer_type(type) {
 	}
-	explicit VectorBuffer(idx_t data_size) : buffer_type(VectorBufferType::STANDARD_BUFFER) {
-		if (data_size > 0) {
-			data = make_unsafe_uniq_array_uninitialized<data_t>(data_size);
+	explicit VectorBuffer(idx_t data_size_p) : buffer_type(VectorBufferType::STANDARD_BUFFER) {
+		if (data_size_p > 0) {
+			data = make_unsafe_uniq_array_uninitialized<data_t>(data_size_p);
+			data_size = data_size_p;
 		}
 	}
 	explicit VectorBuffer(unsafe_unique_array<data_t> data_p)
@@ -88,8 +89,14 @@ public:
 		return data.get();
 	}
 
-	void SetData(unsafe_unique_array<data_t> new_data) {
+	void SetData(unsafe_unique_array<data_t> new_data, idx_t new_data_size = 0) {
 		data = std::move(new_data);
+		data_size = new_data_size;
+	}
+
+	//! Whether the memory range lies within the data owned by this buffer, i.e., holding on to the buffer keeps it alive
+	virtual bool OwnsData(const_data_ptr_t ptr, idx_t size) const {
+		return data && ptr >= data.get() && ptr + size <= data.get() + data_size;
 	}
 
 	VectorAuxiliaryData *GetAuxiliaryData() {
@@ -122,6 +129,8 @@ protected:
 	VectorBufferType buffer_type;
 	unique_ptr<VectorAuxiliaryData> aux_data;
 	unsafe_unique_array<data_t> data;
+	//! The size of the data, if known
+	idx_t data_size = 0;
 
 public:
 	template <class TARGET>
@@ -187,6 +196,10 @@ public:
 		references.push_back(std::move(heap));
 	}
 
+	StringHeap &GetStringHeap() {
+		return heap;
+	}
+
 private:
 	//! The string heap of this buffer
 	StringHeap heap;
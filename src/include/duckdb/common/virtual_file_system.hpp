@@ -24,6 +24,8 @@ public:
 
 	void Read(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location) override;
 	void Write(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location) override;
+	unique_ptr<PendingFileReads> SubmitReads(FileHandle &handle, vector<FileReadRequest> requests) override;
+	bool SupportsAsyncReads(FileHandle &handle) override;
 
 	int64_t Read(FileHandle &handle, void *buffer, int64_t nr_bytes) override;
 
@@ -63,6 +63,11 @@ struct RegularAdd {
 	static void AddConstant(STATE &state, T input, idx_t count) {
 		state.value += input * int64_t(count);
 	}
+
+	template <class STATE, class T>
+	static void SubtractNumber(STATE &state, T input) {
+		state.value -= input;
+	}
 };
 
 struct HugeintAdd {
@@ -75,6 +80,11 @@ struct HugeintAdd {
 	static void AddConstant(STATE &state, T input, idx_t count) {
 		AddNumber(state, Hugeint::Multiply(input, UnsafeNumericCast<int64_t>(count)));
 	}
+
+	template <class STATE, class T>
+	static void SubtractNumber(STATE &state, T input) {
+		state.value = Hugeint::Subtract(state.value, input);
+	}
 };
 
 struct KahanAdd {
@@ -140,6 +150,11 @@ struct AddToHugeint {
 			}
 		}
 	}
+
+	template <class STATE, class T>
+	static void SubtractNumber(STATE &state, T input) {
+		state.value -= hugeint_t(input);
+	}
 };
 
 template <class STATEOP, class ADDOP>
@@ -167,6 +182,13 @@ struct BaseSumOperation {
 		ADDOP::template AddConstant<STATE, INPUT_TYPE>(state, input, count);
 	}
 
+	//! The inverse of Operation, only available if both STATEOP and ADDOP can remove values
+	template <class INPUT_TYPE, class STATE, class OP>
+	static void Remove(STATE &state, const INPUT_TYPE &input, AggregateUnaryInput &) {
+		STATEOP::template RemoveValues<STATE>(state, 1);
+		ADDOP::template SubtractNumber<STATE, INPUT_TYPE>(state, input);
+	}
+
 	static bool IgnoreNull() {
 		return true;
 	}
@@ -87,6 +87,9 @@ public:
 	void ResetCount();
 	//! Set the radix bits for this HT
 	void SetRadixBits(idx_t radix_bits);
+	//! Whether to skip the lookups in the pointer table, i.e., append every row as a new group without aggregating
+	void SetSkipLookups(bool skip_lookups);
+	bool SkipLookups() const;
 	//! Initializes the PartitionedTupleData
 	void InitializePartitionedData();
 
@@ -126,6 +129,8 @@ private:
 	//! Predicates for matching groups (always ExpressionType::COMPARE_EQUAL)
 	vector<ExpressionType> predicates;
 
+	//! Whether lookups are skipped: groups are appended without probing the pointer table, and combined later
+	bool skip_lookups;
 	//! The number of groups in the HT
 	idx_t count;
 	//! The capacity of the HT. This can be increased using GroupedAggregateHashTable::Resize
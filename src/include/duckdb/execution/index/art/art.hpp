@@ -11,6 +11,7 @@
 #include "duckdb/execution/index/bound_index.hpp"
 #include "duckdb/execution/index/art/node.hpp"
 #include "duckdb/common/array.hpp"
+#include "duckdb/storage/storage_lock.hpp"
 
 namespace duckdb {
 
@@ -63,6 +64,9 @@ public:
 	bool owns_data;
 	//! The number of bytes fitting in the prefix.
 	uint8_t prefix_count;
+	//! Lookups and scans hold a shared lock on the tree, and can run concurrently.
+	//! Changes to the tree hold an exclusive lock, in addition to the index lock. Concurrent inserts are not supported.
+	StorageLock tree_lock;
 
 public:
 	//! Try to initialize a scan on the ART with the given expression and filter.
@@ -70,6 +74,12 @@ public:
 	//! Perform a lookup on the ART, fetching up to max_count row IDs.
 	//! If all row IDs were fetched, it return true, else false.
 	bool Scan(IndexScanState &state, idx_t max_count, unsafe_vector<row_t> &row_ids);
+	//! Scan the row IDs of the keys starting with prefix in key order, continuing after last_key (if not empty).
+	//! Only complete keys are scanned, until row_ids contains at least max_count row IDs. Stops at the first key that
+	//! exceeds upper_bound (if not empty), comparing only the bytes of upper_bound. Sets last_key to the last scanned
+	//! key, and returns false, if there are no more keys to scan.
+	bool ScanOrdered(const ARTKey &prefix, const ARTKey &upper_bound, idx_t max_count, unsafe_vector<row_t> &row_ids,
+	                 unsafe_vector<uint8_t> &last_key);
 
 	//! Append a chunk by first executing the ART's expressions.
 	ErrorData Append(IndexLock &lock, DataChunk &input, Vector &row_ids) override;
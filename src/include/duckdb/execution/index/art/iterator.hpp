@@ -66,16 +66,23 @@ public:
 	//! Scans the tree, starting at the current top node on the stack, and ending at upper_bound.
 	//! If upper_bound is the empty ARTKey, than there is no upper bound.
 	bool Scan(const ARTKey &upper_bound, const idx_t max_count, unsafe_vector<row_t> &row_ids, const bool equal);
+	//! Appends the row IDs of the last visited leaf to row_ids, and goes to the next leaf.
+	//! Returns false, if there is no next leaf.
+	bool ScanLeaf(unsafe_vector<row_t> &row_ids);
 	//! Finds the minimum (leaf) of the current subtree.
 	void FindMinimum(const Node &node);
 	//! Finds the lower bound of the ART and adds the nodes to the stack. Returns false, if the lower
-	//! bound exceeds the maximum value of the ART.
+	//! bound exceeds the maximum value of the ART. The key can also be a prefix of the keys in the ART.
 	bool LowerBound(const Node &node, const ARTKey &key, const bool equal, idx_t depth);
 
 	//! Returns the nested depth.
 	uint8_t GetNestedDepth() const {
 		return nested_depth;
 	}
+	//! Returns the number of bytes of the current key, i.e., without the row ID bytes of a nested leaf.
+	idx_t GetKeySize() const {
+		return status == GateStatus::GATE_SET ? current_key.Size() - nested_depth : current_key.Size();
+	}
 
 private:
 	//! The ART.
@@ -97,5 +104,7 @@ private:
 	bool Next();
 	//! Pop the top node from the stack of iterator entries and adjust the current key.
 	void PopNode();
+	//! Appends the row IDs of the last visited leaf to row_ids. Returns false, if that exceeds max_count.
+	bool GetRowIds(unsafe_vector<row_t> &row_ids, const idx_t max_count);
 };
 } // namespace duckdb
@@ -124,6 +124,9 @@ public: // Index interface
 
 	//! Execute the index expressions on an input chunk
 	void ExecuteExpressions(DataChunk &input, DataChunk &result);
+	//! Execute the index expressions on an input chunk with a new expression executor,
+	//! i.e., without holding the index lock
+	void ExecuteExpressionsUnlocked(DataChunk &input, DataChunk &result) const;
 	static string AppendRowError(DataChunk &input, idx_t index);
 
 	//! Throw a constraint violation exception
@@ -10,6 +10,7 @@
 
 #include "duckdb/common/constants.hpp"
 #include "duckdb/common/map.hpp"
+#include "duckdb/common/mutex.hpp"
 #include "duckdb/common/types/validity_mask.hpp"
 #include "duckdb/common/unordered_map.hpp"
 #include "duckdb/common/unordered_set.hpp"
@@ -55,6 +56,9 @@ public:
 		D_ASSERT(buffers.find(ptr.GetBufferId()) != buffers.end());
 
 		auto &buffer = buffers.find(ptr.GetBufferId())->second;
+		if (!buffer.InMemory()) {
+			Pin(buffer);
+		}
 		auto buffer_ptr = buffer.Get(dirty);
 		return buffer_ptr + ptr.GetOffset() * segment_size + bitmask_offset;
 	}
@@ -153,10 +157,14 @@ private:
 	unordered_set<idx_t> buffers_with_free_space;
 	//! Buffers qualifying for a vacuum (helper field to allow for fast NeedsVacuum checks)
 	unordered_set<idx_t> vacuum_buffers;
+	//! Concurrent readers of an index can load the same buffer, so we load buffers while holding this lock
+	mutex pin_lock;
 
 private:
 	//! Returns an available buffer id
 	idx_t GetAvailableBufferId() const;
+	//! Loads an on-disk buffer into memory
+	void Pin(FixedSizeBuffer &buffer);
 };
 
 } // namespace duckdb
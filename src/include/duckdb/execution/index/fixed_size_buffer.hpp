@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include "duckdb/common/atomic.hpp"
 #include "duckdb/storage/partial_block_manager.hpp"
 #include "duckdb/storage/buffer/block_handle.hpp"
 #include "duckdb/storage/buffer/buffer_handle.hpp"
@@ -45,6 +46,7 @@ public:
 	//! Constructor for deserializing buffer metadata from disk
 	FixedSizeBuffer(BlockManager &block_manager, const idx_t segment_count, const idx_t allocation_size,
 	                const BlockPointer &block_pointer);
+	FixedSizeBuffer(FixedSizeBuffer &&other) noexcept;
 
 	//! Block manager of the database instance
 	BlockManager &block_manager;
@@ -65,7 +67,7 @@ public:
 public:
 	//! Returns true, if the buffer is in-memory
 	inline bool InMemory() const {
-		return buffer_handle.IsValid();
+		return in_memory;
 	}
 	//! Returns true, if the block is on-disk
 	inline bool OnDisk() const {
@@ -86,7 +88,7 @@ public:
 	//! Serializes a buffer (if dirty or not on disk)
 	void Serialize(PartialBlockManager &partial_block_manager, const idx_t available_segments, const idx_t segment_size,
 	               const idx_t bitmask_offset);
-	//! Pin a buffer (if not in-memory)
+	//! Pin a buffer (if not in-memory). Concurrent readers must hold the pin lock of the allocator
 	void Pin();
 	//! Returns the first free offset in a bitmask
 	uint32_t GetOffset(const idx_t bitmask_count);
@@ -98,6 +100,8 @@ private:
 	BufferHandle buffer_handle;
 	//! The block handle of the on-disk buffer
 	shared_ptr<BlockHandle> block_handle;
+	//! True, if the buffer handle is valid. Readers can check this without holding a lock
+	atomic<bool> in_memory;
 
 private:
 	//! Sets all uninitialized regions of a buffer in the respective partial block allocation
@@ -94,6 +94,8 @@ public:
 	SourceResultType GetData(ExecutionContext &context, DataChunk &chunk, OperatorSourceInput &input) const override;
 
 	double GetProgress(ClientContext &context, GlobalSourceState &gstate) const override;
+	InsertionOrderPreservingMap<string> ExtraSourceParams(GlobalSourceState &gstate,
+	                                                      LocalSourceState &lstate) const override;
 
 	bool IsSource() const override {
 		return true;
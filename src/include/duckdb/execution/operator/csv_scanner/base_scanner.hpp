@@ -12,6 +12,8 @@
 #include "duckdb/execution/operator/csv_scanner/scanner_boundary.hpp"
 #include "duckdb/execution/operator/csv_scanner/csv_state_machine.hpp"
 #include "duckdb/execution/operator/csv_scanner/csv_error.hpp"
+#include "duckdb/execution/operator/csv_scanner/csv_structural_mask.hpp"
+#include "duckdb/common/bit_utils.hpp"
 #include "duckdb/common/helper.hpp"
 
 namespace duckdb {
@@ -142,8 +144,43 @@ protected:
 	//! Initializes the scanner
 	virtual void Initialize();
 
-	inline static bool ContainsZeroByte(uint64_t v) {
-		return (v - UINT64_C(0x0101010101010101)) & ~(v)&UINT64_C(0x8080808080808080);
+	//! Moves the iterator to the first byte that the current state can't skip, or to the last byte before to_pos if
+	//! there is none. Blocks of bytes are matched against the structural characters at once, so only the structural
+	//! characters are looked at individually
+	inline void SkipToStructuralCharacter(const bool (&skip)[StateMachine::NUM_TRANSITIONS],
+	                                      CSVStructuralMask &structural, const idx_t to_pos) {
+		auto &pos = iterator.pos.buffer_pos;
+		// the last byte is always processed by the state machine
+		const idx_t end = to_pos - 1;
+		if (pos >= end) {
+			return;
+		}
+		while (pos < end) {
+			if (!structural.Contains(pos)) {
+				if (pos + CSVStructuralMask::BLOCK_SIZE > to_pos) {
+					break;
+				}
+				structural.Compute(state_machine->transition_array.structural_characters, buffer_handle_ptr, pos);
+			}
+			auto remaining = structural.mask >> (pos - structural.block_start);
+			if (remaining == 0) {
+				pos = structural.block_start + CSVStructuralMask::BLOCK_SIZE;
+				continue;
+			}
+			pos += CountZeros<uint64_t>::Trailing(remaining);
+			if (pos >= end || !skip[static_cast<uint8_t>(buffer_handle_ptr[pos])]) {
+				break;
+			}
+			// a structural character of a different state, e.g., a delimiter within quotes
+			pos++;
+		}
+		if (pos > end) {
+			pos = end;
+		}
+		// the bytes at the end of the buffer that do not fill a block
+		while (pos < end && skip[static_cast<uint8_t>(buffer_handle_ptr[pos])]) {
+			pos++;
+		}
 	}
 
 	//! Process one chunk
@@ -159,6 +196,7 @@ protected:
 		} else {
 			to_pos = cur_buffer_handle->actual_size;
 		}
+		CSVStructuralMask structural;
 		while (iterator.pos.buffer_pos < to_pos) {
 			state_machine->Transition(states, buffer_handle_ptr[iterator.pos.buffer_pos]);
 			switch (states.states[1]) {
@@ -236,21 +274,7 @@ protected:
 				ever_quoted = true;
 				T::SetQuoted(result, iterator.pos.buffer_pos);
 				iterator.pos.buffer_pos++;
-				while (iterator.pos.buffer_pos + 8 < to_pos) {
-					uint64_t value =
-					    Load<uint64_t>(reinterpret_cast<const_data_ptr_t>(&buffer_handle_ptr[iterator.pos.buffer_pos]));
-					if (ContainsZeroByte((value ^ state_machine->transition_array.quote) &
-					                     (value ^ state_machine->transition_array.escape))) {
-						break;
-					}
-					iterator.pos.buffer_pos += 8;
-				}
-
-				while (state_machine->transition_array
-				           .skip_quoted[static_cast<uint8_t>(buffer_handle_ptr[iterator.pos.buffer_pos])] &&
-				       iterator.pos.buffer_pos < to_pos - 1) {
-					iterator.pos.buffer_pos++;
-				}
+				SkipToStructuralCharacter(state_machine->transition_array.skip_quoted, structural, to_pos);
 			} break;
 			case CSVState::ESCAPE:
 				T::SetEscaped(result);
@@ -258,22 +282,7 @@ protected:
 				break;
 			case CSVState::STANDARD: {
 				iterator.pos.buffer_pos++;
-				while (iterator.pos.buffer_pos + 8 < to_pos) {
-					uint64_t value =
-					    Load<uint64_t>(reinterpret_cast<const_data_ptr_t>(&buffer_handle_ptr[iterator.pos.buffer_pos]));
-					if (ContainsZeroByte((value ^ state_machine->transition_array.delimiter) &
-					                     (value ^ state_machine->transition_array.new_line) &
-					                     (value ^ state_machine->transition_array.carriage_return) &
-					                     (value ^ state_machine->transition_array.comment))) {
-						break;
-					}
-					iterator.pos.buffer_pos += 8;
-				}
-				while (state_machine->transition_array
-				           .skip_standard[static_cast<uint8_t>(buffer_handle_ptr[iterator.pos.buffer_pos])] &&
-				       iterator.pos.buffer_pos < to_pos - 1) {
-					iterator.pos.buffer_pos++;
-				}
+				SkipToStructuralCharacter(state_machine->transition_array.skip_standard, structural, to_pos);
 				break;
 			}
 			case CSVState::QUOTED_NEW_LINE:
@@ -283,20 +292,7 @@ protected:
 			case CSVState::COMMENT: {
 				T::SetComment(result, iterator.pos.buffer_pos);
 				iterator.pos.buffer_pos++;
-				while (iterator.pos.buffer_pos + 8 < to_pos) {
-					uint64_t value =
-					    Load<uint64_t>(reinterpret_cast<const_data_ptr_t>(&buffer_handle_ptr[iterator.pos.buffer_pos]));
-					if (ContainsZeroByte((value ^ state_machine->transition_array.new_line) &
-					                     (value ^ state_machine->transition_array.carriage_return))) {
-						break;
-					}
-					iterator.pos.buffer_pos += 8;
-				}
-				while (state_machine->transition_array
-				           .skip_comment[static_cast<uint8_t>(buffer_handle_ptr[iterator.pos.buffer_pos])] &&
-				       iterator.pos.buffer_pos < to_pos - 1) {
-					iterator.pos.buffer_pos++;
-				}
+				SkipToStructuralCharacter(state_machine->transition_array.skip_comment, structural, to_pos);
 				break;
 			}
 			default:
@@ -42,12 +42,13 @@ public:
 	//! This means the options are alreadu set, and the buffer manager is already up and runinng.
 	CSVFileScan(ClientContext &context, shared_ptr<CSVBufferManager> buffer_manager,
 	            shared_ptr<CSVStateMachine> state_machine, const CSVReaderOptions &options,
-	            const ReadCSVData &bind_data, const vector<column_t> &column_ids, CSVSchema &file_schema);
+	            const ReadCSVData &bind_data, const vector<column_t> &column_ids, CSVSchema &file_schema,
+	            optional_ptr<TableFilterSet> filters = nullptr);
 	//! Constructor for new CSV Files, we must initialize the buffer manager and the state machine
 	//! Path to this file
 	CSVFileScan(ClientContext &context, const string &file_path, const CSVReaderOptions &options, const idx_t file_idx,
 	            const ReadCSVData &bind_data, const vector<column_t> &column_ids, CSVSchema &file_schema,
-	            bool per_file_single_threaded);
+	            bool per_file_single_threaded, optional_ptr<TableFilterSet> filters = nullptr);
 
 	CSVFileScan(ClientContext &context, const string &file_name, const CSVReaderOptions &options);
 
@@ -13,6 +13,7 @@
 #include "duckdb/execution/operator/csv_scanner/state_machine_options.hpp"
 #include "duckdb/execution/operator/csv_scanner/quote_rules.hpp"
 #include "duckdb/execution/operator/csv_scanner/csv_state.hpp"
+#include "duckdb/execution/operator/csv_scanner/csv_structural_mask.hpp"
 
 namespace duckdb {
 
@@ -30,12 +31,8 @@ public:
 	//! For the Comment State
 	bool skip_comment[256];
 
-	uint64_t delimiter = 0;
-	uint64_t new_line = 0;
-	uint64_t carriage_return = 0;
-	uint64_t quote = 0;
-	uint64_t escape = 0;
-	uint64_t comment = 0;
+	//! The characters that are not skipped in one of the states above
+	CSVStructuralCharacters structural_characters;
 
 	const CSVState *operator[](idx_t i) const {
 		return state_machine[i];
@@ -0,0 +1,46 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/operator/csv_scanner/csv_structural_mask.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+
+namespace duckdb {
+
+//! The characters that can change the state of the CSV State Machine, i.e., the delimiter, quote, escape,
+//! comment, '\n' and '\r'. All other characters keep the state machine in the state it is in.
+struct CSVStructuralCharacters {
+	static constexpr idx_t COUNT = 6;
+	uint8_t characters[COUNT] = {};
+};
+
+//! Bitmask of the structural characters in a block of BLOCK_SIZE bytes of a CSV buffer.
+//! The mask is computed with SSE2/AVX2/NEON kernels when they are available, and with a portable SWAR fallback
+//! otherwise. This allows the scanner to jump from one structural character to the next, instead of running
+//! every byte through the state machine.
+struct CSVStructuralMask {
+	static constexpr idx_t BLOCK_SIZE = 64;
+
+	//! Position in the buffer of the first byte of the block
+	idx_t block_start = 0;
+	//! Bit i is set if the byte at block_start + i is a structural character
+	uint64_t mask = 0;
+	//! Whether or not a block was computed
+	bool initialized = false;
+
+	inline bool Contains(idx_t position) const {
+		return initialized && position >= block_start && position - block_start < BLOCK_SIZE;
+	}
+
+	//! Computes the mask of the BLOCK_SIZE bytes starting at buffer[position]
+	void Compute(const CSVStructuralCharacters &characters, const char *buffer, idx_t position);
+	//! Computes the mask of the BLOCK_SIZE bytes starting at ptr (bit i is set if ptr[i] is a structural character)
+	static uint64_t ComputeMask(const CSVStructuralCharacters &characters, const char *ptr);
+};
+
+} // namespace duckdb
@@ -318,6 +318,13 @@ private:
 
 	void SetStart();
 
+	//! Evaluates the pushed down filters that can be evaluated on the parsed values, removing the rows that do not
+	//! pass them from sel. Filters over columns that still have to be cast are added to deferred_filters.
+	//! The rows have already been tokenized at this point, the filters only skip the casts of the removed rows. Errors
+	//! found while tokenizing (e.g., values that can not be converted to a primitive type) are still reported.
+	void FilterParsedChunk(DataChunk &parse_chunk, DataChunk &insert_chunk, SelectionVector &sel, idx_t &count,
+	                       vector<idx_t> &deferred_filters);
+
 	StringValueResult result;
 	vector<LogicalType> types;
 
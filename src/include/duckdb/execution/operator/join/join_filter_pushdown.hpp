@@ -15,6 +15,7 @@
 namespace duckdb {
 class DataChunk;
 class DynamicTableFilterSet;
+class JoinHashTable;
 struct GlobalUngroupedAggregateState;
 struct LocalUngroupedAggregateState;
 
@@ -40,6 +41,11 @@ struct JoinFilterLocalState {
 };
 
 struct JoinFilterPushdownInfo {
+	//! Maximum number of distinct build side keys for which we push an exact IN filter into the probe side
+	static constexpr const idx_t IN_FILTER_MAX_DISTINCT_KEYS = 2048;
+	//! Maximum build side size for which we build bloom filters to push into the probe side
+	static constexpr const idx_t BLOOM_FILTER_MAX_BUILD_SIZE = 4194304;
+
 	//! The dynamic table filter set where to push filters into
 	shared_ptr<DynamicTableFilterSet> dynamic_filters;
 	//! The filters that we should generate
@@ -53,7 +59,10 @@ public:
 
 	void Sink(DataChunk &chunk, JoinFilterLocalState &lstate) const;
 	void Combine(JoinFilterGlobalState &gstate, JoinFilterLocalState &lstate) const;
-	void PushFilters(JoinFilterGlobalState &gstate, const PhysicalOperator &op) const;
+	void PushFilters(JoinFilterGlobalState &gstate, JoinHashTable &ht, const PhysicalOperator &op) const;
+
+private:
+	void PushMembershipFilters(JoinHashTable &ht, const vector<idx_t> &filter_idxs, const PhysicalOperator &op) const;
 };
 
 } // namespace duckdb
@@ -135,6 +135,11 @@ public:
 
 	//! Returns the current progress percentage, or a negative value if progress bars are not supported
 	virtual double GetProgress(ClientContext &context, GlobalSourceState &gstate) const;
+	//! Returns extra information about the source that is only known after it has been executed (for profiling)
+	virtual InsertionOrderPreservingMap<string> ExtraSourceParams(GlobalSourceState &gstate,
+	                                                              LocalSourceState &lstate) const {
+		return InsertionOrderPreservingMap<string>();
+	}
 
 	//! Returns the current progress percentage, or a negative value if progress bars are not supported
 	virtual double GetSinkProgress(ClientContext &context, GlobalSinkState &gstate, double source_progress) const {
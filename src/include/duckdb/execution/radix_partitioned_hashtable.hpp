@@ -55,6 +55,8 @@ public:
 	const TupleDataLayout &GetLayout() const;
 	idx_t MaxThreads(GlobalSinkState &sink) const;
 	static void SetMultiScan(GlobalSinkState &sink);
+	//! Number of rows that were sunk without pre-aggregating them in a thread-local HT
+	static idx_t SkippedLookupCount(GlobalSinkState &sink);
 
 private:
 	void SetGroupingValues();
@@ -116,6 +116,23 @@ public:
 	              Vector &result, idx_t count, idx_t row_idx) const override;
 };
 
+//! Maintains a single aggregate state for frames that slide through the partition: the rows that enter the frame are
+//! added to the state and the rows that leave it are removed with the inverse of the update function.
+//! This takes O(1) work per row for frames that move by a constant number of rows.
+class WindowRemovableAggregator : public WindowAggregator {
+public:
+	WindowRemovableAggregator(AggregateObject aggr, const vector<LogicalType> &arg_types_p,
+	                          const LogicalType &result_type_p, const WindowExcludeMode exclude_mode);
+	~WindowRemovableAggregator() override;
+
+	unique_ptr<WindowAggregatorState> GetLocalState(const WindowAggregatorState &gstate) const override;
+	void Evaluate(const WindowAggregatorState &gsink, WindowAggregatorState &lstate, const DataChunk &bounds,
+	              Vector &result, idx_t count, idx_t row_idx) const override;
+
+	//! Whether the aggregate can remove values from its states
+	static bool CanRemove(const AggregateObject &aggr);
+};
+
 class WindowSegmentTree : public WindowAggregator {
 
 public:
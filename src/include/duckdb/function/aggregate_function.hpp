@@ -79,6 +79,28 @@ typedef void (*aggregate_serialize_t)(Serializer &serializer, const optional_ptr
                                       const AggregateFunction &function);
 typedef unique_ptr<FunctionData> (*aggregate_deserialize_t)(Deserializer &deserializer, AggregateFunction &function);
 
+//! Wraps an aggregate operation so that the aggregate executor removes the inputs from the states instead of adding
+//! them, by calling the "Remove" method of the operation
+template <class OP>
+struct AggregateInverseOperation {
+	template <class INPUT_TYPE, class STATE, class INNER_OP>
+	static void Operation(STATE &state, const INPUT_TYPE &input, AggregateUnaryInput &unary_input) {
+		OP::template Remove<INPUT_TYPE, STATE, OP>(state, input, unary_input);
+	}
+
+	template <class INPUT_TYPE, class STATE, class INNER_OP>
+	static void ConstantOperation(STATE &state, const INPUT_TYPE &input, AggregateUnaryInput &unary_input,
+	                              idx_t count) {
+		for (idx_t i = 0; i < count; i++) {
+			OP::template Remove<INPUT_TYPE, STATE, OP>(state, input, unary_input);
+		}
+	}
+
+	static bool IgnoreNull() {
+		return OP::IgnoreNull();
+	}
+};
+
 struct AggregateFunctionInfo {
 	DUCKDB_API virtual ~AggregateFunctionInfo();
 
@@ -164,6 +186,9 @@ public:
 	aggregate_window_t window;
 	//! The windowed aggregate custom initialization function (may be null)
 	aggregate_wininit_t window_init = nullptr;
+	//! The inverse of the hashed aggregate update function, which removes the inputs from the states (may be null)
+	//! Sliding window frames use this to update a single state with the rows that enter and leave the frame
+	aggregate_update_t inverse_update = nullptr;
 
 	//! The bind function (may be null)
 	bind_aggregate_function_t bind;
@@ -258,6 +283,14 @@ public:
 		AggregateExecutor::UnaryScatter<STATE, T, OP>(inputs[0], states, aggr_input_data, count);
 	}
 
+	template <class STATE, class T, class OP>
+	static void UnaryScatterInverse(Vector inputs[], AggregateInputData &aggr_input_data, idx_t input_count,
+	                                Vector &states, idx_t count) {
+		D_ASSERT(input_count == 1);
+		AggregateExecutor::UnaryScatter<STATE, T, AggregateInverseOperation<OP>>(inputs[0], states, aggr_input_data,
+		                                                                        count);
+	}
+
 	template <class STATE, class INPUT_TYPE, class OP>
 	static void UnaryUpdate(Vector inputs[], AggregateInputData &aggr_input_data, idx_t input_count, data_ptr_t state,
 	                        idx_t count) {
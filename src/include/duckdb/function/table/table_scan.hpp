@@ -17,7 +17,9 @@ class DuckTableEntry;
 class TableCatalogEntry;
 
 struct TableScanBindData : public TableFunctionData {
-	explicit TableScanBindData(DuckTableEntry &table) : table(table), is_index_scan(false), is_create_index(false) {
+	explicit TableScanBindData(DuckTableEntry &table)
+	    : table(table), is_index_scan(false), is_create_index(false), ordered_column(DConstants::INVALID_INDEX),
+	      ordered_limit(0) {
 	}
 
 	//! The table to scan
@@ -29,11 +31,21 @@ struct TableScanBindData : public TableFunctionData {
 	bool is_create_index;
 	//! The row ids to fetch in case of an index scan.
 	unsafe_vector<row_t> row_ids;
+	//! The index to follow in case of an ordered index scan.
+	string ordered_index_name;
+	//! The constant values of the leading index columns in case of an ordered index scan.
+	vector<Value> ordered_index_prefix;
+	//! The column whose order the rows are produced in, in case of an ordered index scan.
+	column_t ordered_column;
+	//! The number of rows of the Top-N on top of an ordered index scan.
+	idx_t ordered_limit;
 
 public:
 	bool Equals(const FunctionData &other_p) const override {
 		auto &other = other_p.Cast<TableScanBindData>();
-		return &other.table == &table && row_ids == other.row_ids;
+		return &other.table == &table && row_ids == other.row_ids &&
+		       ordered_index_name == other.ordered_index_name && ordered_index_prefix == other.ordered_index_prefix &&
+		       ordered_column == other.ordered_column && ordered_limit == other.ordered_limit;
 	}
 };
 
@@ -42,6 +54,7 @@ struct TableScanFunction {
 	static void RegisterFunction(BuiltinFunctions &set);
 	static TableFunction GetFunction();
 	static TableFunction GetIndexScanFunction();
+	static TableFunction GetOrderedIndexScanFunction();
 };
 
 } // namespace duckdb
@@ -214,7 +214,11 @@ typedef unique_ptr<NodeStatistics> (*table_function_cardinality_t)(ClientContext
 typedef void (*table_function_pushdown_complex_filter_t)(ClientContext &context, LogicalGet &get,
                                                          FunctionData *bind_data,
                                                          vector<unique_ptr<Expression>> &filters);
+typedef void (*table_function_pushdown_top_n_t)(ClientContext &context, LogicalGet &get, FunctionData *bind_data,
+                                                idx_t column_index, idx_t limit);
 typedef string (*table_function_to_string_t)(const FunctionData *bind_data);
+typedef InsertionOrderPreservingMap<string> (*table_function_dynamic_to_string_t)(
+    GlobalTableFunctionState *global_state);
 
 typedef void (*table_function_serialize_t)(Serializer &serializer, const optional_ptr<FunctionData> bind_data,
                                            const TableFunction &function);
@@ -273,8 +277,14 @@ public:
 	//! (Optional) pushdown a set of arbitrary filter expressions, rather than only simple comparisons with a constant
 	//! Any functions remaining in the expression list will be pushed as a regular filter after the scan
 	table_function_pushdown_complex_filter_t pushdown_complex_filter;
+	//! (Optional) informs the scan that it is the input of a Top-N over the specified column (ASC NULLS LAST), and that
+	//! no operators that filter rows are in between. The scan can then produce its rows in that order (e.g. by
+	//! following an index) and stop after the first "limit" rows. Any filters of the scan still need to be applied.
+	table_function_pushdown_top_n_t pushdown_top_n;
 	//! (Optional) function for rendering the operator to a string in profiling output
 	table_function_to_string_t to_string;
+	//! (Optional) function for rendering information that is only known after the scan has run in profiling output
+	table_function_dynamic_to_string_t dynamic_to_string;
 	//! (Optional) return how much of the table we have scanned up to this point (% of the data)
 	table_function_progress_t table_scan_progress;
 	//! (Optional) returns the current batch index of the current scan operator
@@ -301,6 +311,12 @@ public:
 	//! Whether or not the table function can immediately prune out filter columns that are unused in the remainder of
 	//! the query plan, e.g., "SELECT i FROM tbl WHERE j = 42;" - j does not need to leave the table function at all
 	bool filter_prune;
+	//! Whether or not the table function accepts (dynamic) filters on the row id column. If not supported, filters on
+	//! the row id column are not pushed into the table function
+	bool row_id_filter_pushdown = false;
+	//! Whether or not the table function re-checks its filters while scanning. If not supported, dynamic filters
+	//! (e.g. the boundary of a Top-N heap) are not pushed into the table function
+	bool dynamic_filter_pushdown = false;
 	//! Additional function info, passed to the bind
 	shared_ptr<TableFunctionInfo> function_info;
 
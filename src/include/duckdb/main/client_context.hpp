@@ -250,6 +250,8 @@ private:
 	void BeginQueryInternal(ClientContextLock &lock, const string &query);
 	ErrorData EndQueryInternal(ClientContextLock &lock, bool success, bool invalidate_transaction,
 	                           optional_ptr<ErrorData> previous_error);
+	//! Brings the materialized views up to date with the changes of the transaction that is about to commit
+	void MaintainMaterializedViews(ClientContextLock &lock);
 
 	//! Wait until a task is available to execute
 	void WaitForTask(ClientContextLock &lock, BaseQueryResult &result);
@@ -274,7 +276,8 @@ private:
 
 	shared_ptr<PreparedStatementData>
 	CreatePreparedStatementInternal(ClientContextLock &lock, const string &query, unique_ptr<SQLStatement> statement,
-	                                optional_ptr<case_insensitive_map_t<BoundParameterData>> values);
+	                                optional_ptr<case_insensitive_map_t<BoundParameterData>> values,
+	                                PreparedStatementMode mode);
 
 private:
 	//! Lock on using the ClientContext in parallel
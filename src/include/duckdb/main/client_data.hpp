@@ -61,6 +61,10 @@ struct ClientData {
 	//! The file search path
 	string file_search_path;
 
+	//! Whether or not the materialized views are being maintained by this client - only then can they be modified, and
+	//! they are not maintained again when the transaction commits
+	bool maintaining_materialized_views = false;
+
 	//! The Max Line Length Size of Last Query Executed on a CSV File. (Only used for testing)
 	//! FIXME: this should not be done like this
 	bool debug_set_max_line_length = false;
@@ -20,7 +20,8 @@ struct ClientProperties {
 	ClientProperties(string time_zone_p, ArrowOffsetSize arrow_offset_size_p, bool arrow_use_list_view_p,
 	                 bool produce_arrow_string_view_p, bool lossless_conversion)
 	    : time_zone(std::move(time_zone_p)), arrow_offset_size(arrow_offset_size_p),
-	      arrow_use_list_view(arrow_use_list_view_p), arrow_lossless_conversion(lossless_conversion) {
+	      arrow_use_list_view(arrow_use_list_view_p), produce_arrow_string_view(produce_arrow_string_view_p),
+	      arrow_lossless_conversion(lossless_conversion) {
 	}
 	ClientProperties() {};
 	string time_zone = "UTC";
@@ -14,6 +14,7 @@
 #include "duckdb/common/common.hpp"
 #include "duckdb/common/encryption_state.hpp"
 #include "duckdb/common/enums/access_mode.hpp"
+#include "duckdb/common/enums/buffer_eviction_policy.hpp"
 #include "duckdb/common/enums/compression_type.hpp"
 #include "duckdb/common/enums/optimizer_type.hpp"
 #include "duckdb/common/enums/order_type.hpp"
@@ -124,6 +125,8 @@ struct DBConfigOptions {
 	AccessMode access_mode = AccessMode::AUTOMATIC;
 	//! Checkpoint when WAL reaches this size (default: 16MB)
 	idx_t checkpoint_wal_size = 1 << 24;
+	//! The time (in microseconds) a commit waits for other commits, so their WAL entries can be synced together
+	idx_t wal_commit_delay = 0;
 	//! Whether or not to use Direct IO, bypassing operating system buffers
 	bool use_direct_io = false;
 	//! Whether extensions should be loaded on start-up
@@ -157,6 +160,8 @@ struct DBConfigOptions {
 	bool use_temporary_directory = true;
 	//! Directory to store temporary structures that do not fit in memory
 	string temporary_directory;
+	//! Whether or not to compress blocks that are written to the temporary directory
+	bool temp_file_compression = true;
 	//! Whether or not to invoke filesystem trim on free blocks after checkpoint. This will reclaim
 	//! space for sparse files, on platforms that support it.
 	bool trim_free_blocks = false;
@@ -248,6 +253,12 @@ struct DBConfigOptions {
 	idx_t allocator_bulk_deallocation_flush_threshold = 536870912ULL;
 	//! Whether the allocator background thread is enabled
 	bool allocator_background_threads = false;
+	//! The policy that decides which blocks the buffer manager evicts first
+	BufferEvictionPolicy buffer_eviction_policy = BufferEvictionPolicy::LRU;
+	//! Whether or not the results of SELECT statements are cached
+	bool enable_result_cache = false;
+	//! The maximum amount of memory used by the result cache
+	idx_t result_cache_memory_limit = 67108864ULL;
 	//! DuckDB API surface
 	string duckdb_api;
 	//! Metadata from DuckDB callers
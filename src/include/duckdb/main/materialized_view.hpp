@@ -0,0 +1,34 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/main/materialized_view.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+
+namespace duckdb {
+class BaseTableRef;
+class ClientContext;
+class QueryNode;
+
+//! Materialized views are tables that are kept up to date with the result of their query. They are maintained when a
+//! transaction that changed the tables they read from commits, as part of that transaction.
+//! Aggregates over (joins of) tables that only received appends are maintained incrementally: the query is evaluated
+//! over the appended rows only, and the resulting groups are combined with the stored groups. All other views are
+//! refreshed by re-running their query.
+//! Because the views are updated by the committing transaction itself, two transactions that both change the tables a
+//! view reads from also both update that view: the one that commits last fails with a write-write conflict and is
+//! rolled back, even if the changes to the base tables themselves would not have conflicted.
+class MaterializedView {
+public:
+	//! Returns the statements that bring the materialized views up to date with the changes of the current transaction
+	static vector<string> GetMaintenanceStatements(ClientContext &context);
+	//! Returns the tables that the query of a materialized view reads from
+	static vector<reference<BaseTableRef>> GetTableRefs(QueryNode &node);
+};
+
+} // namespace duckdb
@@ -13,12 +13,14 @@
 #include "duckdb/common/unordered_map.hpp"
 #include "duckdb/common/unordered_set.hpp"
 #include "duckdb/common/winapi.hpp"
+#include "duckdb/main/result_cache.hpp"
 #include "duckdb/planner/expression/bound_parameter_data.hpp"
 #include "duckdb/planner/bound_parameter_map.hpp"
 
 namespace duckdb {
 class CatalogEntry;
 class ClientContext;
+class ColumnDataCollection;
 class PhysicalOperator;
 class SQLStatement;
 
@@ -46,6 +48,13 @@ public:
 	//! Whether we are creating a streaming result or not
 	bool is_streaming = false;
 
+	//! The tables the result of the statement depends on, or nullptr if the result cannot be cached
+	unique_ptr<vector<ResultCacheDependency>> result_cache_dependencies;
+	//! The key under which the result is stored in the result cache (if any)
+	string result_cache_key;
+	//! The cached result that is scanned by the plan (if any)
+	shared_ptr<ColumnDataCollection> cached_result;
+
 public:
 	void CheckParameterCount(idx_t parameter_count);
 	//! Whether or not the prepared statement data requires the query to rebound for the given parameters
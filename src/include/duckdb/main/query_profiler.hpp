@@ -43,6 +43,8 @@ struct OperatorInformation {
 	idx_t elements_returned;
 	idx_t result_set_size;
 	string name;
+	//! Extra information reported by the operator after it has been executed
+	InsertionOrderPreservingMap<string> extra_info;
 
 	void AddTime(double n_time) {
 		time += n_time;
@@ -67,6 +69,8 @@ public:
 
 	DUCKDB_API void StartOperator(optional_ptr<const PhysicalOperator> phys_op);
 	DUCKDB_API void EndOperator(optional_ptr<DataChunk> chunk);
+	//! Adds the extra information of the active (source) operator after it has finished producing data
+	DUCKDB_API void FinishSource(GlobalSourceState &gstate, LocalSourceState &lstate);
 
 	//! Adds the timings in the OperatorProfiler (tree) to the QueryProfiler (tree).
 	DUCKDB_API void Flush(const PhysicalOperator &phys_op);
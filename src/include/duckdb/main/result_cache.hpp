@@ -0,0 +1,117 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/main/result_cache.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/atomic.hpp"
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/enums/statement_type.hpp"
+#include "duckdb/common/list.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/types.hpp"
+#include "duckdb/common/unordered_map.hpp"
+
+namespace duckdb {
+class ClientContext;
+class ColumnDataCollection;
+class DatabaseInstance;
+class LogicalOperator;
+class PreparedStatementData;
+struct DataTableInfo;
+
+//! A table that a cached query result was computed from, together with the commit id of its data at that time
+struct ResultCacheDependency {
+	weak_ptr<DataTableInfo> table;
+	transaction_t commit_id;
+	//! The oids of the catalog and the table entry the query was bound to
+	idx_t catalog_oid;
+	idx_t table_oid;
+};
+
+struct ResultCacheEntry {
+	string key;
+	//! The result names and types of the query
+	vector<string> names;
+	vector<LogicalType> types;
+	//! The statement properties of the query
+	StatementProperties properties;
+	//! The tables the result was computed from
+	vector<ResultCacheDependency> dependencies;
+	//! The cached result - allocated through the buffer manager so it can be offloaded to disk
+	shared_ptr<ColumnDataCollection> collection;
+	//! The memory used by the cached result
+	idx_t size = 0;
+};
+
+struct ResultCacheStatistics {
+	idx_t hits = 0;
+	idx_t misses = 0;
+	idx_t evictions = 0;
+	idx_t invalidations = 0;
+	idx_t entries = 0;
+	idx_t memory_usage = 0;
+	idx_t memory_limit = 0;
+};
+
+//! The ResultCache stores the materialized results of read-only SELECT statements, keyed on the normalized statement
+//! text, the tables it was bound to and the settings that affect the result. An entry is only valid as long as none of the tables it was computed from have
+//! changed, which is tracked through the commit id of the last transaction that changed the data of each table.
+//! Entries of changed tables are invalidated when a transaction commits, catalog changes clear the entire cache.
+class ResultCache {
+public:
+	explicit ResultCache(DatabaseInstance &db);
+	~ResultCache();
+
+	static ResultCache &Get(DatabaseInstance &db);
+	static ResultCache &Get(ClientContext &context);
+
+	//! Whether or not results can be cached or read from the cache in the current transaction of the context
+	static bool CanCache(ClientContext &context);
+	//! Returns the key of a bound statement in the cache
+	static string GetKey(ClientContext &context, const string &query, const vector<ResultCacheDependency> &dependencies);
+	//! Returns the tables read by the (unoptimized) plan, or nullptr if the result of the plan cannot be cached
+	//! Plans that read temporary tables are never cached
+	static unique_ptr<vector<ResultCacheDependency>> GetDependencies(ClientContext &context, LogicalOperator &plan);
+
+	//! Creates a prepared statement that scans the cached result of the statement, or returns nullptr if there is no
+	//! valid cached result that is visible to the current transaction
+	shared_ptr<PreparedStatementData> Lookup(ClientContext &context, const string &key);
+	//! Stores the result of a prepared statement in the cache
+	void Store(const PreparedStatementData &prepared, ColumnDataCollection &result);
+
+	//! Removes all entries of tables that have changed since the entry was stored
+	void Invalidate();
+	//! Removes all entries
+	void Clear();
+
+	void SetMemoryLimit(idx_t limit);
+	ResultCacheStatistics GetStatistics();
+
+private:
+	//! Whether or not all dependencies of an entry are unchanged
+	static bool IsValid(const ResultCacheEntry &entry);
+	void RemoveEntry(list<ResultCacheEntry>::iterator entry);
+	//! Evicts the least recently used entries until the memory usage is below the limit
+	void EvictEntries(idx_t limit);
+
+private:
+	DatabaseInstance &db;
+	mutex lock;
+	//! The cached entries, from most to least recently used
+	list<ResultCacheEntry> entries;
+	//! Map of key -> entry
+	unordered_map<string, list<ResultCacheEntry>::iterator> entry_map;
+	idx_t memory_usage;
+	idx_t memory_limit;
+	atomic<idx_t> hits;
+	atomic<idx_t> misses;
+	atomic<idx_t> evictions;
+	atomic<idx_t> invalidations;
+};
+
+} // namespace duckdb
@@ -0,0 +1,48 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/optimizer/late_materialization.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/vector.hpp"
+#include "duckdb/optimizer/column_binding_replacer.hpp"
+#include "duckdb/planner/logical_operator.hpp"
+
+namespace duckdb {
+class LogicalGet;
+class LogicalProjection;
+class Optimizer;
+
+//! The LateMaterialization optimizer rewrites a Top-N over a (wide) scan, e.g. SELECT * FROM tbl ORDER BY ts LIMIT 100
+//! The Top-N is first computed over only the sort keys and a row identifier - the row id for DuckDB tables, or the
+//! file_row_number for Parquet files. The remaining columns are then only fetched for the selected rows, by joining
+//! the Top-N back to the scan on the row identifier. The small build side of the join pushes an exact filter on the row
+//! identifier into the scan, which allows DuckDB tables to fetch the rows directly and Parquet files to skip row groups.
+//! The rewrite is only performed if that filter is guaranteed to be pushed, and the scan keeps its own filters.
+class LateMaterialization {
+public:
+	explicit LateMaterialization(Optimizer &optimizer);
+
+	unique_ptr<LogicalOperator> Optimize(unique_ptr<LogicalOperator> op);
+
+private:
+	void OptimizeInternal(unique_ptr<LogicalOperator> &op);
+	//! Try to rewrite the Top-N in "op" - returns true if the rewrite was performed
+	bool TryLateMaterialization(unique_ptr<LogicalOperator> &op);
+	//! Returns the column ids that uniquely identify a row of the scan (or an empty list if there are none)
+	static vector<column_t> GetRowIdColumns(LogicalGet &get);
+	//! Resolves a binding of the operator above "projections" to a column of the scan
+	static bool ResolveScanColumn(ColumnBinding &binding, const vector<reference<LogicalProjection>> &projections,
+	                              LogicalGet &get);
+
+private:
+	Optimizer &optimizer;
+	//! For every rewrite - the bindings to update in the operators above the rewritten Top-N
+	vector<ColumnBindingReplacer> replacers;
+};
+
+} // namespace duckdb
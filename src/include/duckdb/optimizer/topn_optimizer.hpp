@@ -11,15 +11,27 @@
 #include "duckdb/common/constants.hpp"
 
 namespace duckdb {
+class ClientContext;
 class LogicalOperator;
+class LogicalTopN;
 class Optimizer;
 
 class TopN {
 public:
+	explicit TopN(ClientContext &context);
+
 	//! Optimize ORDER BY + LIMIT to TopN
 	unique_ptr<LogicalOperator> Optimize(unique_ptr<LogicalOperator> op);
 	//! Whether we can perform the optimization on this operator
 	static bool CanOptimize(LogicalOperator &op);
+
+private:
+	//! Pushes the boundary value of the Top-N heap as a dynamic filter into the scan (if possible)
+	//! If there are no filters in between, the scan is also informed of the Top-N itself
+	void PushdownDynamicFilters(LogicalTopN &op);
+
+private:
+	ClientContext &context;
 };
 
 } // namespace duckdb
@@ -24,6 +24,26 @@ class TaskScheduler;
 
 struct SchedulerThread;
 
+//! Statistics of the task queue of a worker thread
+struct SchedulerWorkerInfo {
+	//! The id of the worker thread
+	idx_t worker_id;
+	//! The NUMA node the worker last executed a task on
+	idx_t numa_node;
+	//! The amount of tasks currently in the queue of the worker
+	idx_t queued_tasks;
+	//! The amount of tasks scheduled by the worker in its own queue
+	idx_t scheduled_tasks;
+	//! The amount of tasks executed by the worker
+	idx_t executed_tasks;
+	//! The amount of tasks the worker has stolen from the queues of other workers
+	idx_t stolen_tasks;
+	//! The amount of times the worker was woken up, but could not find a task to execute
+	idx_t failed_steals;
+	//! The amount of times a thread had to wait for the lock on the queue of the worker
+	idx_t lock_contention;
+};
+
 struct ProducerToken {
 	ProducerToken(TaskScheduler &scheduler, unique_ptr<QueueProducerToken> token);
 	~ProducerToken();
@@ -34,6 +54,9 @@ struct ProducerToken {
 };
 
 //! The TaskScheduler is responsible for managing tasks and threads
+//! Every worker thread has its own task queue. Tasks scheduled by a worker are added to its own queue, tasks scheduled
+//! by other threads (e.g. the thread executing a query) are added to a global queue. Idle workers steal tasks from the
+//! queues of other workers, preferring workers that run on the same NUMA node.
 class TaskScheduler {
 	// timeout for semaphore wait, default 5ms
 	constexpr static int64_t TASK_TIMEOUT_USECS = 5000;
@@ -84,12 +107,15 @@ public:
 	//! Result do not need to be exact 'return 0' is a valid fallback strategy
 	static idx_t GetEstimatedCPUId();
 
+	//! Returns the task queue statistics of the worker threads
+	vector<SchedulerWorkerInfo> GetWorkerInfo();
+
 private:
 	void RelaunchThreadsInternal(int32_t n);
 
 private:
 	DatabaseInstance &db;
-	//! The task queue
+	//! The task queues
 	unique_ptr<ConcurrentQueue> queue;
 	//! Lock for modifying the thread count
 	mutex thread_lock;
@@ -52,6 +52,10 @@ public:
 	const duckdb::CompressionType &CompressionType() const;
 	void SetCompressionType(duckdb::CompressionType compression_type);
 
+	//! bloom_filter
+	bool HasBloomFilter() const;
+	void SetBloomFilter(bool bloom_filter);
+
 	//! storage_oid
 	const storage_t &StorageOid() const;
 	void SetStorageOid(storage_t storage_oid);
@@ -93,6 +97,8 @@ private:
 	LogicalType type;
 	//! Compression Type used for this column
 	duckdb::CompressionType compression_type = duckdb::CompressionType::COMPRESSION_AUTO;
+	//! Whether or not a bloom filter over the values of this column is stored for every row group
+	bool bloom_filter = false;
 	//! The index of the column in the storage of the table
 	storage_t storage_oid = DConstants::INVALID_INDEX;
 	//! The index of the column in the table
@@ -32,6 +32,8 @@ struct CreateTableInfo : public CreateInfo {
 	vector<unique_ptr<Constraint>> constraints;
 	//! CREATE TABLE as QUERY
 	unique_ptr<SelectStatement> query;
+	//! The query of a materialized view - the table is kept up to date with the result of this query
+	unique_ptr<SelectStatement> view_query;
 
 public:
 	DUCKDB_API unique_ptr<CreateInfo> Copy() const override;
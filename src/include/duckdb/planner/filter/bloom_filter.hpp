@@ -0,0 +1,42 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/planner/filter/bloom_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/planner/table_filter.hpp"
+#include "duckdb/common/blocked_bloom_filter.hpp"
+
+namespace duckdb {
+struct UnifiedVectorFormat;
+
+//! The BloomFilter is an approximate membership filter (e.g. generated from the build side of a hash join)
+//! It can have false positives, so it can only be used to remove rows early - never to decide that a row qualifies
+class BloomFilter : public TableFilter {
+public:
+	static constexpr const TableFilterType TYPE = TableFilterType::BLOOM_FILTER;
+
+public:
+	explicit BloomFilter(shared_ptr<BlockedBloomFilter> filter);
+
+	//! The (shared, immutable) bloom filter
+	shared_ptr<BlockedBloomFilter> filter;
+
+public:
+	//! Filters the rows in "sel" of the given vector, keeping only the (non-NULL) rows that might be in the filter
+	idx_t Filter(Vector &vector, UnifiedVectorFormat &vdata, SelectionVector &sel, idx_t &approved_tuple_count) const;
+
+	FilterPropagateResult CheckStatistics(BaseStatistics &stats) override;
+	string ToString(const string &column_name) override;
+	bool Equals(const TableFilter &other) const override;
+	unique_ptr<TableFilter> Copy() const override;
+	unique_ptr<Expression> ToExpression(const Expression &column) const override;
+	void Serialize(Serializer &serializer) const override;
+	static unique_ptr<TableFilter> Deserialize(Deserializer &deserializer);
+};
+
+} // namespace duckdb
@@ -0,0 +1,64 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/planner/filter/dynamic_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/enums/expression_type.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/table_filter.hpp"
+
+namespace duckdb {
+
+//! The (shared) state of a dynamic filter - a constant comparison that is tightened while the query is running
+struct DynamicFilterData {
+	explicit DynamicFilterData(ExpressionType comparison_type);
+
+	//! The comparison type of the filter (e.g. COMPARE_LESSTHANOREQUALTO)
+	ExpressionType comparison_type;
+	//! Lock protecting the filter
+	mutex lock;
+	//! The current filter (if initialized)
+	unique_ptr<ConstantFilter> filter;
+	//! Whether or not the filter has been set
+	bool initialized;
+
+public:
+	//! Sets the constant of the filter - only if this makes the filter more selective
+	void SetValue(const Value &value);
+	//! Resets the filter, e.g. when a query is re-executed
+	void Reset();
+};
+
+//! The DynamicFilter is a filter that is updated by another operator while the scan is running, e.g. by a Top-N
+//! operator publishing the boundary value of its heap
+class DynamicFilter : public TableFilter {
+public:
+	static constexpr const TableFilterType TYPE = TableFilterType::DYNAMIC_FILTER;
+
+public:
+	DynamicFilter();
+	explicit DynamicFilter(shared_ptr<DynamicFilterData> filter_data);
+
+	//! The shared filter state
+	shared_ptr<DynamicFilterData> filter_data;
+
+public:
+	//! Returns a copy of the current filter, or nullptr if the filter has not been set (yet)
+	unique_ptr<TableFilter> GetFilter() const;
+
+	FilterPropagateResult CheckStatistics(BaseStatistics &stats) override;
+	string ToString(const string &column_name) override;
+	bool Equals(const TableFilter &other) const override;
+	unique_ptr<TableFilter> Copy() const override;
+	unique_ptr<Expression> ToExpression(const Expression &column) const override;
+	void Serialize(Serializer &serializer) const override;
+	static unique_ptr<TableFilter> Deserialize(Deserializer &deserializer);
+};
+
+} // namespace duckdb
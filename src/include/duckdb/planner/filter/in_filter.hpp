@@ -0,0 +1,49 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/planner/filter/in_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/planner/table_filter.hpp"
+#include "duckdb/common/types/selection_vector.hpp"
+#include "duckdb/common/types/value.hpp"
+
+namespace duckdb {
+struct InFilterLookup;
+struct UnifiedVectorFormat;
+
+//! The InFilter checks membership in an (exact) list of non-NULL values, e.g. the keys of a small hash join build side
+class InFilter : public TableFilter {
+public:
+	static constexpr const TableFilterType TYPE = TableFilterType::IN_FILTER;
+
+public:
+	explicit InFilter(vector<Value> values);
+
+	//! The (sorted, distinct) values to filter on
+	vector<Value> values;
+
+public:
+	//! Filters the rows in "sel" of the given vector, keeping only the rows that have a value in the list
+	idx_t Filter(Vector &vector, UnifiedVectorFormat &vdata, SelectionVector &sel, idx_t &approved_tuple_count) const;
+
+	FilterPropagateResult CheckStatistics(BaseStatistics &stats) override;
+	string ToString(const string &column_name) override;
+	bool Equals(const TableFilter &other) const override;
+	unique_ptr<TableFilter> Copy() const override;
+	unique_ptr<Expression> ToExpression(const Expression &column) const override;
+	void Serialize(Serializer &serializer) const override;
+	static unique_ptr<TableFilter> Deserialize(Deserializer &deserializer);
+
+private:
+	InFilter(vector<Value> values, shared_ptr<InFilterLookup> lookup);
+
+	//! The hash set used to probe the values (shared between copies of the filter)
+	shared_ptr<InFilterLookup> lookup;
+};
+
+} // namespace duckdb
@@ -28,7 +28,10 @@ enum class TableFilterType : uint8_t {
 	IS_NOT_NULL = 2,
 	CONJUNCTION_OR = 3,
 	CONJUNCTION_AND = 4,
-	STRUCT_EXTRACT = 5
+	STRUCT_EXTRACT = 5,
+	BLOOM_FILTER = 6, // approximate membership filter (e.g. from the build side of a hash join)
+	IN_FILTER = 7,    // exact membership filter (e.g. IN (C1, C2, ...))
+	DYNAMIC_FILTER = 8 // filter that is updated while the scan is running (e.g. the boundary of a Top-N heap)
 };
 
 //! TableFilter represents a filter pushed down into the table scan.
@@ -22,6 +22,17 @@ class ClientContext;
 class DatabaseInstance;
 class MetadataManager;
 
+//! A read of block_count consecutive blocks starting at start_block into a buffer
+struct BlockReadRange {
+	BlockReadRange(FileBuffer &buffer, block_id_t start_block, idx_t block_count)
+	    : buffer(buffer), start_block(start_block), block_count(block_count) {
+	}
+
+	reference<FileBuffer> buffer;
+	block_id_t start_block;
+	idx_t block_count;
+};
+
 //! BlockManager is an abstract representation to manage blocks on DuckDB. When writing or reading blocks, the
 //! BlockManager creates and accesses blocks. The concrete types implement specific block storage strategies.
 class BlockManager {
@@ -58,6 +69,12 @@ public:
 	virtual void Read(Block &block) = 0;
 	//! Read the content of the block from disk
 	virtual void ReadBlocks(FileBuffer &buffer, block_id_t start_block, idx_t block_count) = 0;
+	//! Read multiple ranges of blocks as a single batch - the default implementation reads the ranges one-by-one
+	virtual void ReadBlocks(const vector<BlockReadRange> &ranges);
+	//! Whether or not batches of reads are performed asynchronously, i.e. whether prefetching blocks is beneficial
+	virtual bool SupportsAsyncReads() {
+		return false;
+	}
 	//! Writes the block to disk
 	virtual void Write(FileBuffer &block, block_id_t block_id) = 0;
 	//! Writes the block to disk
@@ -119,6 +119,10 @@ public:
 	bool IsUnloaded() {
 		return state == BlockState::BLOCK_UNLOADED;
 	}
+	//! Hint that the next load of this block is done by a sequential scan
+	inline void SetScanHint() {
+		scan_hint = true;
+	}
 
 private:
 	BufferHandle Load(unique_ptr<FileBuffer> buffer = nullptr);
@@ -152,6 +156,14 @@ private:
 	BufferPoolReservation memory_charge;
 	//! Does the block contain any memory pointers?
 	const char *unswizzled;
+	//! Whether the next load of this block is done by a sequential scan
+	atomic<bool> scan_hint;
+	//! Whether the block was loaded by a scan and has not been used again since
+	bool probationary;
+	//! Whether the block was prefetched and has not been pinned since
+	bool prefetched;
+	//! The eviction queue that holds the latest eviction node of this block
+	idx_t eviction_queue_idx;
 };
 
 } // namespace duckdb
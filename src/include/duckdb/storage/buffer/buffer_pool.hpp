@@ -9,6 +9,7 @@
 #pragma once
 
 #include "duckdb/common/array.hpp"
+#include "duckdb/common/enums/buffer_eviction_policy.hpp"
 #include "duckdb/common/enums/memory_tag.hpp"
 #include "duckdb/common/file_buffer.hpp"
 #include "duckdb/common/mutex.hpp"
@@ -51,6 +52,10 @@ public:
 	//! If bulk deallocation larger than this occurs, flush outstanding allocations
 	void SetAllocatorBulkDeallocationFlushThreshold(idx_t threshold);
 
+	//! Set the policy that decides which blocks are evicted first, this resets the hit/miss/eviction counters
+	void SetEvictionPolicy(BufferEvictionPolicy policy);
+	BufferEvictionPolicy GetEvictionPolicy() const;
+
 	void UpdateUsedMemory(MemoryTag tag, int64_t size);
 
 	idx_t GetUsedMemory() const;
@@ -87,8 +92,14 @@ protected:
 	bool AddToEvictionQueue(shared_ptr<BlockHandle> &handle);
 	//! Gets the eviction queue for the specified type
 	EvictionQueue &GetEvictionQueueForType(FileBufferType type);
-	//! Increments the dead nodes for the queue with specified type
-	void IncrementDeadNodes(FileBufferType type);
+	//! Gets the index of the eviction queue that the block handle should be added to
+	idx_t GetEvictionQueueIndex(BlockHandle &handle) const;
+	//! Increments the dead nodes for the queue that holds the latest eviction node of the block handle
+	void IncrementDeadNodes(BlockHandle &handle);
+	//! Registers that a block was pinned while it was loaded already - the block handle must be locked
+	void RegisterBlockHit(BlockHandle &handle);
+	//! Registers that a block was loaded, either by a pin or by a prefetch - the block handle must be locked
+	void RegisterBlockLoad(BlockHandle &handle, bool prefetch);
 
 protected:
 	enum class MemoryUsageCaches {
@@ -142,8 +153,16 @@ protected:
 	atomic<idx_t> allocator_bulk_deallocation_flush_threshold;
 	//! Record timestamps of buffer manager unpin() events. Usable by custom eviction policies.
 	bool track_eviction_timestamps;
-	//! Eviction queues
+	//! Eviction queues, one per FileBufferType followed by the probation queue
 	vector<unique_ptr<EvictionQueue>> queues;
+	//! The index of the queue that holds blocks that were loaded by a scan and were not used since
+	static constexpr idx_t PROBATION_QUEUE_INDEX = FILE_BUFFER_TYPE_COUNT;
+	//! The eviction policy
+	atomic<BufferEvictionPolicy> eviction_policy;
+	//! Per memory tag: how often a block of persistent storage was pinned while loaded, loaded, and evicted
+	array<atomic<idx_t>, MEMORY_TAG_COUNT> buffer_hits;
+	array<atomic<idx_t>, MEMORY_TAG_COUNT> buffer_misses;
+	array<atomic<idx_t>, MEMORY_TAG_COUNT> buffer_evictions;
 	//! Memory manager for concurrently used temporary memory, e.g., for physical operators
 	unique_ptr<TemporaryMemoryManager> temporary_memory_manager;
 	//! To improve performance, MemoryUsage maintains counter caches based on current cpu or thread id,
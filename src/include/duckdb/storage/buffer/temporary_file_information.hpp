@@ -9,11 +9,19 @@ struct MemoryInformation {
 	MemoryTag tag;
 	idx_t size;
 	idx_t evicted_data;
+	//! How often blocks of persistent storage were pinned while loaded, loaded, and evicted
+	idx_t buffer_hits;
+	idx_t buffer_misses;
+	idx_t buffer_evictions;
 };
 
 struct TemporaryFileInformation {
 	string path;
 	idx_t size;
+	//! The size on disk of the blocks that are currently stored in the file
+	idx_t compressed_size;
+	//! The size of the blocks that are currently stored in the file before compression
+	idx_t uncompressed_size;
 };
 
 } // namespace duckdb
@@ -29,6 +29,7 @@ public:
 	}
 
 	CompressionType GetColumnCompressionType(idx_t i);
+	bool ColumnHasBloomFilter(idx_t i);
 
 	virtual CheckpointType GetCheckpointType() const = 0;
 	virtual MetadataWriter &GetPayloadWriter() = 0;
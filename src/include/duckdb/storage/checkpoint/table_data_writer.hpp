@@ -13,6 +13,7 @@
 namespace duckdb {
 class DuckTableEntry;
 class TableStatistics;
+class TaskExecutor;
 
 //! The table data writer is responsible for writing the data of a table to
 //! storage.
@@ -27,7 +28,12 @@ public:
 	virtual ~TableDataWriter();
 
 public:
+	//! Schedules the tasks that write the row groups of the table to disk on the executor. This can be done for
+	//! multiple tables at the same time, WriteTableData then only writes the metadata.
+	void ScheduleTableData(TaskExecutor &executor);
 	void WriteTableData(Serializer &metadata_serializer);
+	//! Flushes the partially filled blocks of the table data to disk
+	virtual void FlushPartialBlocks() = 0;
 
 	CompressionType GetColumnCompressionType(idx_t i);
 
@@ -55,11 +61,14 @@ public:
 	void FinalizeTable(const TableStatistics &global_stats, DataTableInfo *info, Serializer &serializer) override;
 	unique_ptr<RowGroupWriter> GetRowGroupWriter(RowGroup &row_group) override;
 	CheckpointType GetCheckpointType() const override;
+	void FlushPartialBlocks() override;
 
 private:
 	SingleFileCheckpointWriter &checkpoint_manager;
 	//! Writes the actual table data
 	MetadataWriter &table_data_writer;
+	//! The partially filled blocks of the table data - every table has its own so tables can be written in parallel
+	PartialBlockManager partial_block_manager;
 };
 
 } // namespace duckdb
@@ -11,6 +11,7 @@
 #include "duckdb/storage/partial_block_manager.hpp"
 #include "duckdb/catalog/catalog_entry/index_catalog_entry.hpp"
 #include "duckdb/catalog/catalog.hpp"
+#include "duckdb/common/reference_map.hpp"
 
 namespace duckdb {
 class DatabaseInstance;
@@ -91,6 +92,15 @@ public:
 //! CheckpointWriter is responsible for checkpointing the database
 class SingleFileRowGroupWriter;
 class SingleFileTableDataWriter;
+class StorageLockKey;
+
+//! A table of which the row groups have been written to disk, but of which the metadata has not been written yet
+struct PendingTableData {
+	//! The (exclusive) checkpoint lock of the table
+	unique_ptr<StorageLockKey> checkpoint_lock;
+	//! The writer of the table data
+	unique_ptr<TableDataWriter> writer;
+};
 
 class SingleFileCheckpointWriter final : public CheckpointWriter {
 	friend class SingleFileRowGroupWriter;
@@ -98,6 +108,7 @@ class SingleFileCheckpointWriter final : public CheckpointWriter {
 
 public:
 	SingleFileCheckpointWriter(AttachedDatabase &db, BlockManager &block_manager, CheckpointType checkpoint_type);
+	~SingleFileCheckpointWriter() override;
 
 	//! Checkpoint the current state of the WAL and flush it to the main storage. This should be called BEFORE any
 	//! connection is available because right now the checkpointing cannot be done online. (TODO)
@@ -115,14 +126,18 @@ public:
 public:
 	void WriteTable(TableCatalogEntry &table, Serializer &serializer) override;
 
+private:
+	//! Writes the row groups of all tables to disk in parallel. Returns false if this was not possible because the
+	//! checkpoint lock of a table could not be obtained, in which case the tables are written one-by-one instead.
+	bool WriteTableData(catalog_entry_vector_t &catalog_entries);
+
 private:
 	//! The metadata writer is responsible for writing schema information
 	unique_ptr<MetadataWriter> metadata_writer;
 	//! The table data writer is responsible for writing the DataPointers used by the table chunks
 	unique_ptr<MetadataWriter> table_metadata_writer;
-	//! Because this is single-file storage, we can share partial blocks across
-	//! an entire checkpoint.
-	PartialBlockManager partial_block_manager;
+	//! The tables of which the row groups have been written by WriteTableData
+	reference_map_t<TableCatalogEntry, PendingTableData> pending_tables;
 	//! Checkpoint type
 	CheckpointType checkpoint_type;
 	//! Block usage count for verification purposes
@@ -39,6 +39,7 @@ class TableIOManager;
 class Transaction;
 class WriteAheadLog;
 class TableDataWriter;
+class TaskExecutor;
 class ConflictManager;
 class TableScanState;
 struct TableDeleteState;
@@ -187,6 +188,10 @@ public:
 	unique_ptr<StorageLockKey> GetSharedCheckpointLock();
 	//! Obtains a lock during a checkpoint operation that prevents other threads from reading this table
 	unique_ptr<StorageLockKey> GetCheckpointLock();
+	//! Try to obtain the exclusive checkpoint lock, returns nullptr if the lock cannot be obtained immediately
+	unique_ptr<StorageLockKey> TryGetCheckpointLock();
+	//! Schedule writing the row groups of the table to the specified table data writer on the executor
+	void ScheduleCheckpoint(TableDataWriter &writer, TaskExecutor &executor);
 	//! Checkpoint the table to the specified table data writer
 	void Checkpoint(TableDataWriter &writer, Serializer &serializer);
 	void CommitDropTable();
@@ -27,6 +27,8 @@ public:
 
 	BlockPointer GetBlockPointer();
 	MetaBlockPointer GetMetaBlockPointer();
+	//! Sets the vector to which the pointers of all blocks that are written to from now on are added (if any)
+	void SetWrittenPointers(optional_ptr<vector<MetaBlockPointer>> written_pointers);
 	MetadataManager &GetManager() {
 		return manager;
 	}
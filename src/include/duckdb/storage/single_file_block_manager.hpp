@@ -67,6 +67,10 @@ public:
 	void Read(Block &block) override;
 	//! Read the content of a range of blocks into a buffer
 	void ReadBlocks(FileBuffer &buffer, block_id_t start_block, idx_t block_count) override;
+	//! Read multiple ranges of blocks in a single batch of reads
+	void ReadBlocks(const vector<BlockReadRange> &ranges) override;
+	//! Whether or not the file system reads batches asynchronously
+	bool SupportsAsyncReads() override;
 	//! Write the given block to disk
 	void Write(FileBuffer &block, block_id_t block_id) override;
 	//! Write the header to disk, this is the final step of the checkpointing process
@@ -94,6 +98,8 @@ private:
 	void Initialize(const DatabaseHeader &header, const optional_idx block_alloc_size);
 
 	void ReadAndChecksum(FileBuffer &handle, uint64_t location) const;
+	//! Verify the checksums of a range of blocks that was read into a buffer
+	void VerifyBlockChecksums(FileBuffer &buffer, block_id_t start_block, idx_t block_count);
 	void ChecksumAndWrite(FileBuffer &handle, uint64_t location) const;
 
 	idx_t GetBlockLocation(block_id_t block_id);
@@ -150,8 +150,9 @@ protected:
 	//! overwrites the data within with garbage. Any readers that do not hold the pin will notice
 	void VerifyZeroReaders(shared_ptr<BlockHandle> &handle);
 
+	//! Load the blocks of a range that was read into an intermediate buffer into their block handles
 	void BatchRead(vector<shared_ptr<BlockHandle>> &handles, const map<block_id_t, idx_t> &load_map,
-	               block_id_t first_block, block_id_t last_block);
+	               const BlockReadRange &range);
 
 protected:
 	// These are stored here because temp_directory creation is lazy
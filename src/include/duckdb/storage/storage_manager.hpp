@@ -34,7 +34,7 @@ public:
 
 	//! Revert the commit
 	virtual void RevertCommit() = 0;
-	// Make the commit persistent
+	// Write the end of the commit - the commit is made durable by syncing the WAL (WriteAheadLog::SyncCommit)
 	virtual void FlushCommit() = 0;
 
 	virtual void AddRowGroupData(DataTable &table, idx_t start_index, idx_t count,
@@ -33,6 +33,8 @@ struct ColumnCheckpointState {
 	ColumnSegmentTree new_tree;
 	vector<DataPointer> data_pointers;
 	unique_ptr<BaseStatistics> global_stats;
+	//! Bloom filter over the checkpointed values of the column (if enabled for the column)
+	shared_ptr<BlockedBloomFilter> bloom_filter;
 
 protected:
 	PartialBlockManager &partial_block_manager;
@@ -20,6 +20,7 @@
 #include "duckdb/common/serializer/serialization_traits.hpp"
 
 namespace duckdb {
+class BlockedBloomFilter;
 class ColumnData;
 class ColumnSegment;
 class DatabaseInstance;
@@ -43,6 +44,7 @@ struct ColumnCheckpointInfo {
 
 public:
 	CompressionType GetCompressionType();
+	bool HasBloomFilter();
 };
 
 class ColumnData {
@@ -206,6 +208,9 @@ protected:
 	mutable mutex stats_lock;
 	//! The stats of the root segment
 	unique_ptr<SegmentStatistics> stats;
+	//! Bloom filter over the values of the column (if any) - only set while the column matches its persistent data,
+	//! protected by the stats_lock
+	shared_ptr<BlockedBloomFilter> bloom_filter;
 	//! Total transient allocation size
 	idx_t allocation_size;
 };
@@ -224,6 +229,8 @@ struct PersistentColumnData {
 	PhysicalType physical_type;
 	vector<DataPointer> pointers;
 	vector<PersistentColumnData> child_columns;
+	//! Bloom filter over the values of the column (if any)
+	shared_ptr<BlockedBloomFilter> bloom_filter;
 	bool has_updates = false;
 
 	void Serialize(Serializer &serializer) const;
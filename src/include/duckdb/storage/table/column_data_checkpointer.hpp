@@ -34,6 +34,8 @@ private:
 	void ScanSegments(const std::function<void(Vector &, idx_t)> &callback);
 	unique_ptr<AnalyzeState> DetectBestCompressionMethod(idx_t &compression_idx);
 	void WriteToDisk();
+	//! Builds a bloom filter from the hashes of all values of the column
+	void BuildBloomFilter(vector<hash_t> &hashes);
 	bool HasChanges();
 	void WritePersistentSegments();
 
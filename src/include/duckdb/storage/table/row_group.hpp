@@ -50,12 +50,16 @@ class StorageCommitState;
 
 struct RowGroupWriteInfo {
 	RowGroupWriteInfo(PartialBlockManager &manager, const vector<CompressionType> &compression_types,
+	                  const vector<bool> &bloom_filters,
 	                  CheckpointType checkpoint_type = CheckpointType::FULL_CHECKPOINT)
-	    : manager(manager), compression_types(compression_types), checkpoint_type(checkpoint_type) {
+	    : manager(manager), compression_types(compression_types), bloom_filters(bloom_filters),
+	      checkpoint_type(checkpoint_type) {
 	}
 
 	PartialBlockManager &manager;
 	const vector<CompressionType> &compression_types;
+	//! For every column, whether or not a bloom filter over its values should be stored
+	const vector<bool> &bloom_filters;
 	CheckpointType checkpoint_type;
 };
 
@@ -143,6 +147,10 @@ public:
 	idx_t GetCommittedRowCount();
 	RowGroupWriteData WriteToDisk(RowGroupWriter &writer);
 	RowGroupPointer Checkpoint(RowGroupWriteData write_data, RowGroupWriter &writer, TableStatistics &global_stats);
+	//! Checkpoint a row group without changes, re-using the column data and metadata that is already on disk
+	RowGroupPointer Checkpoint(RowGroupWriter &writer);
+	//! Whether or not the column data has changed since it was last read from or written to disk
+	bool HasChanges() const;
 	bool IsPersistent() const;
 	PersistentRowGroupData SerializeRowGroupInfo() const;
 
@@ -198,9 +206,13 @@ private:
 private:
 	mutex row_group_lock;
 	vector<MetaBlockPointer> column_pointers;
+	//! The metadata blocks the column data of each column is stored in, empty if the column has not been loaded
+	vector<vector<MetaBlockPointer>> column_metadata_blocks;
 	unique_ptr<atomic<bool>[]> is_loaded;
 	vector<MetaBlockPointer> deletes_pointers;
 	atomic<bool> deletes_is_loaded;
+	//! Whether the column data was modified since the column metadata was read from or written to disk
+	atomic<bool> has_changes;
 	idx_t allocation_size;
 };
 
@@ -34,11 +34,13 @@ struct VacuumState;
 struct CollectionCheckpointState;
 struct PersistentCollectionData;
 class CheckpointTask;
+class TaskExecutor;
 
 class RowGroupCollection {
 public:
 	RowGroupCollection(shared_ptr<DataTableInfo> info, BlockManager &block_manager, vector<LogicalType> types,
 	                   idx_t row_start, idx_t total_rows = 0);
+	~RowGroupCollection();
 
 public:
 	idx_t GetTotalRows() const;
@@ -95,6 +97,11 @@ public:
 	void UpdateColumn(TransactionData transaction, Vector &row_ids, const vector<column_t> &column_path,
 	                  DataChunk &updates);
 
+	//! Schedules the tasks that write the changed row groups to disk on the executor. This is the first phase of a
+	//! checkpoint, which can run concurrently for multiple tables.
+	void ScheduleCheckpoint(TableDataWriter &writer, TaskExecutor &executor);
+	//! Writes the metadata of the row groups. If ScheduleCheckpoint was not called before, the row groups are written
+	//! to disk first.
 	void Checkpoint(TableDataWriter &writer, TableStatistics &global_stats);
 
 	void InitializeVacuumState(CollectionCheckpointState &checkpoint_state, VacuumState &state,
@@ -152,6 +159,8 @@ private:
 	TableStatistics stats;
 	//! Allocation size, only tracked for appends
 	idx_t allocation_size;
+	//! The state of a checkpoint for which the row groups are being written to disk (if any)
+	unique_ptr<CollectionCheckpointState> checkpoint_state;
 };
 
 } // namespace duckdb
@@ -27,7 +27,7 @@ class TemporaryFileManager;
 
 struct BlockIndexManager {
 public:
-	explicit BlockIndexManager(TemporaryFileManager &manager);
+	BlockIndexManager(TemporaryFileManager &manager, idx_t block_size);
 	BlockIndexManager();
 
 public:
@@ -37,6 +37,8 @@ public:
 	//! Returns true if the max_index has been altered
 	bool RemoveIndex(idx_t index);
 	idx_t GetMaxIndex();
+	//! Returns the number of indexes that are currently in use
+	idx_t GetUsedIndexCount();
 	bool HasFreeBlocks();
 
 private:
@@ -48,6 +50,8 @@ private:
 	set<idx_t> free_indexes;
 	set<idx_t> indexes_in_use;
 	optional_ptr<TemporaryFileManager> manager;
+	//! The size of a block, used to report size changes to the manager
+	idx_t block_size;
 };
 
 //===--------------------------------------------------------------------===//
@@ -75,7 +79,7 @@ class TemporaryFileHandle {
 
 public:
 	TemporaryFileHandle(idx_t temp_file_count, DatabaseInstance &db, const string &temp_directory, idx_t index,
-	                    TemporaryFileManager &manager);
+	                    idx_t slot_size, TemporaryFileManager &manager);
 
 public:
 	struct TemporaryFileLock {
@@ -88,16 +92,21 @@ public:
 
 public:
 	TemporaryFileIndex TryGetBlockIndex();
-	void WriteTemporaryFile(FileBuffer &buffer, TemporaryFileIndex index);
+	//! Writes a buffer to the file - if compressed_buffer is set the (compressed) buffer is written instead
+	void WriteTemporaryFile(FileBuffer &buffer, TemporaryFileIndex index, AllocatedData &compressed_buffer);
 	unique_ptr<FileBuffer> ReadTemporaryBuffer(idx_t block_index, unique_ptr<FileBuffer> reusable_buffer);
 	void EraseBlockIndex(block_id_t block_index);
 	bool DeleteIfEmpty();
 	TemporaryFileInformation GetTemporaryFile();
+	idx_t GetSlotSize() const {
+		return slot_size;
+	}
 
 private:
 	void CreateFileIfNotExists(TemporaryFileLock &);
 	void RemoveTempBlockIndex(TemporaryFileLock &, idx_t index);
 	idx_t GetPositionInFile(idx_t index);
+	bool IsCompressed() const;
 
 private:
 	const idx_t max_allowed_index;
@@ -105,6 +114,8 @@ private:
 	unique_ptr<FileHandle> handle;
 	idx_t file_index;
 	string path;
+	//! The size of the slots in this file - smaller than the block allocation size if the blocks are compressed
+	idx_t slot_size;
 	mutex file_lock;
 	BlockIndexManager index_manager;
 };
@@ -132,6 +143,12 @@ private:
 //===--------------------------------------------------------------------===//
 
 class TemporaryFileManager {
+public:
+	//! Compressed blocks are stored in slots that are a multiple of this size
+	static constexpr idx_t COMPRESSED_SLOT_ALIGNMENT = 32768;
+	//! Compressed blocks are prefixed with their compressed size and a checksum
+	static constexpr idx_t COMPRESSED_HEADER_SIZE = sizeof(idx_t) + sizeof(uint64_t);
+
 public:
 	TemporaryFileManager(DatabaseInstance &db, const string &temp_directory_p);
 	~TemporaryFileManager();
@@ -159,6 +176,8 @@ public:
 	void DecreaseSizeOnDisk(idx_t amount);
 
 private:
+	//! Try to compress a buffer, returns the slot size required to store the (possibly compressed) buffer
+	idx_t CompressBuffer(FileBuffer &buffer, AllocatedData &compressed_buffer);
 	void EraseUsedBlock(TemporaryManagerLock &lock, block_id_t id, TemporaryFileHandle *handle,
 	                    TemporaryFileIndex index);
 	TemporaryFileHandle *GetFileHandle(TemporaryManagerLock &, idx_t index);
@@ -20,6 +20,8 @@
 #include "duckdb/storage/block.hpp"
 #include "duckdb/storage/storage_info.hpp"
 
+#include <condition_variable>
+
 namespace duckdb {
 
 struct AlterInfo;
@@ -113,6 +115,18 @@ public:
 	//! Delete the WAL file on disk. The WAL should not be used after this point.
 	void Delete();
 	void Flush();
+	//! Writes the end of a committed transaction and hands the WAL to the file system without syncing it
+	//! Returns the sequence number of the commit - the commit is made durable by SyncCommit
+	idx_t FlushCommit();
+	//! Returns the sequence number of the last commit flushed to the WAL
+	idx_t GetLastFlushedCommit() {
+		return flushed_commits;
+	}
+	//! Waits until the commit with the given sequence number is durable (group commit)
+	//! Commits that are flushed while another commit syncs the WAL are made durable together by the next sync. The
+	//! commit that performs a sync first waits "commit_delay" microseconds for other commits to join.
+	//! Throws if the WAL could not be synced - including for commits that were waiting on a sync that failed.
+	void SyncCommit(idx_t commit, idx_t commit_delay);
 
 	void WriteCheckpoint(MetaBlockPointer meta_block);
 
@@ -123,6 +137,15 @@ protected:
 	string wal_path;
 	atomic<idx_t> wal_size;
 	atomic<bool> initialized;
+	//! The number of commits flushed to the file system, and the number of commits that are known to be durable
+	atomic<idx_t> flushed_commits;
+	idx_t synced_commits;
+	//! Lock and condition variable used to wait for an in-progress sync
+	mutex sync_lock;
+	std::condition_variable sync_cv;
+	bool sync_in_progress;
+	//! Whether a sync of the WAL has failed - commits that were not synced before can no longer be made durable
+	bool sync_failed;
 };
 
 } // namespace duckdb
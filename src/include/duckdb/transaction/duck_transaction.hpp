@@ -63,6 +63,8 @@ public:
 
 	bool ChangesMade();
 	UndoBufferProperties GetUndoProperties();
+	//! Returns the tables in which this transaction deleted or updated committed rows
+	reference_set_t<DataTableInfo> GetDeletedOrUpdatedTables();
 
 	void PushDelete(DataTable &table, RowVersionManager &info, idx_t vector_idx, row_t rows[], idx_t count,
 	                idx_t base_row);
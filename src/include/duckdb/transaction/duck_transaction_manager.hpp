@@ -11,6 +11,9 @@
 #include "duckdb/transaction/transaction_manager.hpp"
 #include "duckdb/storage/storage_lock.hpp"
 #include "duckdb/common/enums/checkpoint_type.hpp"
+#include "duckdb/common/set.hpp"
+
+#include <condition_variable>
 
 namespace duckdb {
 class DuckTransaction;
@@ -92,6 +95,10 @@ private:
 	atomic<transaction_t> lowest_active_start;
 	//! The last commit timestamp
 	atomic<transaction_t> last_commit;
+	//! The start times reserved for commits that are written to the WAL but not yet synced (see CommitTransaction)
+	multiset<transaction_t> unsynced_commits;
+	//! Signalled when a start time is removed from the unsynced commits
+	std::condition_variable unsynced_commits_cv;
 	//! Set of currently running transactions
 	vector<unique_ptr<DuckTransaction>> active_transactions;
 	//! Set of recently committed transactions
@@ -10,10 +10,12 @@
 
 #include "duckdb/common/common.hpp"
 #include "duckdb/common/enums/undo_flags.hpp"
+#include "duckdb/common/reference_map.hpp"
 #include "duckdb/storage/arena_allocator.hpp"
 
 namespace duckdb {
 class StorageCommitState;
+struct DataTableInfo;
 class WriteAheadLog;
 
 struct UndoBufferProperties {
@@ -44,6 +46,8 @@ public:
 
 	bool ChangesMade();
 	UndoBufferProperties GetProperties();
+	//! Returns the tables in which rows were deleted or updated
+	reference_set_t<DataTableInfo> GetDeletedOrUpdatedTables();
 
 	//! Cleanup the undo buffer
 	void Cleanup(transaction_t lowest_active_transaction);
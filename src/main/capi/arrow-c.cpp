@@ -87,8 +87,9 @@ duckdb_state duckdb_query_arrow_array(duckdb_arrow result, duckdb_arrow_array *o
 	if (!wrapper->current_chunk || wrapper->current_chunk->size() == 0) {
 		return DuckDBSuccess;
 	}
+	// the fetched chunk is replaced (not modified) by the next fetch, so the array can reference its memory
 	ArrowConverter::ToArrowArray(*wrapper->current_chunk, reinterpret_cast<ArrowArray *>(*out_array),
-	                             wrapper->result->client_properties);
+	                             wrapper->result->client_properties, true);
 	return DuckDBSuccess;
 }
 
@@ -20,9 +20,11 @@
 #include "duckdb/main/database_manager.hpp"
 #include "duckdb/main/error_manager.hpp"
 #include "duckdb/main/materialized_query_result.hpp"
+#include "duckdb/main/materialized_view.hpp"
 #include "duckdb/main/query_profiler.hpp"
 #include "duckdb/main/query_result.hpp"
 #include "duckdb/main/relation.hpp"
+#include "duckdb/main/result_cache.hpp"
 #include "duckdb/main/stream_query_result.hpp"
 #include "duckdb/optimizer/optimizer.hpp"
 #include "duckdb/parser/expression/constant_expression.hpp"
@@ -36,6 +38,7 @@
 #include "duckdb/parser/statement/prepare_statement.hpp"
 #include "duckdb/parser/statement/relation_statement.hpp"
 #include "duckdb/parser/statement/select_statement.hpp"
+#include "duckdb/parser/statement/transaction_statement.hpp"
 #include "duckdb/planner/operator/logical_execute.hpp"
 #include "duckdb/planner/planner.hpp"
 #include "duckdb/planner/pragma_handler.hpp"
@@ -219,6 +222,7 @@ ErrorData ClientContext::EndQueryInternal(ClientContextLock &lock, bool success,
 			transaction.ResetActiveQuery();
 			if (transaction.IsAutoCommit()) {
 				if (success) {
+					MaintainMaterializedViews(lock);
 					transaction.Commit();
 				} else {
 					transaction.Rollback(previous_error);
@@ -250,6 +254,43 @@ ErrorData ClientContext::EndQueryInternal(ClientContextLock &lock, bool success,
 	return error;
 }
 
+void ClientContext::MaintainMaterializedViews(ClientContextLock &lock) {
+	auto &client_data = ClientData::Get(*this);
+	if (client_data.maintaining_materialized_views) {
+		return;
+	}
+	// the views are maintained as part of the transaction that is being committed
+	auto auto_commit = transaction.IsAutoCommit();
+	try {
+		auto statements = MaterializedView::GetMaintenanceStatements(*this);
+		if (statements.empty()) {
+			return;
+		}
+		transaction.SetAutoCommit(false);
+		client_data.maintaining_materialized_views = true;
+		for (auto &query : statements) {
+			Parser parser(GetParserOptions());
+			parser.ParseQuery(query);
+			for (auto &statement : parser.statements) {
+				auto result = RunStatementInternal(lock, query, std::move(statement), false, false);
+				if (result->HasError()) {
+					result->ThrowError();
+				}
+			}
+		}
+	} catch (std::exception &ex) {
+		// the transaction cannot be committed without its materialized views - roll it back
+		client_data.maintaining_materialized_views = false;
+		ErrorData error(ex);
+		if (transaction.HasActiveTransaction()) {
+			transaction.Rollback(error);
+		}
+		throw;
+	}
+	client_data.maintaining_materialized_views = false;
+	transaction.SetAutoCommit(auto_commit);
+}
+
 void ClientContext::CleanupInternal(ClientContextLock &lock, BaseQueryResult *result, bool invalidate_transaction) {
 	if (!active_query) {
 		// no query currently active
@@ -298,6 +339,10 @@ unique_ptr<QueryResult> ClientContext::FetchResultInternal(ClientContextLock &lo
 	D_ASSERT(executor.HasResultCollector());
 	// we have a result collector - fetch the result directly from the result collector
 	result = executor.GetResult();
+	if (!prepared.result_cache_key.empty() && result->type == QueryResultType::MATERIALIZED_RESULT &&
+	    !result->HasError()) {
+		ResultCache::Get(*this).Store(prepared, result->Cast<MaterializedQueryResult>().Collection());
+	}
 	if (!create_stream_result) {
 		CleanupInternal(lock, result.get(), false);
 	} else {
@@ -320,9 +365,17 @@ static bool IsExplainAnalyze(SQLStatement *statement) {
 shared_ptr<PreparedStatementData>
 ClientContext::CreatePreparedStatementInternal(ClientContextLock &lock, const string &query,
                                                unique_ptr<SQLStatement> statement,
-                                               optional_ptr<case_insensitive_map_t<BoundParameterData>> values) {
+                                               optional_ptr<case_insensitive_map_t<BoundParameterData>> values,
+                                               PreparedStatementMode mode) {
 	StatementType statement_type = statement->type;
 	auto result = make_shared_ptr<PreparedStatementData>(statement_type);
+	// only statements that are executed right away can use the result cache
+	auto use_result_cache = mode == PreparedStatementMode::PREPARE_AND_EXECUTE &&
+	                        statement_type == StatementType::SELECT_STATEMENT && ResultCache::CanCache(*this);
+	string result_cache_query;
+	if (use_result_cache) {
+		result_cache_query = statement->ToString();
+	}
 
 	auto &profiler = QueryProfiler::Get(*this);
 	profiler.StartQuery(query, IsExplainAnalyze(statement.get()), true);
@@ -351,6 +404,18 @@ ClientContext::CreatePreparedStatementInternal(ClientContextLock &lock, const st
 #ifdef DEBUG
 	plan->Verify(*this);
 #endif
+	if (use_result_cache && result->properties.parameter_count == 0) {
+		// this is done before optimizing - the optimizer folds functions that are only constant within the query
+		result->result_cache_dependencies = ResultCache::GetDependencies(*this, *plan);
+	}
+	if (result->result_cache_dependencies) {
+		// the key contains the tables the statement was bound to
+		result->result_cache_key = ResultCache::GetKey(*this, result_cache_query, *result->result_cache_dependencies);
+		auto cached = ResultCache::Get(*this).Lookup(*this, result->result_cache_key);
+		if (cached) {
+			return cached;
+		}
+	}
 	if (config.enable_optimizer && plan->RequireOptimizer()) {
 		profiler.StartPhase(MetricsType::ALL_OPTIMIZERS);
 		Optimizer optimizer(*planner.binder, *this);
@@ -392,7 +457,7 @@ ClientContext::CreatePreparedStatement(ClientContextLock &lock, const string &qu
 		// if any registered state can request a rebind we do the binding on a copy first
 		shared_ptr<PreparedStatementData> result;
 		try {
-			result = CreatePreparedStatementInternal(lock, query, statement->Copy(), values);
+			result = CreatePreparedStatementInternal(lock, query, statement->Copy(), values, mode);
 		} catch (std::exception &ex) {
 			ErrorData error(ex);
 			// check if any registered client context state wants to try a rebind
@@ -421,7 +486,7 @@ ClientContext::CreatePreparedStatement(ClientContextLock &lock, const string &qu
 		// an extension wants to do a rebind - do it once
 	}
 
-	return CreatePreparedStatementInternal(lock, query, std::move(statement), values);
+	return CreatePreparedStatementInternal(lock, query, std::move(statement), values, mode);
 }
 
 QueryProgress ClientContext::GetQueryProgress() {
@@ -832,6 +897,19 @@ unique_ptr<PendingQueryResult> ClientContext::PendingStatementOrPreparedStatemen
     shared_ptr<PreparedStatementData> &prepared, const PendingQueryParameters &parameters) {
 	unique_ptr<PendingQueryResult> pending;
 
+	auto unbound_statement = statement ? statement.get() : prepared->unbound_statement.get();
+	if (unbound_statement && unbound_statement->type == StatementType::TRANSACTION_STATEMENT &&
+	    unbound_statement->Cast<TransactionStatement>().info->type == TransactionType::COMMIT &&
+	    transaction.HasActiveTransaction() && !transaction.IsAutoCommit() &&
+	    !ValidChecker::IsInvalidated(ActiveTransaction())) {
+		// an explicit COMMIT - the materialized views are maintained before the statement commits the transaction
+		try {
+			MaintainMaterializedViews(lock);
+		} catch (std::exception &ex) {
+			return ErrorResult<PendingQueryResult>(ErrorData(ex), query);
+		}
+	}
+
 	try {
 		BeginQueryInternal(lock, query);
 	} catch (std::exception &ex) {
@@ -15,6 +15,7 @@
 #include "duckdb/main/db_instance_cache.hpp"
 #include "duckdb/main/error_manager.hpp"
 #include "duckdb/main/extension_helper.hpp"
+#include "duckdb/main/result_cache.hpp"
 #include "duckdb/main/secret/secret_manager.hpp"
 #include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/parser/parsed_data/attach_info.hpp"
@@ -63,6 +64,7 @@ DatabaseInstance::~DatabaseInstance() {
 	GetDatabaseManager().ResetDatabases(scheduler);
 	// destroy child elements
 	connection_manager.reset();
+	result_cache.reset();
 	object_cache.reset();
 	scheduler.reset();
 	db_manager.reset();
@@ -281,6 +283,7 @@ void DatabaseInstance::Initialize(const char *database_path, DBConfig *user_conf
 	}
 	scheduler = make_uniq<TaskScheduler>(*this);
 	object_cache = make_uniq<ObjectCache>();
+	result_cache = make_uniq<ResultCache>(*this);
 	connection_manager = make_uniq<ConnectionManager>();
 
 	// initialize the secret manager
@@ -360,6 +363,10 @@ ObjectCache &DatabaseInstance::GetObjectCache() {
 	return *object_cache;
 }
 
+ResultCache &DatabaseInstance::GetResultCache() {
+	return *result_cache;
+}
+
 FileSystem &DatabaseInstance::GetFileSystem() {
 	return *db_file_system;
 }
@@ -438,6 +445,7 @@ void DatabaseInstance::Configure(DBConfig &new_config, const char *database_path
 		config.buffer_pool = make_shared_ptr<BufferPool>(config.options.maximum_memory,
 		                                                 config.options.buffer_manager_track_eviction_timestamps,
 		                                                 config.options.allocator_bulk_deallocation_flush_threshold);
+		config.buffer_pool->SetEvictionPolicy(config.options.buffer_eviction_policy);
 	}
 }
 
@@ -0,0 +1,349 @@
+#include "duckdb/main/materialized_view.hpp"
+
+#include "duckdb/catalog/catalog_entry/schema_catalog_entry.hpp"
+#include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
+#include "duckdb/catalog/duck_catalog.hpp"
+#include "duckdb/common/case_insensitive_map.hpp"
+#include "duckdb/common/string_util.hpp"
+#include "duckdb/main/attached_database.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/parser/expression/columnref_expression.hpp"
+#include "duckdb/parser/expression/constant_expression.hpp"
+#include "duckdb/parser/expression/function_expression.hpp"
+#include "duckdb/parser/expression/subquery_expression.hpp"
+#include "duckdb/parser/keyword_helper.hpp"
+#include "duckdb/parser/parsed_data/parse_info.hpp"
+#include "duckdb/parser/parsed_expression_iterator.hpp"
+#include "duckdb/parser/query_node/select_node.hpp"
+#include "duckdb/parser/tableref/basetableref.hpp"
+#include "duckdb/parser/tableref/joinref.hpp"
+#include "duckdb/parser/tableref/table_function_ref.hpp"
+#include "duckdb/storage/data_table.hpp"
+#include "duckdb/transaction/duck_transaction.hpp"
+#include "duckdb/transaction/local_storage.hpp"
+#include "duckdb/transaction/meta_transaction.hpp"
+
+namespace duckdb {
+
+//! How a column of a materialized view is combined with the result of the query over the appended rows
+enum class MaterializedViewColumnType : uint8_t { GROUP, SUM, COUNT, MIN, MAX };
+
+//! The changes of the current transaction to a table that a materialized view reads from
+struct MaterializedViewTableChanges {
+	idx_t references = 0;
+	bool appended = false;
+	bool deleted_or_updated = false;
+};
+
+static void GatherTableRefs(QueryNode &node, vector<reference<BaseTableRef>> &result);
+
+static void GatherTableRefs(ParsedExpression &expr, vector<reference<BaseTableRef>> &result) {
+	if (expr.GetExpressionClass() == ExpressionClass::SUBQUERY) {
+		GatherTableRefs(*expr.Cast<SubqueryExpression>().subquery->node, result);
+	}
+	ParsedExpressionIterator::EnumerateChildren(expr,
+	                                            [&](ParsedExpression &child) { GatherTableRefs(child, result); });
+}
+
+static void GatherTableRefs(QueryNode &node, vector<reference<BaseTableRef>> &result) {
+	ParsedExpressionIterator::EnumerateQueryNodeChildren(
+	    node, [&](unique_ptr<ParsedExpression> &child) { GatherTableRefs(*child, result); },
+	    [&](TableRef &ref) {
+		    if (ref.type == TableReferenceType::BASE_TABLE) {
+			    result.push_back(ref.Cast<BaseTableRef>());
+		    }
+	    });
+}
+
+vector<reference<BaseTableRef>> MaterializedView::GetTableRefs(QueryNode &node) {
+	vector<reference<BaseTableRef>> result;
+	GatherTableRefs(node, result);
+	return result;
+}
+
+static bool IsTableRef(const BaseTableRef &ref, TableCatalogEntry &table) {
+	return StringUtil::CIEquals(ref.catalog_name, table.ParentCatalog().GetName()) &&
+	       StringUtil::CIEquals(ref.schema_name, table.ParentSchema().name) &&
+	       StringUtil::CIEquals(ref.table_name, table.name);
+}
+
+static bool HasQualifiedColumnRef(ParsedExpression &expr) {
+	if (expr.GetExpressionClass() == ExpressionClass::COLUMN_REF &&
+	    expr.Cast<ColumnRefExpression>().column_names.size() > 2) {
+		// references that include the schema cannot be resolved once the table is replaced
+		return true;
+	}
+	bool result = false;
+	ParsedExpressionIterator::EnumerateChildren(expr, [&](ParsedExpression &child) {
+		if (HasQualifiedColumnRef(child)) {
+			result = true;
+		}
+	});
+	return result;
+}
+
+//! Whether or not the query over the appended rows of one table yields all rows that are added to the join
+static bool IsIncrementalJoinTree(TableRef &ref) {
+	switch (ref.type) {
+	case TableReferenceType::BASE_TABLE:
+		return true;
+	case TableReferenceType::JOIN: {
+		auto &join = ref.Cast<JoinRef>();
+		if (join.type != JoinType::INNER) {
+			return false;
+		}
+		switch (join.ref_type) {
+		case JoinRefType::REGULAR:
+		case JoinRefType::NATURAL:
+		case JoinRefType::CROSS:
+			break;
+		default:
+			return false;
+		}
+		if (join.condition && (join.condition->HasSubquery() || HasQualifiedColumnRef(*join.condition))) {
+			return false;
+		}
+		return IsIncrementalJoinTree(*join.left) && IsIncrementalJoinTree(*join.right);
+	}
+	default:
+		return false;
+	}
+}
+
+//! Returns how each column of the view is maintained incrementally, or false if the query cannot be maintained
+//! incrementally - e.g. because it contains holistic aggregates
+static bool GetIncrementalColumnTypes(SelectNode &node, vector<MaterializedViewColumnType> &result) {
+	if (!node.modifiers.empty() || node.having || node.qualify || node.sample || !node.cte_map.map.empty() ||
+	    node.aggregate_handling != AggregateHandling::STANDARD_HANDLING || node.groups.grouping_sets.size() > 1) {
+		return false;
+	}
+	if (!node.from_table || !IsIncrementalJoinTree(*node.from_table)) {
+		return false;
+	}
+	if (node.where_clause && (node.where_clause->HasSubquery() || HasQualifiedColumnRef(*node.where_clause))) {
+		return false;
+	}
+	// every group has to be stored in the view, so that the stored groups can be matched with the new groups
+	vector<bool> is_group(node.select_list.size(), false);
+	for (auto &group : node.groups.group_expressions) {
+		optional_idx index;
+		if (group->GetExpressionClass() == ExpressionClass::CONSTANT) {
+			// GROUP BY 1
+			auto &value = group->Cast<ConstantExpression>().value;
+			if (value.type().IsIntegral() && !value.IsNull()) {
+				auto position = value.GetValue<int64_t>();
+				if (position >= 1 && position <= NumericCast<int64_t>(node.select_list.size())) {
+					index = NumericCast<idx_t>(position - 1);
+				}
+			}
+		}
+		for (idx_t i = 0; i < node.select_list.size() && !index.IsValid(); i++) {
+			auto &expr = *node.select_list[i];
+			if (expr.Equals(*group)) {
+				index = i;
+			} else if (group->GetExpressionClass() == ExpressionClass::COLUMN_REF) {
+				// GROUP BY alias
+				auto &colref = group->Cast<ColumnRefExpression>();
+				if (!colref.IsQualified() && StringUtil::CIEquals(expr.alias, colref.GetColumnName())) {
+					index = i;
+				}
+			}
+		}
+		if (!index.IsValid()) {
+			return false;
+		}
+		is_group[index.GetIndex()] = true;
+	}
+	for (idx_t i = 0; i < node.select_list.size(); i++) {
+		auto &expr = *node.select_list[i];
+		if (expr.HasSubquery() || HasQualifiedColumnRef(expr)) {
+			return false;
+		}
+		if (is_group[i]) {
+			result.push_back(MaterializedViewColumnType::GROUP);
+			continue;
+		}
+		// only plain distributive aggregates can be combined
+		if (expr.GetExpressionClass() != ExpressionClass::FUNCTION) {
+			return false;
+		}
+		auto &function = expr.Cast<FunctionExpression>();
+		if (function.distinct || function.export_state || !function.catalog.empty() || !function.schema.empty() ||
+		    (function.order_bys && !function.order_bys->orders.empty())) {
+			return false;
+		}
+		if (function.function_name == "count_star" && function.children.empty()) {
+			result.push_back(MaterializedViewColumnType::COUNT);
+			continue;
+		}
+		if (function.children.size() != 1) {
+			return false;
+		}
+		if (function.function_name == "sum") {
+			result.push_back(MaterializedViewColumnType::SUM);
+		} else if (function.function_name == "count") {
+			result.push_back(MaterializedViewColumnType::COUNT);
+		} else if (function.function_name == "min") {
+			result.push_back(MaterializedViewColumnType::MIN);
+		} else if (function.function_name == "max") {
+			result.push_back(MaterializedViewColumnType::MAX);
+		} else {
+			return false;
+		}
+	}
+	return true;
+}
+
+static void ReplaceWithLocalAppends(unique_ptr<TableRef> &ref, TableCatalogEntry &table) {
+	if (ref->type == TableReferenceType::JOIN) {
+		auto &join = ref->Cast<JoinRef>();
+		ReplaceWithLocalAppends(join.left, table);
+		ReplaceWithLocalAppends(join.right, table);
+		return;
+	}
+	if (ref->type != TableReferenceType::BASE_TABLE || !IsTableRef(ref->Cast<BaseTableRef>(), table)) {
+		return;
+	}
+	auto &table_ref = ref->Cast<BaseTableRef>();
+	auto qualified_name = ParseInfo::QualifierToString(table.ParentCatalog().GetName(), table.ParentSchema().name,
+	                                                   table.name);
+	vector<unique_ptr<ParsedExpression>> children;
+	children.push_back(make_uniq<ConstantExpression>(Value(qualified_name)));
+	auto function_ref = make_uniq<TableFunctionRef>();
+	function_ref->function = make_uniq<FunctionExpression>("duckdb_local_appends", std::move(children));
+	function_ref->alias = table_ref.alias.empty() ? table_ref.table_name : table_ref.alias;
+	function_ref->column_name_alias = table_ref.column_name_alias;
+	ref = std::move(function_ref);
+}
+
+static string CombineColumn(MaterializedViewColumnType type, const string &view, const string &delta) {
+	switch (type) {
+	case MaterializedViewColumnType::SUM:
+		return StringUtil::Format("COALESCE(%s + %s, %s, %s)", view, delta, view, delta);
+	case MaterializedViewColumnType::COUNT:
+		return StringUtil::Format("%s + %s", view, delta);
+	case MaterializedViewColumnType::MIN:
+		return StringUtil::Format("COALESCE(LEAST(%s, %s), %s, %s)", view, delta, view, delta);
+	case MaterializedViewColumnType::MAX:
+		return StringUtil::Format("COALESCE(GREATEST(%s, %s), %s, %s)", view, delta, view, delta);
+	default:
+		throw InternalException("Unsupported column type for CombineColumn");
+	}
+}
+
+//! Merges the groups of the query over the appended rows into the stored groups, and inserts the new groups
+static void AddIncrementalStatements(TableCatalogEntry &view, const string &view_name, SelectNode &node,
+                                     TableCatalogEntry &appended_table,
+                                     const vector<MaterializedViewColumnType> &column_types, vector<string> &result) {
+	auto delta_node = node.Copy();
+	ReplaceWithLocalAppends(delta_node->Cast<SelectNode>().from_table, appended_table);
+
+	vector<string> column_names;
+	for (auto &column : view.GetColumns().Logical()) {
+		column_names.push_back(KeywordHelper::WriteOptionallyQuoted(column.Name()));
+	}
+	auto delta = "(" + delta_node->ToString() + ") AS __delta(" + StringUtil::Join(column_names, ", ") + ")";
+
+	vector<string> conditions;
+	vector<string> updates;
+	for (idx_t i = 0; i < column_types.size(); i++) {
+		auto view_column = "__view." + column_names[i];
+		auto delta_column = "__delta." + column_names[i];
+		if (column_types[i] == MaterializedViewColumnType::GROUP) {
+			conditions.push_back(view_column + " IS NOT DISTINCT FROM " + delta_column);
+		} else {
+			updates.push_back(column_names[i] + " = " + CombineColumn(column_types[i], view_column, delta_column));
+		}
+	}
+	auto condition = conditions.empty() ? string("true") : StringUtil::Join(conditions, " AND ");
+	if (!updates.empty()) {
+		result.push_back("UPDATE " + view_name + " AS __view SET " + StringUtil::Join(updates, ", ") + " FROM " +
+		                 delta + " WHERE " + condition);
+	}
+	result.push_back("INSERT INTO " + view_name + " SELECT * FROM " + delta + " WHERE NOT EXISTS (SELECT 1 FROM " +
+	                 view_name + " AS __view WHERE " + condition + ")");
+}
+
+vector<string> MaterializedView::GetMaintenanceStatements(ClientContext &context) {
+	vector<string> result;
+	auto db = MetaTransaction::Get(context).ModifiedDatabase();
+	if (!db) {
+		return result;
+	}
+	auto &catalog = db->GetCatalog();
+	if (!catalog.IsDuckCatalog() || !catalog.Cast<DuckCatalog>().HasMaterializedViews()) {
+		return result;
+	}
+	auto &transaction = DuckTransaction::Get(context, *db);
+	auto &local_storage = LocalStorage::Get(transaction);
+	auto deleted_or_updated = transaction.GetDeletedOrUpdatedTables();
+
+	vector<reference<TableCatalogEntry>> views;
+	// the schemas are gathered first: scanning a schema can create its default views, which binds their queries and
+	// looks up schemas, so the schemas cannot be scanned while the schema set is locked
+	auto schemas = catalog.GetSchemas(context);
+	for (auto &schema : schemas) {
+		schema.get().Scan(context, CatalogType::TABLE_ENTRY, [&](CatalogEntry &entry) {
+			if (entry.type == CatalogType::TABLE_ENTRY && entry.Cast<TableCatalogEntry>().IsMaterializedView()) {
+				views.push_back(entry.Cast<TableCatalogEntry>());
+			}
+		});
+	}
+	for (auto &view_entry : views) {
+		auto &view = view_entry.get();
+		auto &query = view.GetViewQuery();
+
+		// find the changes made to the tables the view reads from
+		auto table_refs = GetTableRefs(*query.node);
+		reference_map_t<TableCatalogEntry, MaterializedViewTableChanges> changes;
+		for (auto &table_ref : table_refs) {
+			auto &ref = table_ref.get();
+			auto &table = Catalog::GetEntry<TableCatalogEntry>(context, ref.catalog_name, ref.schema_name,
+			                                                   ref.table_name);
+			auto &storage = table.GetStorage();
+			auto &table_changes = changes[table];
+			table_changes.references++;
+			table_changes.appended = local_storage.AddedRows(storage) > 0;
+			table_changes.deleted_or_updated = deleted_or_updated.find(*storage.GetDataTableInfo()) !=
+			                                   deleted_or_updated.end();
+		}
+		optional_ptr<TableCatalogEntry> appended_table;
+		idx_t changed_tables = 0;
+		// a view created by this transaction might already include the appended rows
+		bool incremental = view.timestamp < TRANSACTION_ID_START;
+		for (auto &entry : changes) {
+			auto &table_changes = entry.second;
+			if (!table_changes.appended && !table_changes.deleted_or_updated) {
+				continue;
+			}
+			changed_tables++;
+			appended_table = &entry.first.get();
+			if (table_changes.deleted_or_updated || table_changes.references > 1) {
+				incremental = false;
+			}
+		}
+		if (changed_tables == 0) {
+			continue;
+		}
+		auto view_name = ParseInfo::QualifierToString(view.ParentCatalog().GetName(), view.ParentSchema().name,
+		                                              view.name);
+		if (incremental && changed_tables == 1 && query.node->type == QueryNodeType::SELECT_NODE) {
+			auto &node = query.node->Cast<SelectNode>();
+			vector<MaterializedViewColumnType> column_types;
+			case_insensitive_set_t column_names;
+			for (auto &column : view.GetColumns().Logical()) {
+				column_names.insert(column.Name());
+			}
+			if (column_names.size() == node.select_list.size() && GetIncrementalColumnTypes(node, column_types)) {
+				AddIncrementalStatements(view, view_name, node, *appended_table, column_types, result);
+				continue;
+			}
+		}
+		// the view cannot be maintained incrementally - recompute it
+		result.push_back("DELETE FROM " + view_name);
+		result.push_back("INSERT INTO " + view_name + " " + query.ToString());
+	}
+	return result;
+}
+
+} // namespace duckdb
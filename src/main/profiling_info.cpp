@@ -18,7 +18,7 @@ profiler_settings_t ProfilingInfo::DefaultSettings() {
 
 profiler_settings_t ProfilingInfo::DefaultOperatorSettings() {
 	return {MetricsType::OPERATOR_CARDINALITY, MetricsType::OPERATOR_ROWS_SCANNED, MetricsType::OPERATOR_TIMING,
-	        MetricsType::RESULT_SET_SIZE};
+	        MetricsType::RESULT_SET_SIZE, MetricsType::EXTRA_INFO};
 }
 
 profiler_settings_t ProfilingInfo::AllSettings() {
@@ -360,6 +360,20 @@ void OperatorProfiler::EndOperator(optional_ptr<DataChunk> chunk) {
 	active_operator = nullptr;
 }
 
+void OperatorProfiler::FinishSource(GlobalSourceState &gstate, LocalSourceState &lstate) {
+	if (!enabled || !HasOperatorSetting(MetricsType::EXTRA_INFO)) {
+		return;
+	}
+	if (!active_operator) {
+		throw InternalException("OperatorProfiler: Attempting to call FinishSource without an active operator");
+	}
+	auto &info = GetOperatorInfo(*active_operator);
+	auto params = active_operator->ExtraSourceParams(gstate, lstate);
+	for (auto &entry : params) {
+		info.extra_info[entry.first] = entry.second;
+	}
+}
+
 OperatorInformation &OperatorProfiler::GetOperatorInfo(const PhysicalOperator &phys_op) {
 	auto entry = timings.find(phys_op);
 	if (entry != timings.end()) {
@@ -414,6 +428,12 @@ void QueryProfiler::Flush(OperatorProfiler &profiler) {
 		if (profiler.HasOperatorSetting(MetricsType::RESULT_SET_SIZE)) {
 			tree_node.GetProfilingInfo().AddToMetric<idx_t>(MetricsType::RESULT_SET_SIZE, node.second.result_set_size);
 		}
+		if (profiler.HasOperatorSetting(MetricsType::EXTRA_INFO)) {
+			auto &extra_info = tree_node.GetProfilingInfo().extra_info;
+			for (auto &entry : node.second.extra_info) {
+				extra_info[entry.first] = entry.second;
+			}
+		}
 	}
 	profiler.timings.clear();
 }
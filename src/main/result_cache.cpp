@@ -0,0 +1,264 @@
+#include "duckdb/main/result_cache.hpp"
+
+#include "duckdb/catalog/catalog.hpp"
+#include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
+#include "duckdb/common/types/column/column_data_collection.hpp"
+#include "duckdb/execution/operator/scan/physical_column_data_scan.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/main/config.hpp"
+#include "duckdb/main/database.hpp"
+#include "duckdb/main/prepared_statement_data.hpp"
+#include "duckdb/planner/logical_operator_visitor.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+#include "duckdb/storage/data_table.hpp"
+#include "duckdb/transaction/duck_transaction.hpp"
+#include "duckdb/transaction/meta_transaction.hpp"
+
+namespace duckdb {
+
+ResultCache::ResultCache(DatabaseInstance &db)
+    : db(db), memory_usage(0), memory_limit(DBConfig::GetConfig(db).options.result_cache_memory_limit), hits(0),
+      misses(0), evictions(0), invalidations(0) {
+}
+
+ResultCache::~ResultCache() {
+}
+
+ResultCache &ResultCache::Get(DatabaseInstance &db) {
+	return db.GetResultCache();
+}
+
+ResultCache &ResultCache::Get(ClientContext &context) {
+	return ResultCache::Get(DatabaseInstance::GetDatabase(context));
+}
+
+bool ResultCache::CanCache(ClientContext &context) {
+	if (!DBConfig::GetConfig(context).options.enable_result_cache) {
+		return false;
+	}
+	// transaction-local changes are not visible to other transactions
+	return !MetaTransaction::Get(context).ModifiedDatabase();
+}
+
+//! Settings that change the result of a query without changing its text
+static constexpr const char *RESULT_CACHE_KEY_SETTINGS[] = {"TimeZone", "Calendar", "default_order",
+                                                            "default_null_order", "default_collation"};
+
+string ResultCache::GetKey(ClientContext &context, const string &query,
+                           const vector<ResultCacheDependency> &dependencies) {
+	string result = query;
+	// the tables the query was bound to
+	for (auto &dependency : dependencies) {
+		result += "\n" + to_string(dependency.catalog_oid) + "." + to_string(dependency.table_oid);
+	}
+	for (auto &setting : RESULT_CACHE_KEY_SETTINGS) {
+		Value value;
+		if (context.TryGetCurrentSetting(setting, value)) {
+			result += "\n" + string(setting) + "=" + value.ToString();
+		}
+	}
+	return result;
+}
+
+static bool GetDependenciesRecursive(ClientContext &context, LogicalOperator &op,
+                                     vector<ResultCacheDependency> &dependencies) {
+	bool cacheable = true;
+	LogicalOperatorVisitor::EnumerateExpressions(op, [&](unique_ptr<Expression> *child) {
+		if ((*child)->IsVolatile() || !(*child)->IsConsistent()) {
+			cacheable = false;
+		}
+	});
+	if (!cacheable) {
+		return false;
+	}
+	if (op.type == LogicalOperatorType::LOGICAL_GET) {
+		// only scans of DuckDB tables are tracked - the result of other table functions can change at any time
+		auto table = op.Cast<LogicalGet>().GetTable();
+		if (!table || !table->IsDuckTable()) {
+			return false;
+		}
+		auto &catalog = table->ParentCatalog();
+		if (catalog.IsTemporaryCatalog()) {
+			// every connection has its own temporary tables - but they all share the same catalog name
+			return false;
+		}
+		auto info = table->GetStorage().GetDataTableInfo();
+		// obtain the transaction before reading the commit id, so that no commit can sneak in between
+		auto &transaction = DuckTransaction::Get(context, info->GetDB());
+		auto commit_id = info->GetLastCommitId();
+		if (commit_id >= transaction.start_time) {
+			// the table was changed after the transaction started - the result is not the latest version
+			return false;
+		}
+		dependencies.push_back(ResultCacheDependency {info, commit_id, catalog.GetOid(), table->oid});
+	}
+	for (auto &child : op.children) {
+		if (!GetDependenciesRecursive(context, *child, dependencies)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+unique_ptr<vector<ResultCacheDependency>> ResultCache::GetDependencies(ClientContext &context,
+                                                                       LogicalOperator &plan) {
+	auto result = make_uniq<vector<ResultCacheDependency>>();
+	if (!GetDependenciesRecursive(context, plan, *result)) {
+		return nullptr;
+	}
+	return result;
+}
+
+bool ResultCache::IsValid(const ResultCacheEntry &entry) {
+	for (auto &dependency : entry.dependencies) {
+		auto table = dependency.table.lock();
+		if (!table || table->GetLastCommitId() != dependency.commit_id) {
+			return false;
+		}
+	}
+	return true;
+}
+
+shared_ptr<PreparedStatementData> ResultCache::Lookup(ClientContext &context, const string &key) {
+	ResultCacheEntry entry;
+	{
+		lock_guard<mutex> guard(lock);
+		auto entry_it = entry_map.find(key);
+		if (entry_it == entry_map.end()) {
+			misses++;
+			return nullptr;
+		}
+		// move the entry to the front of the list
+		entries.splice(entries.begin(), entries, entry_it->second);
+		entry = *entry_it->second;
+	}
+	// the current transaction has to see the version of the tables the result was computed from
+	// we obtain the transactions first - so that all commits before their start time are reflected in the commit ids
+	for (auto &dependency : entry.dependencies) {
+		auto table = dependency.table.lock();
+		if (!table) {
+			break;
+		}
+		auto &transaction = DuckTransaction::Get(context, table->GetDB());
+		if (dependency.commit_id >= transaction.start_time) {
+			misses++;
+			return nullptr;
+		}
+	}
+	if (!IsValid(entry)) {
+		lock_guard<mutex> guard(lock);
+		auto entry_it = entry_map.find(key);
+		if (entry_it != entry_map.end() && !IsValid(*entry_it->second)) {
+			invalidations++;
+			RemoveEntry(entry_it->second);
+		}
+		misses++;
+		return nullptr;
+	}
+	hits++;
+
+	auto result = make_shared_ptr<PreparedStatementData>(StatementType::SELECT_STATEMENT);
+	result->names = std::move(entry.names);
+	result->types = entry.types;
+	result->properties = std::move(entry.properties);
+	result->plan = make_uniq<PhysicalColumnDataScan>(std::move(entry.types), PhysicalOperatorType::COLUMN_DATA_SCAN,
+	                                                 entry.collection->Count(), *entry.collection);
+	// the prepared statement keeps the collection alive, even if the entry is evicted while the result is scanned
+	result->cached_result = std::move(entry.collection);
+	return result;
+}
+
+void ResultCache::Store(const PreparedStatementData &prepared, ColumnDataCollection &result) {
+	D_ASSERT(prepared.result_cache_dependencies);
+	if (result.AllocationSize() > memory_limit) {
+		// the result is too large to cache
+		return;
+	}
+	ResultCacheEntry entry;
+	entry.key = prepared.result_cache_key;
+	entry.names = prepared.names;
+	entry.types = prepared.types;
+	entry.properties = prepared.properties;
+	entry.dependencies = *prepared.result_cache_dependencies;
+	if (!IsValid(entry)) {
+		// one of the tables was changed while the query was running
+		return;
+	}
+	// copy the result into a collection that is managed by the buffer manager
+	auto &buffer_manager = BufferManager::GetBufferManager(db);
+	entry.collection = make_shared_ptr<ColumnDataCollection>(buffer_manager, result.Types());
+	ColumnDataAppendState append_state;
+	entry.collection->InitializeAppend(append_state);
+	for (auto &chunk : result.Chunks()) {
+		entry.collection->Append(append_state, chunk);
+	}
+	entry.size = entry.collection->AllocationSize();
+
+	lock_guard<mutex> guard(lock);
+	if (entry.size > memory_limit) {
+		return;
+	}
+	auto entry_it = entry_map.find(entry.key);
+	if (entry_it != entry_map.end()) {
+		RemoveEntry(entry_it->second);
+	}
+	EvictEntries(memory_limit - entry.size);
+	memory_usage += entry.size;
+	entries.push_front(std::move(entry));
+	entry_map[entries.front().key] = entries.begin();
+}
+
+void ResultCache::RemoveEntry(list<ResultCacheEntry>::iterator entry) {
+	memory_usage -= entry->size;
+	entry_map.erase(entry->key);
+	entries.erase(entry);
+}
+
+void ResultCache::EvictEntries(idx_t limit) {
+	while (memory_usage > limit && !entries.empty()) {
+		evictions++;
+		RemoveEntry(std::prev(entries.end()));
+	}
+}
+
+void ResultCache::Invalidate() {
+	lock_guard<mutex> guard(lock);
+	for (auto entry = entries.begin(); entry != entries.end();) {
+		auto next = std::next(entry);
+		if (!IsValid(*entry)) {
+			invalidations++;
+			RemoveEntry(entry);
+		}
+		entry = next;
+	}
+}
+
+void ResultCache::Clear() {
+	lock_guard<mutex> guard(lock);
+	invalidations += entries.size();
+	entries.clear();
+	entry_map.clear();
+	memory_usage = 0;
+}
+
+void ResultCache::SetMemoryLimit(idx_t limit) {
+	lock_guard<mutex> guard(lock);
+	memory_limit = limit;
+	EvictEntries(memory_limit);
+}
+
+ResultCacheStatistics ResultCache::GetStatistics() {
+	lock_guard<mutex> guard(lock);
+	ResultCacheStatistics result;
+	result.hits = hits;
+	result.misses = misses;
+	result.evictions = evictions;
+	result.invalidations = invalidations;
+	result.entries = entries.size();
+	result.memory_usage = memory_usage;
+	result.memory_limit = memory_limit;
+	return result;
+}
+
+} // namespace duckdb
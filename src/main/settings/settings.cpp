@@ -9,6 +9,7 @@
 #include "duckdb/main/database.hpp"
 #include "duckdb/main/database_manager.hpp"
 #include "duckdb/main/query_profiler.hpp"
+#include "duckdb/main/result_cache.hpp"
 #include "duckdb/main/secret/secret_manager.hpp"
 #include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/parser/parser.hpp"
@@ -112,6 +113,22 @@ Value CheckpointThresholdSetting::GetSetting(const ClientContext &context) {
 	return Value(StringUtil::BytesToHumanReadableString(config.options.checkpoint_wal_size));
 }
 
+//===--------------------------------------------------------------------===//
+// WAL Commit Delay
+//===--------------------------------------------------------------------===//
+void WALCommitDelaySetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.wal_commit_delay = input.GetValue<uint64_t>();
+}
+
+void WALCommitDelaySetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.wal_commit_delay = DBConfig().options.wal_commit_delay;
+}
+
+Value WALCommitDelaySetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::UBIGINT(config.options.wal_commit_delay);
+}
+
 //===--------------------------------------------------------------------===//
 // Debug Checkpoint Abort
 //===--------------------------------------------------------------------===//
@@ -1862,6 +1879,22 @@ Value TempDirectorySetting::GetSetting(const ClientContext &context) {
 	return Value(buffer_manager.GetTemporaryDirectory());
 }
 
+//===--------------------------------------------------------------------===//
+// Temp File Compression
+//===--------------------------------------------------------------------===//
+void TempFileCompressionSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.temp_file_compression = input.GetValue<bool>();
+}
+
+void TempFileCompressionSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.temp_file_compression = DBConfig().options.temp_file_compression;
+}
+
+Value TempFileCompressionSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.temp_file_compression);
+}
+
 //===--------------------------------------------------------------------===//
 // Threads Setting
 //===--------------------------------------------------------------------===//
@@ -1974,6 +2007,81 @@ Value AllocatorBackgroundThreadsSetting::GetSetting(const ClientContext &context
 	return Value(config.options.allocator_background_threads);
 }
 
+//===--------------------------------------------------------------------===//
+// Buffer Eviction Policy
+//===--------------------------------------------------------------------===//
+void BufferEvictionPolicySetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	auto parameter = StringUtil::Upper(input.ToString());
+	if (parameter == "LRU") {
+		config.options.buffer_eviction_policy = BufferEvictionPolicy::LRU;
+	} else if (parameter == "SCAN_RESISTANT") {
+		config.options.buffer_eviction_policy = BufferEvictionPolicy::SCAN_RESISTANT;
+	} else {
+		throw InvalidInputException(
+		    "Unrecognized parameter for option BUFFER_EVICTION_POLICY \"%s\". Expected LRU or SCAN_RESISTANT.",
+		    parameter);
+	}
+	if (db) {
+		BufferManager::GetBufferManager(*db).GetBufferPool().SetEvictionPolicy(config.options.buffer_eviction_policy);
+	}
+}
+
+void BufferEvictionPolicySetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.buffer_eviction_policy = DBConfig().options.buffer_eviction_policy;
+	if (db) {
+		BufferManager::GetBufferManager(*db).GetBufferPool().SetEvictionPolicy(config.options.buffer_eviction_policy);
+	}
+}
+
+Value BufferEvictionPolicySetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value(EnumUtil::ToString(config.options.buffer_eviction_policy));
+}
+
+//===--------------------------------------------------------------------===//
+// Enable Result Cache
+//===--------------------------------------------------------------------===//
+void EnableResultCacheSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.enable_result_cache = input.GetValue<bool>();
+	if (db && !config.options.enable_result_cache) {
+		ResultCache::Get(*db).Clear();
+	}
+}
+
+void EnableResultCacheSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.enable_result_cache = DBConfig().options.enable_result_cache;
+	if (db && !config.options.enable_result_cache) {
+		ResultCache::Get(*db).Clear();
+	}
+}
+
+Value EnableResultCacheSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.enable_result_cache);
+}
+
+//===--------------------------------------------------------------------===//
+// Result Cache Memory Limit
+//===--------------------------------------------------------------------===//
+void ResultCacheMemoryLimitSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.result_cache_memory_limit = DBConfig::ParseMemoryLimit(input.ToString());
+	if (db) {
+		ResultCache::Get(*db).SetMemoryLimit(config.options.result_cache_memory_limit);
+	}
+}
+
+void ResultCacheMemoryLimitSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.result_cache_memory_limit = DBConfig().options.result_cache_memory_limit;
+	if (db) {
+		ResultCache::Get(*db).SetMemoryLimit(config.options.result_cache_memory_limit);
+	}
+}
+
+Value ResultCacheMemoryLimitSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value(StringUtil::BytesToHumanReadableString(config.options.result_cache_memory_limit));
+}
+
 //===--------------------------------------------------------------------===//
 // DuckDBApi Setting
 //===--------------------------------------------------------------------===//
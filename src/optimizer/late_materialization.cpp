@@ -0,0 +1,291 @@
+#include "duckdb/optimizer/late_materialization.hpp"
+
+#include "duckdb/common/file_system.hpp"
+#include "duckdb/execution/operator/join/join_filter_pushdown.hpp"
+#include "duckdb/optimizer/optimizer.hpp"
+#include "duckdb/planner/binder.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/planner/expression_iterator.hpp"
+#include "duckdb/planner/operator/logical_comparison_join.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
+#include "duckdb/planner/operator/logical_order.hpp"
+#include "duckdb/planner/operator/logical_projection.hpp"
+#include "duckdb/planner/operator/logical_top_n.hpp"
+
+namespace duckdb {
+
+LateMaterialization::LateMaterialization(Optimizer &optimizer) : optimizer(optimizer) {
+}
+
+unique_ptr<LogicalOperator> LateMaterialization::Optimize(unique_ptr<LogicalOperator> op) {
+	OptimizeInternal(op);
+	// the rewritten Top-N operators have new column bindings - update the operators that reference them
+	for (auto &replacer : replacers) {
+		replacer.VisitOperator(*op);
+	}
+	return op;
+}
+
+void LateMaterialization::OptimizeInternal(unique_ptr<LogicalOperator> &op) {
+	if (TryLateMaterialization(op)) {
+		// the children of a rewritten Top-N are only projections and scans - nothing left to rewrite
+		return;
+	}
+	for (auto &child : op->children) {
+		OptimizeInternal(child);
+	}
+}
+
+vector<column_t> LateMaterialization::GetRowIdColumns(LogicalGet &get) {
+	if (get.function.row_id_filter_pushdown) {
+		// DuckDB table - the row id identifies the row, and rows can be fetched by row id
+		return {COLUMN_IDENTIFIER_ROW_ID};
+	}
+	if (get.function.name != "parquet_scan" && get.function.name != "read_parquet") {
+		return {};
+	}
+	// Parquet - the file_row_number identifies the row within a file, so we can only do this for a single file
+	if (get.parameters.size() != 1 || get.parameters[0].IsNull() ||
+	    get.parameters[0].type().id() != LogicalTypeId::VARCHAR) {
+		return {};
+	}
+	if (FileSystem::HasGlob(StringValue::Get(get.parameters[0]))) {
+		return {};
+	}
+	for (idx_t col_idx = 0; col_idx < get.names.size(); col_idx++) {
+		if (get.names[col_idx] == "file_row_number" && get.returned_types[col_idx] == LogicalType::BIGINT) {
+			return {col_idx};
+		}
+	}
+	return {};
+}
+
+bool LateMaterialization::ResolveScanColumn(ColumnBinding &binding,
+                                            const vector<reference<LogicalProjection>> &projections, LogicalGet &get) {
+	for (auto &projection_ref : projections) {
+		auto &projection = projection_ref.get();
+		if (binding.table_index != projection.table_index) {
+			return false;
+		}
+		auto &expr = *projection.expressions[binding.column_index];
+		if (expr.type != ExpressionType::BOUND_COLUMN_REF) {
+			return false;
+		}
+		binding = expr.Cast<BoundColumnRefExpression>().binding;
+	}
+	return binding.table_index == get.table_index;
+}
+
+bool LateMaterialization::TryLateMaterialization(unique_ptr<LogicalOperator> &op) {
+	if (op->type != LogicalOperatorType::LOGICAL_TOP_N) {
+		return false;
+	}
+	if (optimizer.OptimizerDisabled(OptimizerType::JOIN_FILTER_PUSHDOWN)) {
+		// the selected row identifiers only reach the scan through join filter pushdown
+		// without it the join would scan the entire table again
+		return false;
+	}
+	auto &top_n = op->Cast<LogicalTopN>();
+	// the selected row identifiers are pushed into the scan as an exact IN filter - so the Top-N has to be small
+	const auto max_row_count = JoinFilterPushdownInfo::IN_FILTER_MAX_DISTINCT_KEYS;
+	if (top_n.limit > max_row_count || top_n.offset > max_row_count - top_n.limit) {
+		return false;
+	}
+	// find the scan - only projections are allowed in between
+	vector<reference<LogicalProjection>> projections;
+	reference<LogicalOperator> child = *top_n.children[0];
+	while (child.get().type == LogicalOperatorType::LOGICAL_PROJECTION) {
+		projections.push_back(child.get().Cast<LogicalProjection>());
+		child = *child.get().children[0];
+	}
+	if (child.get().type != LogicalOperatorType::LOGICAL_GET) {
+		return false;
+	}
+	auto &get = child.get().Cast<LogicalGet>();
+	if (!get.children.empty() || !get.function.projection_pushdown || !get.function.filter_pushdown) {
+		return false;
+	}
+	auto row_id_columns = GetRowIdColumns(get);
+	if (row_id_columns.empty()) {
+		return false;
+	}
+	if (get.has_estimated_cardinality && get.estimated_cardinality <= top_n.limit + top_n.offset) {
+		// the Top-N does not reduce the amount of rows
+		return false;
+	}
+
+	// figure out which columns of the scan are used by the ORDER BY
+	auto &column_ids = get.GetColumnIds();
+	bool resolved = true;
+	vector<idx_t> order_columns;
+	for (auto &order : top_n.orders) {
+		ExpressionIterator::EnumerateExpression(order.expression, [&](Expression &expr) {
+			if (expr.type != ExpressionType::BOUND_COLUMN_REF) {
+				return;
+			}
+			auto binding = expr.Cast<BoundColumnRefExpression>().binding;
+			if (!ResolveScanColumn(binding, projections, get)) {
+				resolved = false;
+				return;
+			}
+			if (std::find(order_columns.begin(), order_columns.end(), binding.column_index) == order_columns.end()) {
+				order_columns.push_back(binding.column_index);
+			}
+		});
+	}
+	if (!resolved) {
+		return false;
+	}
+	// check that there are columns that we can materialize late
+	bool has_late_columns = false;
+	for (auto &binding : get.GetColumnBindings()) {
+		auto column_id = column_ids[binding.column_index];
+		if (std::find(order_columns.begin(), order_columns.end(), binding.column_index) == order_columns.end() &&
+		    std::find(row_id_columns.begin(), row_id_columns.end(), column_id) == row_id_columns.end()) {
+			has_late_columns = true;
+			break;
+		}
+	}
+	if (!has_late_columns) {
+		return false;
+	}
+
+	// create a copy of the scan that only scans the sort keys, the filter columns and the row identifiers
+	unique_ptr<LogicalOperator> key_scan_op;
+	try {
+		key_scan_op = get.Copy(optimizer.context);
+	} catch (NotImplementedException &) {
+		// the scan cannot be copied
+		return false;
+	}
+	auto &key_scan = key_scan_op->Cast<LogicalGet>();
+	key_scan.table_index = optimizer.binder.GenerateTableIndex();
+	key_scan.ClearColumnIds();
+	key_scan.projection_ids.clear();
+	key_scan.table_filters.filters.clear();
+	key_scan.SetEstimatedCardinality(get.estimated_cardinality);
+	auto add_key_column = [&](column_t column_id) {
+		auto &key_column_ids = key_scan.GetColumnIds();
+		auto entry = std::find(key_column_ids.begin(), key_column_ids.end(), column_id);
+		if (entry != key_column_ids.end()) {
+			return NumericCast<idx_t>(entry - key_column_ids.begin());
+		}
+		key_scan.AddColumnId(column_id);
+		return key_column_ids.size() - 1;
+	};
+	unordered_map<idx_t, idx_t> key_column_map;
+	vector<idx_t> key_projection_ids;
+	for (auto &column_idx : order_columns) {
+		key_column_map[column_idx] = add_key_column(column_ids[column_idx]);
+		key_projection_ids.push_back(key_column_map[column_idx]);
+	}
+	vector<ColumnBinding> key_row_id_bindings;
+	for (auto &row_id_column : row_id_columns) {
+		auto key_column_idx = add_key_column(row_id_column);
+		key_projection_ids.push_back(key_column_idx);
+		key_row_id_bindings.emplace_back(key_scan.table_index, key_column_idx);
+	}
+	bool has_filter_columns = false;
+	for (auto &entry : get.table_filters.filters) {
+		// table filters are keyed by the column id in the table
+		auto key_column_idx = add_key_column(entry.first);
+		if (std::find(key_projection_ids.begin(), key_projection_ids.end(), key_column_idx) ==
+		    key_projection_ids.end()) {
+			has_filter_columns = true;
+		}
+		key_scan.table_filters.filters[entry.first] = entry.second->Copy();
+	}
+	if (has_filter_columns && get.function.filter_prune) {
+		// prune the filter-only columns
+		key_scan.projection_ids = std::move(key_projection_ids);
+	}
+
+	// compute the Top-N over the key columns
+	vector<BoundOrderByNode> key_orders;
+	for (auto &order : top_n.orders) {
+		auto key_order = order.Copy();
+		ExpressionIterator::EnumerateExpression(key_order.expression, [&](Expression &expr) {
+			if (expr.type != ExpressionType::BOUND_COLUMN_REF) {
+				return;
+			}
+			auto &colref = expr.Cast<BoundColumnRefExpression>();
+			ResolveScanColumn(colref.binding, projections, get);
+			colref.binding = ColumnBinding(key_scan.table_index, key_column_map[colref.binding.column_index]);
+		});
+		key_orders.push_back(std::move(key_order));
+	}
+	auto key_top_n = make_uniq<LogicalTopN>(std::move(key_orders), top_n.limit, top_n.offset);
+	key_top_n->children.push_back(std::move(key_scan_op));
+	key_top_n->SetEstimatedCardinality(top_n.estimated_cardinality);
+	// the dynamic filter of the Top-N was copied into the key scan along with the other filters
+	key_top_n->dynamic_filter = std::move(top_n.dynamic_filter);
+
+	// the original scan now only needs to fetch the selected rows - we also need the row identifiers to join on
+	top_n.ResolveOperatorTypes();
+	auto top_n_bindings = top_n.GetColumnBindings();
+	auto top_n_types = top_n.types;
+	vector<ColumnBinding> row_id_bindings;
+	vector<LogicalType> row_id_types;
+	for (auto &row_id_column : row_id_columns) {
+		auto entry = std::find(column_ids.begin(), column_ids.end(), row_id_column);
+		idx_t column_idx;
+		if (entry == column_ids.end()) {
+			get.AddColumnId(row_id_column);
+			column_idx = column_ids.size() - 1;
+		} else {
+			column_idx = NumericCast<idx_t>(entry - column_ids.begin());
+		}
+		if (!get.projection_ids.empty()) {
+			get.projection_ids.push_back(column_idx);
+		}
+		row_id_bindings.emplace_back(get.table_index, column_idx);
+		row_id_types.push_back(row_id_column == COLUMN_IDENTIFIER_ROW_ID ? LogicalType::ROW_TYPE
+		                                                                 : get.returned_types[row_id_column]);
+	}
+	// pass the row identifiers through the projections
+	for (idx_t proj_idx = projections.size(); proj_idx > 0; proj_idx--) {
+		auto &projection = projections[proj_idx - 1].get();
+		for (idx_t i = 0; i < row_id_bindings.size(); i++) {
+			projection.expressions.push_back(make_uniq<BoundColumnRefExpression>(row_id_types[i], row_id_bindings[i]));
+			row_id_bindings[i] = ColumnBinding(projection.table_index, projection.expressions.size() - 1);
+		}
+	}
+
+	// join the selected rows with the scan on the row identifiers
+	auto join = make_uniq<LogicalComparisonJoin>(JoinType::INNER);
+	for (idx_t i = 0; i < row_id_bindings.size(); i++) {
+		JoinCondition condition;
+		condition.left = make_uniq<BoundColumnRefExpression>(row_id_types[i], row_id_bindings[i]);
+		condition.right = make_uniq<BoundColumnRefExpression>(row_id_types[i], key_row_id_bindings[i]);
+		condition.comparison = ExpressionType::COMPARE_EQUAL;
+		join->conditions.push_back(std::move(condition));
+	}
+	join->children.push_back(std::move(top_n.children[0]));
+	join->children.push_back(std::move(key_top_n));
+	join->SetEstimatedCardinality(top_n.estimated_cardinality);
+
+	// the join does not preserve the order - re-order the (small) result
+	auto order = make_uniq<LogicalOrder>(std::move(top_n.orders));
+	order->children.push_back(std::move(join));
+	order->SetEstimatedCardinality(top_n.estimated_cardinality);
+
+	// finally project out the row identifiers again
+	auto projection_index = optimizer.binder.GenerateTableIndex();
+	vector<unique_ptr<Expression>> expressions;
+	ColumnBindingReplacer replacer;
+	for (idx_t i = 0; i < top_n_bindings.size(); i++) {
+		expressions.push_back(make_uniq<BoundColumnRefExpression>(top_n_types[i], top_n_bindings[i]));
+		replacer.replacement_bindings.emplace_back(top_n_bindings[i], ColumnBinding(projection_index, i));
+	}
+	auto projection = make_uniq<LogicalProjection>(projection_index, std::move(expressions));
+	projection->children.push_back(std::move(order));
+	projection->SetEstimatedCardinality(top_n.estimated_cardinality);
+	projection->ResolveOperatorTypes();
+
+	replacer.stop_operator = projection.get();
+	replacers.push_back(std::move(replacer));
+	op = std::move(projection);
+	return true;
+}
+
+} // namespace duckdb
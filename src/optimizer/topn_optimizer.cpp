@@ -1,12 +1,19 @@
 #include "duckdb/optimizer/topn_optimizer.hpp"
 
 #include "duckdb/common/limits.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/planner/filter/dynamic_filter.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
 #include "duckdb/planner/operator/logical_limit.hpp"
 #include "duckdb/planner/operator/logical_order.hpp"
+#include "duckdb/planner/operator/logical_projection.hpp"
 #include "duckdb/planner/operator/logical_top_n.hpp"
 
 namespace duckdb {
 
+TopN::TopN(ClientContext &context_p) : context(context_p) {
+}
+
 bool TopN::CanOptimize(LogicalOperator &op) {
 	if (op.type == LogicalOperatorType::LOGICAL_LIMIT) {
 		auto &limit = op.Cast<LogicalLimit>();
@@ -32,6 +39,87 @@ bool TopN::CanOptimize(LogicalOperator &op) {
 	return false;
 }
 
+static bool CanPushdownDynamicFilter(const LogicalType &type) {
+	if (type.id() == LogicalTypeId::ENUM) {
+		return false;
+	}
+	switch (type.InternalType()) {
+	case PhysicalType::UINT8:
+	case PhysicalType::UINT16:
+	case PhysicalType::UINT32:
+	case PhysicalType::UINT64:
+	case PhysicalType::UINT128:
+	case PhysicalType::INT8:
+	case PhysicalType::INT16:
+	case PhysicalType::INT32:
+	case PhysicalType::INT64:
+	case PhysicalType::INT128:
+	case PhysicalType::VARCHAR:
+		return true;
+	default:
+		return false;
+	}
+}
+
+void TopN::PushdownDynamicFilters(LogicalTopN &op) {
+	// the heap boundary only filters on the first order column
+	auto &order = op.orders[0];
+	if (order.null_order != OrderByNullType::NULLS_LAST || op.limit == 0) {
+		// NULL values are not included in the filter - so they need to be sorted last
+		return;
+	}
+	auto &type = order.expression->return_type;
+	if (order.expression->type != ExpressionType::BOUND_COLUMN_REF || !CanPushdownDynamicFilter(type)) {
+		return;
+	}
+	auto binding = order.expression->Cast<BoundColumnRefExpression>().binding;
+	// find the scan the column originates from - only projections and filters can be in between
+	reference<LogicalOperator> child = *op.children[0];
+	bool has_filters = false;
+	while (child.get().type != LogicalOperatorType::LOGICAL_GET) {
+		if (child.get().type == LogicalOperatorType::LOGICAL_PROJECTION) {
+			auto &projection = child.get().Cast<LogicalProjection>();
+			if (binding.table_index != projection.table_index) {
+				return;
+			}
+			auto &expr = *projection.expressions[binding.column_index];
+			if (expr.type != ExpressionType::BOUND_COLUMN_REF) {
+				return;
+			}
+			binding = expr.Cast<BoundColumnRefExpression>().binding;
+		} else if (child.get().type == LogicalOperatorType::LOGICAL_FILTER) {
+			has_filters = true;
+		} else {
+			return;
+		}
+		child = *child.get().children[0];
+	}
+	auto &get = child.get().Cast<LogicalGet>();
+	if (binding.table_index != get.table_index || !get.function.dynamic_filter_pushdown) {
+		return;
+	}
+	auto &column_ids = get.GetColumnIds();
+	if (binding.column_index >= column_ids.size() || column_ids[binding.column_index] == COLUMN_IDENTIFIER_ROW_ID) {
+		return;
+	}
+	ExpressionType comparison_type;
+	if (order.type == OrderType::ASCENDING) {
+		comparison_type = ExpressionType::COMPARE_LESSTHANOREQUALTO;
+	} else if (order.type == OrderType::DESCENDING) {
+		comparison_type = ExpressionType::COMPARE_GREATERTHANOREQUALTO;
+	} else {
+		return;
+	}
+	// rows past the boundary of the heap can never make it into the Top-N - the scan can skip them
+	op.dynamic_filter = make_shared_ptr<DynamicFilterData>(comparison_type);
+	get.table_filters.PushFilter(column_ids[binding.column_index], make_uniq<DynamicFilter>(op.dynamic_filter));
+
+	if (!has_filters && order.type == OrderType::ASCENDING && get.function.pushdown_top_n) {
+		// every row of the scan reaches the Top-N - the scan can produce its rows in order and stop early
+		get.function.pushdown_top_n(context, get, get.bind_data.get(), binding.column_index, op.limit + op.offset);
+	}
+}
+
 unique_ptr<LogicalOperator> TopN::Optimize(unique_ptr<LogicalOperator> op) {
 	if (CanOptimize(*op)) {
 
@@ -67,6 +155,7 @@ unique_ptr<LogicalOperator> TopN::Optimize(unique_ptr<LogicalOperator> op) {
 			cardinality = topn->children[0]->estimated_cardinality;
 		}
 		topn->SetEstimatedCardinality(cardinality);
+		PushdownDynamicFilters(*topn);
 		op = std::move(topn);
 
 		// reconstruct all projection nodes above limit operator
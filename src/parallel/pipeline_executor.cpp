@@ -506,6 +506,10 @@ SourceResultType PipelineExecutor::FetchFromSource(DataChunk &result) {
 	// Ensures Sinks only return empty results when Blocking or Finished
 	D_ASSERT(res != SourceResultType::BLOCKED || result.size() == 0);
 
+	if (res == SourceResultType::FINISHED) {
+		// the source is exhausted - collect any information it can only report after execution
+		context.thread.profiler.FinishSource(*pipeline.source_state, *local_source_state);
+	}
 	EndOperator(*pipeline.source, &result);
 
 	return res;
@@ -1,8 +1,11 @@
 #include "duckdb/parallel/task_scheduler.hpp"
 
 #include "duckdb/common/chrono.hpp"
+#include "duckdb/common/deque.hpp"
 #include "duckdb/common/exception.hpp"
+#include "duckdb/common/file_system.hpp"
 #include "duckdb/common/numeric_utils.hpp"
+#include "duckdb/common/optional_ptr.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/database.hpp"
 
@@ -38,12 +41,85 @@ struct SchedulerThread {
 typedef duckdb_moodycamel::ConcurrentQueue<shared_ptr<Task>> concurrent_queue_t;
 typedef duckdb_moodycamel::LightweightSemaphore lightweight_semaphore_t;
 
+struct ConcurrentQueue;
+
+//! A task in the queue of a worker, together with the producer that scheduled it
+struct WorkerTask {
+	optional_ptr<ProducerToken> token;
+	shared_ptr<Task> task;
+};
+
+//! The task queue of a single worker thread. The worker pushes and pops tasks at the back of the queue, which keeps
+//! tasks on the thread (and cache) that produced them, while other threads steal from the front of the queue.
+struct WorkerQueue {
+	WorkerQueue(ConcurrentQueue &owner, idx_t worker_id)
+	    : owner(owner), worker_id(worker_id), task_count(0), numa_node(0), dequeue_count(0), scheduled_tasks(0),
+	      executed_tasks(0), stolen_tasks(0), failed_steals(0), lock_contention(0) {
+	}
+
+	ConcurrentQueue &owner;
+	idx_t worker_id;
+	mutex lock;
+	deque<WorkerTask> tasks;
+	//! The amount of tasks in the queue - allows checking for tasks without locking
+	atomic<idx_t> task_count;
+	//! The NUMA node the worker last executed a task on
+	atomic<idx_t> numa_node;
+	//! The amount of dequeue attempts by the worker
+	idx_t dequeue_count;
+
+	//! Statistics
+	atomic<idx_t> scheduled_tasks;
+	atomic<idx_t> executed_tasks;
+	atomic<idx_t> stolen_tasks;
+	atomic<idx_t> failed_steals;
+	atomic<idx_t> lock_contention;
+
+public:
+	void Push(ProducerToken &token, shared_ptr<Task> task);
+	//! Pops the most recently scheduled task (used by the owning worker)
+	bool PopBack(shared_ptr<Task> &task);
+	//! Pops the least recently scheduled task (used by other threads)
+	bool PopFront(shared_ptr<Task> &task);
+	//! Pops a task scheduled by the given producer
+	bool PopFromProducer(ProducerToken &token, shared_ptr<Task> &task);
+
+private:
+	unique_lock<mutex> Lock();
+};
+
+//! The worker queue of the calling thread, if it is a worker thread of a scheduler
+static thread_local WorkerQueue *current_worker_queue = nullptr;
+
 struct ConcurrentQueue {
+	ConcurrentQueue();
+
+	//! The maximum amount of worker queues - workers beyond this amount share a queue
+	static constexpr const idx_t MAX_WORKER_QUEUES = 1024;
+	//! Every so many dequeues a worker checks the global queue before its own queue, to avoid starving it
+	static constexpr const idx_t GLOBAL_QUEUE_CHECK_INTERVAL = 61;
+
+	//! The global queue - holds the tasks scheduled by non-worker threads
 	concurrent_queue_t q;
 	lightweight_semaphore_t semaphore;
+	//! The per-worker queues - the first "worker_queue_count" entries are initialized and never destroyed
+	vector<unique_ptr<WorkerQueue>> worker_queues;
+	atomic<idx_t> worker_queue_count;
+	//! The NUMA node of every CPU (empty if there is only a single NUMA node)
+	vector<idx_t> cpu_numa_nodes;
 
 	void Enqueue(ProducerToken &token, shared_ptr<Task> task);
 	bool DequeueFromProducer(ProducerToken &token, shared_ptr<Task> &task);
+	//! Dequeues any task - from the queue of the calling worker, the global queue, or from another worker
+	bool Dequeue(shared_ptr<Task> &task);
+	//! Gets (or creates) the queue of the given worker - must be called while holding the scheduler's thread lock
+	WorkerQueue &GetWorkerQueue(idx_t worker_id);
+	//! Returns the NUMA node the calling thread is currently running on
+	idx_t GetNUMANode() const;
+
+private:
+	WorkerQueue *GetCurrentWorkerQueue();
+	bool Steal(WorkerQueue *worker_queue, shared_ptr<Task> &task);
 };
 
 struct QueueProducerToken {
@@ -53,7 +129,149 @@ struct QueueProducerToken {
 	duckdb_moodycamel::ProducerToken queue_token;
 };
 
+unique_lock<mutex> WorkerQueue::Lock() {
+	unique_lock<mutex> guard(lock, std::try_to_lock);
+	if (!guard.owns_lock()) {
+		lock_contention++;
+		guard.lock();
+	}
+	return guard;
+}
+
+void WorkerQueue::Push(ProducerToken &token, shared_ptr<Task> task) {
+	auto guard = Lock();
+	tasks.push_back(WorkerTask {&token, std::move(task)});
+	task_count++;
+	scheduled_tasks++;
+}
+
+bool WorkerQueue::PopBack(shared_ptr<Task> &task) {
+	if (task_count == 0) {
+		return false;
+	}
+	auto guard = Lock();
+	if (tasks.empty()) {
+		return false;
+	}
+	task = std::move(tasks.back().task);
+	tasks.pop_back();
+	task_count--;
+	return true;
+}
+
+bool WorkerQueue::PopFront(shared_ptr<Task> &task) {
+	if (task_count == 0) {
+		return false;
+	}
+	auto guard = Lock();
+	if (tasks.empty()) {
+		return false;
+	}
+	task = std::move(tasks.front().task);
+	tasks.pop_front();
+	task_count--;
+	return true;
+}
+
+bool WorkerQueue::PopFromProducer(ProducerToken &token, shared_ptr<Task> &task) {
+	if (task_count == 0) {
+		return false;
+	}
+	auto guard = Lock();
+	for (auto it = tasks.begin(); it != tasks.end(); it++) {
+		if (it->token.get() == &token) {
+			task = std::move(it->task);
+			tasks.erase(it);
+			task_count--;
+			return true;
+		}
+	}
+	return false;
+}
+
+static vector<idx_t> GetCPUNUMANodes() {
+	vector<idx_t> result;
+#if defined(__linux__) && !defined(DUCKDB_WASM)
+	static constexpr const idx_t MAX_NUMA_NODES = 64;
+	auto fs = FileSystem::CreateLocal();
+	idx_t node_count = 0;
+	for (idx_t node = 0; node < MAX_NUMA_NODES; node++) {
+		auto cpu_list_path = StringUtil::Format("/sys/devices/system/node/node%d/cpulist", node);
+		if (!fs->FileExists(cpu_list_path)) {
+			break;
+		}
+		node_count++;
+		// the cpu list has the format "0-3,8-11"
+		char buffer[1024];
+		auto handle = fs->OpenFile(cpu_list_path, FileFlags::FILE_FLAGS_READ);
+		auto bytes_read = fs->Read(*handle, buffer, sizeof(buffer) - 1);
+		buffer[bytes_read] = '\0';
+		for (auto &range : StringUtil::Split(StringUtil::Replace(buffer, "\n", ""), ',')) {
+			auto bounds = StringUtil::Split(range, '-');
+			if (bounds.empty() || bounds.size() > 2) {
+				continue;
+			}
+			auto start = std::stoull(bounds[0]);
+			auto end = bounds.size() == 2 ? std::stoull(bounds[1]) : start;
+			for (auto cpu = start; cpu <= end; cpu++) {
+				if (cpu >= result.size()) {
+					result.resize(cpu + 1, 0);
+				}
+				result[cpu] = node;
+			}
+		}
+	}
+	if (node_count <= 1) {
+		// single NUMA node - no need to take the topology into account
+		result.clear();
+	}
+#endif
+	return result;
+}
+
+ConcurrentQueue::ConcurrentQueue() : worker_queues(MAX_WORKER_QUEUES), worker_queue_count(0) {
+	try {
+		cpu_numa_nodes = GetCPUNUMANodes();
+	} catch (std::exception &) {
+		// failed to read the NUMA topology - treat all CPUs as a single node
+		cpu_numa_nodes.clear();
+	}
+}
+
+idx_t ConcurrentQueue::GetNUMANode() const {
+	if (cpu_numa_nodes.empty()) {
+		return 0;
+	}
+	auto cpu = TaskScheduler::GetEstimatedCPUId();
+	return cpu < cpu_numa_nodes.size() ? cpu_numa_nodes[cpu] : 0;
+}
+
+WorkerQueue &ConcurrentQueue::GetWorkerQueue(idx_t worker_id) {
+	auto queue_idx = worker_id % MAX_WORKER_QUEUES;
+	if (queue_idx >= worker_queue_count) {
+		D_ASSERT(queue_idx == worker_queue_count);
+		worker_queues[queue_idx] = make_uniq<WorkerQueue>(*this, worker_id);
+		// publish the queue only after it has been initialized
+		worker_queue_count++;
+	}
+	return *worker_queues[queue_idx];
+}
+
+WorkerQueue *ConcurrentQueue::GetCurrentWorkerQueue() {
+	if (current_worker_queue && &current_worker_queue->owner == this) {
+		return current_worker_queue;
+	}
+	return nullptr;
+}
+
 void ConcurrentQueue::Enqueue(ProducerToken &token, shared_ptr<Task> task) {
+	auto worker_queue = GetCurrentWorkerQueue();
+	if (worker_queue) {
+		// tasks scheduled by a worker are kept in the queue of that worker - close to the data it just touched
+		worker_queue->Push(token, std::move(task));
+		semaphore.signal();
+		return;
+	}
 	lock_guard<mutex> producer_lock(token.producer_lock);
 	if (q.enqueue(token.token->queue_token, std::move(task))) {
 		semaphore.signal();
@@ -63,8 +281,70 @@ void ConcurrentQueue::Enqueue(ProducerToken &token, shared_ptr<Task> task) {
 }
 
 bool ConcurrentQueue::DequeueFromProducer(ProducerToken &token, shared_ptr<Task> &task) {
-	lock_guard<mutex> producer_lock(token.producer_lock);
-	return q.try_dequeue_from_producer(token.token->queue_token, task);
+	{
+		lock_guard<mutex> producer_lock(token.producer_lock);
+		if (q.try_dequeue_from_producer(token.token->queue_token, task)) {
+			return true;
+		}
+	}
+	// the producer might have scheduled tasks from within a worker thread - look through the worker queues
+	auto queue_count = worker_queue_count.load();
+	for (idx_t i = 0; i < queue_count; i++) {
+		if (worker_queues[i]->PopFromProducer(token, task)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+bool ConcurrentQueue::Dequeue(shared_ptr<Task> &task) {
+	auto worker_queue = GetCurrentWorkerQueue();
+	if (worker_queue) {
+		if (++worker_queue->dequeue_count % GLOBAL_QUEUE_CHECK_INTERVAL == 0 && q.try_dequeue(task)) {
+			return true;
+		}
+		if (worker_queue->PopBack(task)) {
+			return true;
+		}
+	}
+	if (q.try_dequeue(task)) {
+		return true;
+	}
+	return Steal(worker_queue, task);
+}
+
+bool ConcurrentQueue::Steal(WorkerQueue *worker_queue, shared_ptr<Task> &task) {
+	auto queue_count = worker_queue_count.load();
+	if (queue_count == 0) {
+		return false;
+	}
+	// start at a different victim for every thief to spread out the stealing
+	auto start = worker_queue ? worker_queue->worker_id + 1 : TaskScheduler::GetEstimatedCPUId();
+	// first try to steal from workers on the same NUMA node, only then from workers on other nodes
+	auto numa_node = GetNUMANode();
+	idx_t passes = cpu_numa_nodes.empty() ? 1 : 2;
+	for (idx_t pass = 0; pass < passes; pass++) {
+		for (idx_t i = 0; i < queue_count; i++) {
+			auto &victim = *worker_queues[(start + i) % queue_count];
+			if (&victim == worker_queue || victim.task_count == 0) {
+				continue;
+			}
+			bool same_node = victim.numa_node == numa_node;
+			if (passes > 1 && same_node != (pass == 0)) {
+				continue;
+			}
+			if (victim.PopFront(task)) {
+				if (worker_queue) {
+					worker_queue->stolen_tasks++;
+				}
+				return true;
+			}
+		}
+	}
+	if (worker_queue) {
+		worker_queue->failed_steals++;
+	}
+	return false;
 }
 
 #else
@@ -185,7 +465,14 @@ void TaskScheduler::ExecuteForever(atomic<bool> *marker) {
 				}
 			}
 		}
-		if (queue->q.try_dequeue(task)) {
+		if (queue->Dequeue(task)) {
+			auto worker_queue = current_worker_queue;
+			if (worker_queue) {
+				worker_queue->executed_tasks++;
+				if (!queue->cpu_numa_nodes.empty()) {
+					worker_queue->numa_node = queue->GetNUMANode();
+				}
+			}
 			auto execute_result = task->Execute(TaskExecutionMode::PROCESS_ALL);
 
 			switch (execute_result) {
@@ -218,7 +505,7 @@ idx_t TaskScheduler::ExecuteTasks(atomic<bool> *marker, idx_t max_tasks) {
 	// loop until the marker is set to false
 	while (*marker && completed_tasks < max_tasks) {
 		shared_ptr<Task> task;
-		if (!queue->q.try_dequeue(task)) {
+		if (!queue->Dequeue(task)) {
 			return completed_tasks;
 		}
 		auto execute_result = task->Execute(TaskExecutionMode::PROCESS_ALL);
@@ -248,7 +535,7 @@ void TaskScheduler::ExecuteTasks(idx_t max_tasks) {
 	shared_ptr<Task> task;
 	for (idx_t i = 0; i < max_tasks; i++) {
 		queue->semaphore.wait(TASK_TIMEOUT_USECS);
-		if (!queue->q.try_dequeue(task)) {
+		if (!queue->Dequeue(task)) {
 			return;
 		}
 		try {
@@ -275,8 +562,10 @@ void TaskScheduler::ExecuteTasks(idx_t max_tasks) {
 }
 
 #ifndef DUCKDB_NO_THREADS
-static void ThreadExecuteTasks(TaskScheduler *scheduler, atomic<bool> *marker) {
+static void ThreadExecuteTasks(TaskScheduler *scheduler, atomic<bool> *marker, WorkerQueue *worker_queue) {
+	current_worker_queue = worker_queue;
 	scheduler->ExecuteForever(marker);
+	current_worker_queue = nullptr;
 }
 #endif
 
@@ -317,6 +606,27 @@ void TaskScheduler::Signal(idx_t n) {
 #endif
 }
 
+vector<SchedulerWorkerInfo> TaskScheduler::GetWorkerInfo() {
+	vector<SchedulerWorkerInfo> result;
+#ifndef DUCKDB_NO_THREADS
+	auto queue_count = queue->worker_queue_count.load();
+	for (idx_t i = 0; i < queue_count; i++) {
+		auto &worker_queue = *queue->worker_queues[i];
+		SchedulerWorkerInfo info;
+		info.worker_id = worker_queue.worker_id;
+		info.numa_node = worker_queue.numa_node;
+		info.queued_tasks = worker_queue.task_count;
+		info.scheduled_tasks = worker_queue.scheduled_tasks;
+		info.executed_tasks = worker_queue.executed_tasks;
+		info.stolen_tasks = worker_queue.stolen_tasks;
+		info.failed_steals = worker_queue.failed_steals;
+		info.lock_contention = worker_queue.lock_contention;
+		result.push_back(info);
+	}
+#endif
+	return result;
+}
+
 void TaskScheduler::YieldThread() {
 #ifndef DUCKDB_NO_THREADS
 	std::this_thread::yield();
@@ -387,7 +697,8 @@ void TaskScheduler::RelaunchThreadsInternal(int32_t n) {
 			auto marker = unique_ptr<atomic<bool>>(new atomic<bool>(true));
 			unique_ptr<thread> worker_thread;
 			try {
-				worker_thread = make_uniq<thread>(ThreadExecuteTasks, this, marker.get());
+				auto &worker_queue = queue->GetWorkerQueue(threads.size());
+				worker_thread = make_uniq<thread>(ThreadExecuteTasks, this, marker.get(), &worker_queue);
 			} catch (std::exception &ex) {
 				// thread constructor failed - this can happen when the system has too many threads allocated
 				// in this case we cannot allocate more threads - stop launching them
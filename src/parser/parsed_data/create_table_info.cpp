@@ -2,6 +2,7 @@
 #include "duckdb/catalog/catalog_entry/schema_catalog_entry.hpp"
 #include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
 #include "duckdb/catalog/catalog.hpp"
+#include "duckdb/parser/keyword_helper.hpp"
 
 namespace duckdb {
 
@@ -26,6 +27,9 @@ unique_ptr<CreateInfo> CreateTableInfo::Copy() const {
 	if (query) {
 		result->query = unique_ptr_cast<SQLStatement, SelectStatement>(query->Copy());
 	}
+	if (view_query) {
+		result->view_query = unique_ptr_cast<SQLStatement, SelectStatement>(view_query->Copy());
+	}
 	return std::move(result);
 }
 
@@ -39,17 +43,30 @@ string CreateTableInfo::ToString() const {
 	if (temporary) {
 		ret += " TEMP";
 	}
-	ret += " TABLE ";
+	ret += view_query ? " MATERIALIZED VIEW " : " TABLE ";
 
 	if (on_conflict == OnCreateConflict::IGNORE_ON_CONFLICT) {
 		ret += " IF NOT EXISTS ";
 	}
 	ret += QualifierToString(temporary ? "" : catalog, schema, table);
 
-	if (query != nullptr) {
+	if (view_query) {
+		ret += " AS " + view_query->ToString() + ";";
+	} else if (query != nullptr) {
 		ret += " AS " + query->ToString();
 	} else {
-		ret += TableCatalogEntry::ColumnsToSQL(columns, constraints) + ";";
+		ret += TableCatalogEntry::ColumnsToSQL(columns, constraints);
+		vector<string> bloom_filter_columns;
+		for (auto &column : columns.Logical()) {
+			if (column.HasBloomFilter()) {
+				bloom_filter_columns.push_back(column.Name());
+			}
+		}
+		if (!bloom_filter_columns.empty()) {
+			auto column_list = StringUtil::Join(bloom_filter_columns, ", ");
+			ret += " WITH (bloom_filter = " + KeywordHelper::WriteQuoted(column_list, '\'') + ")";
+		}
+		ret += ";";
 	}
 	return ret;
 }
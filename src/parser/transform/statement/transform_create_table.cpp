@@ -1,4 +1,5 @@
 #include "duckdb/catalog/catalog_entry/table_column_type.hpp"
+#include "duckdb/common/string_util.hpp"
 #include "duckdb/parser/constraint.hpp"
 #include "duckdb/parser/expression/collate_expression.hpp"
 #include "duckdb/parser/parsed_data/create_table_info.hpp"
@@ -66,6 +67,36 @@ ColumnDefinition Transformer::TransformColumnDefinition(duckdb_libpgquery::PGCol
 	return ColumnDefinition(colname, target_type);
 }
 
+static void TransformTableOptions(ColumnList &columns, optional_ptr<duckdb_libpgquery::PGList> options) {
+	if (!options) {
+		return;
+	}
+	duckdb_libpgquery::PGListCell *cell;
+	for_each_cell(cell, options->head) {
+		auto def_elem = Transformer::PGPointerCast<duckdb_libpgquery::PGDefElem>(cell->data.ptr_value);
+		if (StringUtil::Lower(def_elem->defname) != "bloom_filter") {
+			continue;
+		}
+		// bloom_filter = 'col1, col2': store a bloom filter for the listed columns
+		auto val = Transformer::PGPointerCast<duckdb_libpgquery::PGValue>(def_elem->arg);
+		if (!val || val->type != duckdb_libpgquery::T_PGString) {
+			throw ParserException("Unsupported parameter type for BLOOM_FILTER: expected a list of column names, e.g. "
+			                      "bloom_filter = 'a, b'");
+		}
+		for (auto &column_name : StringUtil::Split(val->val.str, ',')) {
+			StringUtil::Trim(column_name);
+			if (!columns.ColumnExists(column_name)) {
+				throw ParserException("Column \"%s\" in BLOOM_FILTER option does not exist", column_name);
+			}
+			auto &column = columns.GetColumnMutable(column_name);
+			if (column.Generated()) {
+				throw ParserException("Generated column \"%s\" cannot have a bloom filter", column_name);
+			}
+			column.SetBloomFilter(true);
+		}
+	}
+}
+
 unique_ptr<CreateStatement> Transformer::TransformCreateTable(duckdb_libpgquery::PGCreateStmt &stmt) {
 	auto result = make_uniq<CreateStatement>();
 	auto info = make_uniq<CreateTableInfo>();
@@ -123,6 +154,7 @@ unique_ptr<CreateStatement> Transformer::TransformCreateTable(duckdb_libpgquery:
 	if (!column_count) {
 		throw ParserException("Table must have at least one column!");
 	}
+	TransformTableOptions(info->columns, stmt.options);
 
 	result->info = std::move(info);
 	return result;
@@ -5,9 +5,6 @@
 namespace duckdb {
 
 unique_ptr<CreateStatement> Transformer::TransformCreateTableAs(duckdb_libpgquery::PGCreateTableAsStmt &stmt) {
-	if (stmt.relkind == duckdb_libpgquery::PG_OBJECT_MATVIEW) {
-		throw NotImplementedException("Materialized view not implemented");
-	}
 	if (stmt.is_select_into || stmt.into->colNames || stmt.into->options) {
 		throw NotImplementedException("Unimplemented features for CREATE TABLE as");
 	}
@@ -25,6 +22,13 @@ unique_ptr<CreateStatement> Transformer::TransformCreateTableAs(duckdb_libpgquer
 	info->on_conflict = TransformOnConflict(stmt.onconflict);
 	info->temporary =
 	    stmt.into->rel->relpersistence == duckdb_libpgquery::PGPostgresRelPersistence::PG_RELPERSISTENCE_TEMP;
+	if (stmt.relkind == duckdb_libpgquery::PG_OBJECT_MATVIEW) {
+		if (stmt.into->skipData) {
+			throw NotImplementedException("CREATE MATERIALIZED VIEW ... WITH NO DATA is not supported");
+		}
+		// a materialized view is a table that is created from - and kept up to date with - its query
+		info->view_query = unique_ptr_cast<SQLStatement, SelectStatement>(query->Copy());
+	}
 	info->query = std::move(query);
 	result->info = std::move(info);
 	return result;
@@ -1,3 +1,4 @@
+#include "duckdb/common/blocked_bloom_filter.hpp"
 #include "duckdb/parser/constraints/list.hpp"
 #include "duckdb/parser/expression/cast_expression.hpp"
 #include "duckdb/planner/binder.hpp"
@@ -20,6 +21,9 @@
 #include "duckdb/planner/expression_binder/index_binder.hpp"
 #include "duckdb/parser/parsed_data/create_index_info.hpp"
 #include "duckdb/catalog/catalog_entry/schema_catalog_entry.hpp"
+#include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
+#include "duckdb/main/materialized_view.hpp"
+#include "duckdb/parser/tableref/basetableref.hpp"
 
 #include <algorithm>
 
@@ -297,9 +301,76 @@ unique_ptr<BoundCreateTableInfo> Binder::BindCreateTableCheckpoint(unique_ptr<Cr
                                                                    SchemaCatalogEntry &schema) {
 	auto result = make_uniq<BoundCreateTableInfo>(schema, std::move(info));
 	CreateColumnDependencyManager(*result);
+	auto &base = result->Base();
+	if (base.view_query) {
+		// the query of a materialized view is not re-bound - restore the dependencies on the tables it reads from
+		for (auto &table_ref : MaterializedView::GetTableRefs(*base.view_query->node)) {
+			LogicalDependency dependency;
+			dependency.entry.type = CatalogType::TABLE_ENTRY;
+			dependency.entry.schema = table_ref.get().schema_name;
+			dependency.entry.name = table_ref.get().table_name;
+			dependency.catalog = schema.ParentCatalog().GetName();
+			result->dependencies.AddDependency(dependency);
+		}
+	}
 	return result;
 }
 
+static void QualifyMaterializedViewQuery(ClientContext &context, Catalog &catalog, QueryNode &node);
+
+static void QualifyMaterializedViewExpression(ClientContext &context, Catalog &catalog, ParsedExpression &expr) {
+	if (expr.GetExpressionClass() == ExpressionClass::SUBQUERY) {
+		auto &subquery = expr.Cast<SubqueryExpression>();
+		QualifyMaterializedViewQuery(context, catalog, *subquery.subquery->node);
+	}
+	ParsedExpressionIterator::EnumerateChildren(
+	    expr, [&](ParsedExpression &child) { QualifyMaterializedViewExpression(context, catalog, child); });
+}
+
+static void QualifyMaterializedViewTableRef(ClientContext &context, Catalog &catalog, TableRef &ref) {
+	switch (ref.type) {
+	case TableReferenceType::BASE_TABLE: {
+		auto &table_ref = ref.Cast<BaseTableRef>();
+		auto &entry = Catalog::GetEntry(context, CatalogType::TABLE_ENTRY, table_ref.catalog_name,
+		                                table_ref.schema_name, table_ref.table_name);
+		if (entry.type != CatalogType::TABLE_ENTRY) {
+			throw BinderException("Materialized views can only reference tables, \"%s\" is a %s", entry.name,
+			                      CatalogTypeToString(entry.type));
+		}
+		auto &table = entry.Cast<TableCatalogEntry>();
+		if (!table.IsDuckTable() || &table.ParentCatalog() != &catalog) {
+			throw BinderException("Materialized views can only reference tables in the same database, \"%s\" is not",
+			                      table.name);
+		}
+		if (table.IsMaterializedView()) {
+			throw BinderException("Materialized views cannot reference other materialized views");
+		}
+		// the query is re-bound when the view is maintained - fix the tables it refers to
+		table_ref.catalog_name = table.ParentCatalog().GetName();
+		table_ref.schema_name = table.ParentSchema().name;
+		break;
+	}
+	case TableReferenceType::JOIN:
+	case TableReferenceType::SUBQUERY:
+	case TableReferenceType::EXPRESSION_LIST:
+	case TableReferenceType::EMPTY_FROM:
+		break;
+	default:
+		throw BinderException("Materialized views can only read from tables, joins and subqueries");
+	}
+}
+
+//! Verifies that a materialized view can be maintained, and qualifies the tables its query refers to
+static void QualifyMaterializedViewQuery(ClientContext &context, Catalog &catalog, QueryNode &node) {
+	if (!node.cte_map.map.empty() || node.type == QueryNodeType::RECURSIVE_CTE_NODE ||
+	    node.type == QueryNodeType::CTE_NODE) {
+		throw BinderException("Materialized views cannot contain common table expressions");
+	}
+	ParsedExpressionIterator::EnumerateQueryNodeChildren(
+	    node, [&](unique_ptr<ParsedExpression> &child) { QualifyMaterializedViewExpression(context, catalog, *child); },
+	    [&](TableRef &ref) { QualifyMaterializedViewTableRef(context, catalog, ref); });
+}
+
 unique_ptr<BoundCreateTableInfo> Binder::BindCreateTableInfo(unique_ptr<CreateInfo> info, SchemaCatalogEntry &schema,
                                                              vector<unique_ptr<Expression>> &bound_defaults) {
 	auto &base = info->Cast<CreateTableInfo>();
@@ -308,6 +379,16 @@ unique_ptr<BoundCreateTableInfo> Binder::BindCreateTableInfo(unique_ptr<CreateIn
 
 	vector<unique_ptr<BoundConstraint>> bound_constraints;
 	if (base.query) {
+		if (base.view_query) {
+			QualifyMaterializedViewQuery(context, schema.ParentCatalog(), *base.view_query->node);
+			// the view depends on the tables it reads from
+			SetCatalogLookupCallback([&dependencies, &schema](CatalogEntry &entry) {
+				if (&schema.ParentCatalog() != &entry.ParentCatalog()) {
+					return;
+				}
+				dependencies.AddDependency(entry);
+			});
+		}
 		// construct the result object
 		auto query_obj = Bind(*base.query);
 		base.query.reset();
@@ -350,6 +431,10 @@ unique_ptr<BoundCreateTableInfo> Binder::BindCreateTableInfo(unique_ptr<CreateIn
 			ExpressionBinder::TestCollation(context, StringType::GetCollation(column.Type()));
 		}
 		BindLogicalType(column.TypeMutable(), &result->schema.catalog, result->schema.name);
+		if (column.HasBloomFilter() && !BlockedBloomFilter::SupportsType(column.Type())) {
+			throw BinderException("Bloom filters are not supported for column \"%s\" of type %s", column.Name(),
+			                      column.Type().ToString());
+		}
 	}
 	result->dependencies.VerifyDependencies(schema.catalog, result->Base().table);
 
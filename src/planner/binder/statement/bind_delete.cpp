@@ -9,6 +9,7 @@
 #include "duckdb/planner/tableref/bound_basetableref.hpp"
 #include "duckdb/planner/operator/logical_cross_product.hpp"
 #include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
+#include "duckdb/main/client_data.hpp"
 
 namespace duckdb {
 
@@ -27,6 +28,9 @@ BoundStatement Binder::Bind(DeleteStatement &stmt) {
 	auto &get = root->Cast<LogicalGet>();
 	D_ASSERT(root->type == LogicalOperatorType::LOGICAL_GET);
 
+	if (table.IsMaterializedView() && !ClientData::Get(context).maintaining_materialized_views) {
+		throw BinderException("Cannot delete from materialized view \"%s\"", table.name);
+	}
 	if (!table.temporary) {
 		// delete from persistent table: not read only!
 		auto &properties = GetStatementProperties();
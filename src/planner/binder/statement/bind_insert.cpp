@@ -25,6 +25,7 @@
 #include "duckdb/parser/parsed_expression_iterator.hpp"
 #include "duckdb/storage/table_storage_info.hpp"
 #include "duckdb/parser/tableref/basetableref.hpp"
+#include "duckdb/main/client_data.hpp"
 
 namespace duckdb {
 
@@ -468,6 +469,9 @@ BoundStatement Binder::Bind(InsertStatement &stmt) {
 
 	BindSchemaOrCatalog(stmt.catalog, stmt.schema);
 	auto &table = Catalog::GetEntry<TableCatalogEntry>(context, stmt.catalog, stmt.schema, stmt.table);
+	if (table.IsMaterializedView() && !ClientData::Get(context).maintaining_materialized_views) {
+		throw BinderException("Cannot insert into materialized view \"%s\"", table.name);
+	}
 	if (!table.temporary) {
 		// inserting into a non-temporary table: alters underlying database
 		auto &properties = GetStatementProperties();
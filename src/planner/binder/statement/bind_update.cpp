@@ -15,6 +15,7 @@
 #include "duckdb/planner/tableref/bound_basetableref.hpp"
 #include "duckdb/catalog/catalog_entry/duck_table_entry.hpp"
 #include "duckdb/storage/data_table.hpp"
+#include "duckdb/main/client_data.hpp"
 
 #include <algorithm>
 
@@ -94,6 +95,9 @@ BoundStatement Binder::Bind(UpdateStatement &stmt) {
 		get = &root->Cast<LogicalGet>();
 	}
 
+	if (table.IsMaterializedView() && !ClientData::Get(context).maintaining_materialized_views) {
+		throw BinderException("Cannot update materialized view \"%s\"", table.name);
+	}
 	if (!table.temporary) {
 		// update of persistent table: not read only!
 		auto &properties = GetStatementProperties();
@@ -0,0 +1,69 @@
+#include "duckdb/planner/filter/bloom_filter.hpp"
+
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
+#include "duckdb/storage/statistics/base_statistics.hpp"
+
+namespace duckdb {
+
+BloomFilter::BloomFilter(shared_ptr<BlockedBloomFilter> filter_p)
+    : TableFilter(TableFilterType::BLOOM_FILTER), filter(std::move(filter_p)) {
+}
+
+idx_t BloomFilter::Filter(Vector &vector, UnifiedVectorFormat &vdata, SelectionVector &sel,
+                          idx_t &approved_tuple_count) const {
+	if (approved_tuple_count == 0) {
+		return 0;
+	}
+	Vector hashes(LogicalType::HASH);
+	VectorOperations::Hash(vector, hashes, sel, approved_tuple_count);
+
+	SelectionVector new_sel(approved_tuple_count);
+	auto result_count = filter->Lookup(hashes, sel, approved_tuple_count, new_sel);
+	if (!vdata.validity.AllValid()) {
+		// NULL values never match - remove them from the result
+		idx_t valid_count = 0;
+		for (idx_t i = 0; i < result_count; i++) {
+			auto idx = new_sel.get_index(i);
+			new_sel.set_index(valid_count, idx);
+			valid_count += vdata.validity.RowIsValid(vdata.sel->get_index(idx));
+		}
+		result_count = valid_count;
+	}
+	sel.Initialize(new_sel);
+	approved_tuple_count = result_count;
+	return approved_tuple_count;
+}
+
+FilterPropagateResult BloomFilter::CheckStatistics(BaseStatistics &stats) {
+	if (!stats.CanHaveNoNull()) {
+		// only NULL values: nothing can match
+		return FilterPropagateResult::FILTER_ALWAYS_FALSE;
+	}
+	// the bloom filter does not store a range - we cannot prune based on min/max
+	return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+}
+
+string BloomFilter::ToString(const string &column_name) {
+	return column_name + " IN BLOOM_FILTER(" + to_string(filter->SizeInBytes()) + " bytes)";
+}
+
+bool BloomFilter::Equals(const TableFilter &other_p) const {
+	if (!TableFilter::Equals(other_p)) {
+		return false;
+	}
+	auto &other = other_p.Cast<BloomFilter>();
+	return other.filter.get() == filter.get();
+}
+
+unique_ptr<TableFilter> BloomFilter::Copy() const {
+	return make_uniq<BloomFilter>(filter);
+}
+
+unique_ptr<Expression> BloomFilter::ToExpression(const Expression &column) const {
+	// a bloom filter is approximate and is only used to eliminate rows early - the join still checks every row
+	// when converted back into an expression we can therefore just let every row through
+	return make_uniq<BoundConstantExpression>(Value::BOOLEAN(true));
+}
+
+} // namespace duckdb
@@ -0,0 +1,102 @@
+#include "duckdb/planner/filter/dynamic_filter.hpp"
+
+#include "duckdb/common/value_operations/value_operations.hpp"
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
+
+namespace duckdb {
+
+DynamicFilterData::DynamicFilterData(ExpressionType comparison_type)
+    : comparison_type(comparison_type), initialized(false) {
+}
+
+void DynamicFilterData::SetValue(const Value &value) {
+	if (value.IsNull()) {
+		return;
+	}
+	lock_guard<mutex> guard(lock);
+	if (initialized) {
+		auto &current = filter->constant;
+		bool is_tighter;
+		switch (comparison_type) {
+		case ExpressionType::COMPARE_LESSTHAN:
+		case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+			is_tighter = ValueOperations::LessThan(value, current);
+			break;
+		case ExpressionType::COMPARE_GREATERTHAN:
+		case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+			is_tighter = ValueOperations::GreaterThan(value, current);
+			break;
+		default:
+			throw InternalException("Unsupported comparison type for dynamic filter");
+		}
+		if (!is_tighter) {
+			return;
+		}
+	}
+	filter = make_uniq<ConstantFilter>(comparison_type, value);
+	initialized = true;
+}
+
+void DynamicFilterData::Reset() {
+	lock_guard<mutex> guard(lock);
+	filter.reset();
+	initialized = false;
+}
+
+DynamicFilter::DynamicFilter() : TableFilter(TableFilterType::DYNAMIC_FILTER) {
+}
+
+DynamicFilter::DynamicFilter(shared_ptr<DynamicFilterData> filter_data_p)
+    : TableFilter(TableFilterType::DYNAMIC_FILTER), filter_data(std::move(filter_data_p)) {
+}
+
+unique_ptr<TableFilter> DynamicFilter::GetFilter() const {
+	if (!filter_data) {
+		return nullptr;
+	}
+	lock_guard<mutex> guard(filter_data->lock);
+	if (!filter_data->initialized) {
+		return nullptr;
+	}
+	return filter_data->filter->Copy();
+}
+
+FilterPropagateResult DynamicFilter::CheckStatistics(BaseStatistics &stats) {
+	if (!filter_data) {
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	lock_guard<mutex> guard(filter_data->lock);
+	if (!filter_data->initialized) {
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	return filter_data->filter->CheckStatistics(stats);
+}
+
+string DynamicFilter::ToString(const string &column_name) {
+	if (filter_data) {
+		lock_guard<mutex> guard(filter_data->lock);
+		if (filter_data->initialized) {
+			return "Dynamic Filter (" + filter_data->filter->ToString(column_name) + ")";
+		}
+	}
+	return "Dynamic Filter (" + column_name + ")";
+}
+
+bool DynamicFilter::Equals(const TableFilter &other_p) const {
+	if (!TableFilter::Equals(other_p)) {
+		return false;
+	}
+	auto &other = other_p.Cast<DynamicFilter>();
+	return other.filter_data.get() == filter_data.get();
+}
+
+unique_ptr<TableFilter> DynamicFilter::Copy() const {
+	return make_uniq<DynamicFilter>(filter_data);
+}
+
+unique_ptr<Expression> DynamicFilter::ToExpression(const Expression &column) const {
+	// the filter only prunes rows that cannot qualify anyway - it is always safe to not apply it
+	return make_uniq<BoundConstantExpression>(Value::BOOLEAN(true));
+}
+
+} // namespace duckdb
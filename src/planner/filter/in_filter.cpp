@@ -0,0 +1,244 @@
+#include "duckdb/planner/filter/in_filter.hpp"
+
+#include "duckdb/common/algorithm.hpp"
+#include "duckdb/common/operator/comparison_operators.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
+#include "duckdb/planner/expression/bound_operator_expression.hpp"
+#include "duckdb/storage/statistics/base_statistics.hpp"
+
+namespace duckdb {
+
+//! Open-addressing hash set over the values of an InFilter
+struct InFilterLookup {
+	explicit InFilterLookup(const vector<Value> &values);
+
+	//! The values of the filter
+	Vector values;
+	//! The slots of the hash set, containing an index into "values" (or INVALID_INDEX for an empty slot)
+	vector<idx_t> slots;
+	//! Mask used to compute the slot of a hash
+	hash_t mask;
+};
+
+InFilterLookup::InFilterLookup(const vector<Value> &values_p)
+    : values(values_p[0].type(), values_p.size()),
+      slots(NextPowerOfTwo(values_p.size() * 2), DConstants::INVALID_INDEX), mask(slots.size() - 1) {
+	for (idx_t i = 0; i < values_p.size(); i++) {
+		values.SetValue(i, values_p[i]);
+	}
+	Vector hashes(LogicalType::HASH, values_p.size());
+	VectorOperations::Hash(values, hashes, values_p.size());
+	auto hash_data = FlatVector::GetData<hash_t>(hashes);
+	for (idx_t i = 0; i < values_p.size(); i++) {
+		auto slot = hash_data[i] & mask;
+		while (slots[slot] != DConstants::INVALID_INDEX) {
+			slot = (slot + 1) & mask;
+		}
+		slots[slot] = i;
+	}
+}
+
+template <class T>
+static idx_t TemplatedInFilterSelection(const InFilterLookup &lookup, UnifiedVectorFormat &vdata, const hash_t *hashes,
+                                        const SelectionVector &sel, idx_t count, SelectionVector &result_sel) {
+	auto data = UnifiedVectorFormat::GetData<T>(vdata);
+	auto values = FlatVector::GetData<T>(lookup.values);
+	idx_t result_count = 0;
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = sel.get_index(i);
+		auto vector_idx = vdata.sel->get_index(idx);
+		if (!vdata.validity.RowIsValid(vector_idx)) {
+			continue;
+		}
+		bool found = false;
+		for (auto slot = hashes[idx] & lookup.mask; lookup.slots[slot] != DConstants::INVALID_INDEX;
+		     slot = (slot + 1) & lookup.mask) {
+			if (Equals::Operation(data[vector_idx], values[lookup.slots[slot]])) {
+				found = true;
+				break;
+			}
+		}
+		result_sel.set_index(result_count, idx);
+		result_count += found;
+	}
+	return result_count;
+}
+
+static vector<Value> SortValues(vector<Value> values) {
+	std::sort(values.begin(), values.end());
+	values.erase(std::unique(values.begin(), values.end()), values.end());
+	return values;
+}
+
+InFilter::InFilter(vector<Value> values_p) : InFilter(SortValues(std::move(values_p)), nullptr) {
+}
+
+InFilter::InFilter(vector<Value> values_p, shared_ptr<InFilterLookup> lookup_p)
+    : TableFilter(TableFilterType::IN_FILTER), values(std::move(values_p)), lookup(std::move(lookup_p)) {
+	if (values.empty()) {
+		throw InternalException("InFilter requires at least one value");
+	}
+	for (auto &value : values) {
+		if (value.IsNull()) {
+			throw InternalException("InFilter values cannot be NULL");
+		}
+	}
+	if (!lookup) {
+		lookup = make_shared_ptr<InFilterLookup>(values);
+	}
+}
+
+idx_t InFilter::Filter(Vector &vector, UnifiedVectorFormat &vdata, SelectionVector &sel,
+                       idx_t &approved_tuple_count) const {
+	if (approved_tuple_count == 0) {
+		return 0;
+	}
+	Vector hashes(LogicalType::HASH);
+	VectorOperations::Hash(vector, hashes, sel, approved_tuple_count);
+	hashes.Flatten(STANDARD_VECTOR_SIZE);
+	auto hash_data = FlatVector::GetData<hash_t>(hashes);
+
+	SelectionVector new_sel(approved_tuple_count);
+	idx_t result_count;
+	switch (vector.GetType().InternalType()) {
+	case PhysicalType::BOOL:
+	case PhysicalType::INT8:
+		result_count =
+		    TemplatedInFilterSelection<int8_t>(*lookup, vdata, hash_data, sel, approved_tuple_count, new_sel);
+		break;
+	case PhysicalType::INT16:
+		result_count =
+		    TemplatedInFilterSelection<int16_t>(*lookup, vdata, hash_data, sel, approved_tuple_count, new_sel);
+		break;
+	case PhysicalType::INT32:
+		result_count =
+		    TemplatedInFilterSelection<int32_t>(*lookup, vdata, hash_data, sel, approved_tuple_count, new_sel);
+		break;
+	case PhysicalType::INT64:
+		result_count =
+		    TemplatedInFilterSelection<int64_t>(*lookup, vdata, hash_data, sel, approved_tuple_count, new_sel);
+		break;
+	case PhysicalType::INT128:
+		result_count =
+		    TemplatedInFilterSelection<hugeint_t>(*lookup, vdata, hash_data, sel, approved_tuple_count, new_sel);
+		break;
+	case PhysicalType::UINT8:
+		result_count =
+		    TemplatedInFilterSelection<uint8_t>(*lookup, vdata, hash_data, sel, approved_tuple_count, new_sel);
+		break;
+	case PhysicalType::UINT16:
+		result_count =
+		    TemplatedInFilterSelection<uint16_t>(*lookup, vdata, hash_data, sel, approved_tuple_count, new_sel);
+		break;
+	case PhysicalType::UINT32:
+		result_count =
+		    TemplatedInFilterSelection<uint32_t>(*lookup, vdata, hash_data, sel, approved_tuple_count, new_sel);
+		break;
+	case PhysicalType::UINT64:
+		result_count =
+		    TemplatedInFilterSelection<uint64_t>(*lookup, vdata, hash_data, sel, approved_tuple_count, new_sel);
+		break;
+	case PhysicalType::UINT128:
+		result_count =
+		    TemplatedInFilterSelection<uhugeint_t>(*lookup, vdata, hash_data, sel, approved_tuple_count, new_sel);
+		break;
+	case PhysicalType::FLOAT:
+		result_count =
+		    TemplatedInFilterSelection<float>(*lookup, vdata, hash_data, sel, approved_tuple_count, new_sel);
+		break;
+	case PhysicalType::DOUBLE:
+		result_count =
+		    TemplatedInFilterSelection<double>(*lookup, vdata, hash_data, sel, approved_tuple_count, new_sel);
+		break;
+	case PhysicalType::VARCHAR:
+		result_count =
+		    TemplatedInFilterSelection<string_t>(*lookup, vdata, hash_data, sel, approved_tuple_count, new_sel);
+		break;
+	default:
+		throw InvalidTypeException(vector.GetType(), "Invalid type for IN filter pushed down to table");
+	}
+	sel.Initialize(new_sel);
+	approved_tuple_count = result_count;
+	return approved_tuple_count;
+}
+
+FilterPropagateResult InFilter::CheckStatistics(BaseStatistics &stats) {
+	D_ASSERT(values[0].type().id() == stats.GetType().id());
+	if (!stats.CanHaveNoNull()) {
+		// only NULL values: nothing can match
+		return FilterPropagateResult::FILTER_ALWAYS_FALSE;
+	}
+	switch (values[0].type().InternalType()) {
+	case PhysicalType::UINT8:
+	case PhysicalType::UINT16:
+	case PhysicalType::UINT32:
+	case PhysicalType::UINT64:
+	case PhysicalType::UINT128:
+	case PhysicalType::INT8:
+	case PhysicalType::INT16:
+	case PhysicalType::INT32:
+	case PhysicalType::INT64:
+	case PhysicalType::INT128:
+	case PhysicalType::FLOAT:
+	case PhysicalType::DOUBLE: {
+		if (!NumericStats::HasMinMax(stats)) {
+			return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+		}
+		// the values are sorted - find the first value that is >= min, and check if it is <= max
+		auto min_value = NumericStats::Min(stats);
+		auto entry = std::lower_bound(values.begin(), values.end(), min_value);
+		if (entry == values.end() || NumericStats::Max(stats) < *entry) {
+			return FilterPropagateResult::FILTER_ALWAYS_FALSE;
+		}
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	case PhysicalType::VARCHAR: {
+		// string statistics only store a prefix of the min/max - check the values one-by-one
+		for (auto &value : values) {
+			auto prune_result =
+			    StringStats::CheckZonemap(stats, ExpressionType::COMPARE_EQUAL, StringValue::Get(value));
+			if (prune_result != FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+				return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+			}
+		}
+		return FilterPropagateResult::FILTER_ALWAYS_FALSE;
+	}
+	default:
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+}
+
+string InFilter::ToString(const string &column_name) {
+	string in_list;
+	for (auto &value : values) {
+		if (!in_list.empty()) {
+			in_list += ", ";
+		}
+		in_list += value.ToSQLString();
+	}
+	return column_name + " IN (" + in_list + ")";
+}
+
+bool InFilter::Equals(const TableFilter &other_p) const {
+	if (!TableFilter::Equals(other_p)) {
+		return false;
+	}
+	auto &other = other_p.Cast<InFilter>();
+	return other.values == values;
+}
+
+unique_ptr<TableFilter> InFilter::Copy() const {
+	return unique_ptr<TableFilter>(new InFilter(values, lookup));
+}
+
+unique_ptr<Expression> InFilter::ToExpression(const Expression &column) const {
+	auto result = make_uniq<BoundOperatorExpression>(ExpressionType::COMPARE_IN, LogicalType::BOOLEAN);
+	result->children.push_back(column.Copy());
+	for (auto &value : values) {
+		result->children.push_back(make_uniq<BoundConstantExpression>(value));
+	}
+	return std::move(result);
+}
+
+} // namespace duckdb
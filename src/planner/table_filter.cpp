@@ -62,11 +62,11 @@ DynamicTableFilterSet::GetFinalTableFilters(const PhysicalTableScan &scan,
 	}
 	for (auto &entry : filters) {
 		for (auto &filter : entry.second->filters) {
-			if (IsRowIdColumnId(scan.column_ids[filter.first])) {
+			if (IsRowIdColumnId(scan.column_ids[filter.first]) && !scan.function.row_id_filter_pushdown) {
 				// skip row id filters
 				continue;
 			}
-			result->filters[filter.first] = filter.second->Copy();
+			result->PushFilter(filter.first, filter.second->Copy());
 		}
 	}
 	if (result->filters.empty()) {
@@ -93,6 +93,12 @@ MetadataManager &BlockManager::GetMetadataManager() {
 	return *metadata_manager;
 }
 
+void BlockManager::ReadBlocks(const vector<BlockReadRange> &ranges) {
+	for (auto &range : ranges) {
+		ReadBlocks(range.buffer.get(), range.start_block, range.block_count);
+	}
+}
+
 void BlockManager::Truncate() {
 }
 
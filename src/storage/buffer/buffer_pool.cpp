@@ -199,17 +199,23 @@ BufferPool::BufferPool(idx_t maximum_memory, bool track_eviction_timestamps,
     : maximum_memory(maximum_memory),
       allocator_bulk_deallocation_flush_threshold(allocator_bulk_deallocation_flush_threshold),
       track_eviction_timestamps(track_eviction_timestamps),
-      temporary_memory_manager(make_uniq<TemporaryMemoryManager>()) {
-	queues.reserve(FILE_BUFFER_TYPE_COUNT);
-	for (idx_t i = 0; i < FILE_BUFFER_TYPE_COUNT; i++) {
+      eviction_policy(BufferEvictionPolicy::LRU), temporary_memory_manager(make_uniq<TemporaryMemoryManager>()) {
+	queues.reserve(FILE_BUFFER_TYPE_COUNT + 1);
+	for (idx_t i = 0; i < FILE_BUFFER_TYPE_COUNT + 1; i++) {
 		queues.push_back(make_uniq<EvictionQueue>());
 	}
+	for (idx_t i = 0; i < MEMORY_TAG_COUNT; i++) {
+		buffer_hits[i] = 0;
+		buffer_misses[i] = 0;
+		buffer_evictions[i] = 0;
+	}
 }
 BufferPool::~BufferPool() {
 }
 
 bool BufferPool::AddToEvictionQueue(shared_ptr<BlockHandle> &handle) {
-	auto &queue = GetEvictionQueueForType(handle->buffer->type);
+	auto queue_idx = GetEvictionQueueIndex(*handle);
+	auto &queue = *queues[queue_idx];
 
 	// The block handle is locked during this operation (Unpin),
 	// or the block handle is still a local variable (ConvertToPersistent)
@@ -224,8 +230,10 @@ bool BufferPool::AddToEvictionQueue(shared_ptr<BlockHandle> &handle) {
 
 	if (ts != 1) {
 		// we add a newer version, i.e., we kill exactly one previous version
-		queue.IncrementDeadNodes();
+		// the previous version can be in a different queue, e.g., if the block was promoted from the probation queue
+		IncrementDeadNodes(*handle);
 	}
+	handle->eviction_queue_idx = queue_idx;
 
 	// Get the eviction queue for the buffer type and add it
 	return queue.AddToEvictionQueue(BufferEvictionNode(weak_ptr<BlockHandle>(handle), ts));
@@ -235,8 +243,46 @@ EvictionQueue &BufferPool::GetEvictionQueueForType(FileBufferType type) {
 	return *queues[uint8_t(type) - 1];
 }
 
-void BufferPool::IncrementDeadNodes(FileBufferType type) {
-	GetEvictionQueueForType(type).IncrementDeadNodes();
+idx_t BufferPool::GetEvictionQueueIndex(BlockHandle &handle) const {
+	if (handle.probationary && eviction_policy == BufferEvictionPolicy::SCAN_RESISTANT) {
+		return PROBATION_QUEUE_INDEX;
+	}
+	return uint8_t(handle.buffer->type) - 1;
+}
+
+void BufferPool::IncrementDeadNodes(BlockHandle &handle) {
+	auto queue_idx = handle.eviction_queue_idx;
+	if (queue_idx == DConstants::INVALID_INDEX) {
+		queue_idx = uint8_t(handle.buffer->type) - 1;
+	}
+	queues[queue_idx]->IncrementDeadNodes();
+}
+
+void BufferPool::RegisterBlockHit(BlockHandle &handle) {
+	if (handle.block_id >= MAXIMUM_BLOCK) {
+		return;
+	}
+	buffer_hits[uint8_t(handle.tag)]++;
+	handle.scan_hint = false;
+	if (handle.prefetched) {
+		// this is the pin that the prefetch was done for - it does not count as a reuse of the block
+		handle.prefetched = false;
+	} else if (handle.readers == 0) {
+		// the block is used again after it was released: it is no longer a candidate for early eviction
+		// we do not promote blocks that are pinned concurrently, e.g., by adjacent segments of the same scan
+		handle.probationary = false;
+	}
+}
+
+void BufferPool::RegisterBlockLoad(BlockHandle &handle, bool prefetch) {
+	if (handle.block_id >= MAXIMUM_BLOCK) {
+		return;
+	}
+	buffer_misses[uint8_t(handle.tag)]++;
+	// blocks are only prefetched by scans
+	auto scan_hint = handle.scan_hint.exchange(false);
+	handle.probationary = prefetch || scan_hint;
+	handle.prefetched = prefetch;
 }
 
 void BufferPool::UpdateUsedMemory(MemoryTag tag, int64_t size) {
@@ -261,7 +307,15 @@ TemporaryMemoryManager &BufferPool::GetTemporaryMemoryManager() {
 
 BufferPool::EvictionResult BufferPool::EvictBlocks(MemoryTag tag, idx_t extra_memory, idx_t memory_limit,
                                                    unique_ptr<FileBuffer> *buffer) {
-	// First, we try to evict persistent table data
+	// First, we try to evict persistent table data that was loaded by a scan and not used since
+	// this queue is only filled with the scan-resistant eviction policy
+	auto probation_result =
+	    EvictBlocksInternal(*queues[PROBATION_QUEUE_INDEX], tag, extra_memory, memory_limit, buffer);
+	if (probation_result.success) {
+		return probation_result;
+	}
+
+	// Then, we try to evict the remaining persistent table data
 	auto block_result =
 	    EvictBlocksInternal(GetEvictionQueueForType(FileBufferType::BLOCK), tag, extra_memory, memory_limit, buffer);
 	if (block_result.success) {
@@ -294,6 +348,9 @@ BufferPool::EvictionResult BufferPool::EvictBlocksInternal(EvictionQueue &queue,
 
 	queue.IterateUnloadableBlocks([&](BufferEvictionNode &, const shared_ptr<BlockHandle> &handle) {
 		// hooray, we can unload the block
+		if (handle->block_id < MAXIMUM_BLOCK) {
+			buffer_evictions[uint8_t(handle->tag)]++;
+		}
 		if (buffer && handle->buffer->AllocSize() == extra_memory) {
 			// we can re-use the memory directly
 			*buffer = handle->UnloadAndTakeBlock();
@@ -383,6 +440,9 @@ void EvictionQueue::IterateUnloadableBlocks(FN fn) {
 
 void BufferPool::PurgeQueue(FileBufferType type) {
 	GetEvictionQueueForType(type).Purge();
+	if (type == FileBufferType::BLOCK) {
+		queues[PROBATION_QUEUE_INDEX]->Purge();
+	}
 }
 
 void BufferPool::SetLimit(idx_t limit, const char *exception_postscript) {
@@ -413,6 +473,20 @@ void BufferPool::SetAllocatorBulkDeallocationFlushThreshold(idx_t threshold) {
 	allocator_bulk_deallocation_flush_threshold = threshold;
 }
 
+void BufferPool::SetEvictionPolicy(BufferEvictionPolicy policy) {
+	// blocks that are in the probation queue stay there until they are used again or evicted
+	eviction_policy = policy;
+	for (idx_t i = 0; i < MEMORY_TAG_COUNT; i++) {
+		buffer_hits[i] = 0;
+		buffer_misses[i] = 0;
+		buffer_evictions[i] = 0;
+	}
+}
+
+BufferEvictionPolicy BufferPool::GetEvictionPolicy() const {
+	return eviction_policy;
+}
+
 BufferPool::MemoryUsage::MemoryUsage() {
 	for (auto &v : memory_usage) {
 		v = 0;
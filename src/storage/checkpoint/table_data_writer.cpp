@@ -17,6 +17,10 @@ TableDataWriter::TableDataWriter(TableCatalogEntry &table_p) : table(table_p.Cas
 TableDataWriter::~TableDataWriter() {
 }
 
+void TableDataWriter::ScheduleTableData(TaskExecutor &executor) {
+	table.GetStorage().ScheduleCheckpoint(*this, executor);
+}
+
 void TableDataWriter::WriteTableData(Serializer &metadata_serializer) {
 	// start scanning the table and append the data to the uncompressed segments
 	table.GetStorage().Checkpoint(*this, metadata_serializer);
@@ -40,12 +44,16 @@ DatabaseInstance &TableDataWriter::GetDatabase() {
 
 SingleFileTableDataWriter::SingleFileTableDataWriter(SingleFileCheckpointWriter &checkpoint_manager,
                                                      TableCatalogEntry &table, MetadataWriter &table_data_writer)
-    : TableDataWriter(table), checkpoint_manager(checkpoint_manager), table_data_writer(table_data_writer) {
+    : TableDataWriter(table), checkpoint_manager(checkpoint_manager), table_data_writer(table_data_writer),
+      partial_block_manager(checkpoint_manager.GetBlockManager(), PartialBlockType::FULL_CHECKPOINT) {
 }
 
 unique_ptr<RowGroupWriter> SingleFileTableDataWriter::GetRowGroupWriter(RowGroup &row_group) {
-	return make_uniq<SingleFileRowGroupWriter>(table, checkpoint_manager.partial_block_manager, *this,
-	                                           table_data_writer);
+	return make_uniq<SingleFileRowGroupWriter>(table, partial_block_manager, *this, table_data_writer);
+}
+
+void SingleFileTableDataWriter::FlushPartialBlocks() {
+	partial_block_manager.FlushPartialBlocks();
 }
 
 CheckpointType SingleFileTableDataWriter::GetCheckpointType() const {
@@ -18,6 +18,8 @@
 #include "duckdb/main/config.hpp"
 #include "duckdb/main/connection.hpp"
 #include "duckdb/main/database.hpp"
+#include "duckdb/parallel/task_executor.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/parser/parsed_data/create_schema_info.hpp"
 #include "duckdb/parser/parsed_data/create_view_info.hpp"
 #include "duckdb/planner/binder.hpp"
@@ -37,8 +39,10 @@ void ReorderTableEntries(catalog_entry_vector_t &tables);
 
 SingleFileCheckpointWriter::SingleFileCheckpointWriter(AttachedDatabase &db, BlockManager &block_manager,
                                                        CheckpointType checkpoint_type)
-    : CheckpointWriter(db), partial_block_manager(block_manager, PartialBlockType::FULL_CHECKPOINT),
-      checkpoint_type(checkpoint_type) {
+    : CheckpointWriter(db), checkpoint_type(checkpoint_type) {
+}
+
+SingleFileCheckpointWriter::~SingleFileCheckpointWriter() {
 }
 
 BlockManager &SingleFileCheckpointWriter::GetBlockManager() {
@@ -170,6 +174,9 @@ void SingleFileCheckpointWriter::CreateCheckpoint() {
 	    }
 	 */
 	auto catalog_entries = GetCatalogEntries(schemas);
+	// write the row groups of all tables in parallel - only the metadata is written serially below
+	WriteTableData(catalog_entries);
+
 	SerializationOptions serialization_options;
 
 	serialization_options.serialization_compatibility = config.options.serialization_compatibility;
@@ -518,18 +525,75 @@ void CheckpointReader::ReadTableMacro(CatalogTransaction transaction, Deserializ
 //===--------------------------------------------------------------------===//
 // Table Metadata
 //===--------------------------------------------------------------------===//
+class FlushPartialBlocksTask : public BaseExecutorTask {
+public:
+	FlushPartialBlocksTask(TaskExecutor &executor, TableDataWriter &writer)
+	    : BaseExecutorTask(executor), writer(writer) {
+	}
+
+	void ExecuteTask() override {
+		writer.FlushPartialBlocks();
+	}
+
+private:
+	TableDataWriter &writer;
+};
+
+bool SingleFileCheckpointWriter::WriteTableData(catalog_entry_vector_t &catalog_entries) {
+	// obtain the checkpoint locks of all tables first
+	// we cannot wait for a lock while holding the locks of other tables, as that could deadlock with transactions
+	// that are appending to multiple tables - if any of the locks is not available we write the tables one-by-one
+	for (auto &entry_ref : catalog_entries) {
+		auto &entry = entry_ref.get();
+		if (entry.type != CatalogType::TABLE_ENTRY) {
+			continue;
+		}
+		auto &table = entry.Cast<TableCatalogEntry>();
+		PendingTableData pending_table;
+		pending_table.checkpoint_lock = table.GetStorage().TryGetCheckpointLock();
+		if (!pending_table.checkpoint_lock) {
+			pending_tables.clear();
+			return false;
+		}
+		pending_tables.emplace(table, std::move(pending_table));
+	}
+	TaskExecutor executor(TaskScheduler::GetScheduler(db.GetDatabase()));
+	for (auto &entry : pending_tables) {
+		auto &pending_table = entry.second;
+		pending_table.writer = GetTableDataWriter(entry.first.get());
+		pending_table.writer->ScheduleTableData(executor);
+	}
+	executor.WorkOnTasks();
+
+	// all row groups have been written - flush the partially filled blocks
+	for (auto &entry : pending_tables) {
+		executor.ScheduleTask(make_uniq<FlushPartialBlocksTask>(executor, *entry.second.writer));
+	}
+	executor.WorkOnTasks();
+	return true;
+}
+
 void SingleFileCheckpointWriter::WriteTable(TableCatalogEntry &table, Serializer &serializer) {
 	// Write the table metadata
 	serializer.WriteProperty(100, "table", &table);
 
+	auto entry = pending_tables.find(table);
+	if (entry != pending_tables.end()) {
+		// the row groups have already been written - only write the metadata
+		auto pending_table = std::move(entry->second);
+		pending_tables.erase(entry);
+		pending_table.writer->WriteTableData(serializer);
+		return;
+	}
+
 	// Write the table data
 	auto table_lock = table.GetStorage().GetCheckpointLock();
 	if (auto writer = GetTableDataWriter(table)) {
 		writer->WriteTableData(serializer);
+		// flush any partial blocks BEFORE releasing the table lock
+		// flushing partial blocks updates where data lives and is not thread-safe
+		writer->FlushPartialBlocks();
 	}
-	// flush any partial blocks BEFORE releasing the table lock
-	// flushing partial blocks updates where data lives and is not thread-safe
-	partial_block_manager.FlushPartialBlocks();
 }
 
 void CheckpointReader::ReadTable(CatalogTransaction transaction, Deserializer &deserializer) {
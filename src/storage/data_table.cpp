@@ -32,7 +32,8 @@ namespace duckdb {
 
 DataTableInfo::DataTableInfo(AttachedDatabase &db, shared_ptr<TableIOManager> table_io_manager_p, string schema,
                              string table)
-    : db(db), table_io_manager(std::move(table_io_manager_p)), schema(std::move(schema)), table(std::move(table)) {
+    : db(db), table_io_manager(std::move(table_io_manager_p)), schema(std::move(schema)), table(std::move(table)),
+      last_commit_id(0) {
 }
 
 void DataTableInfo::InitializeIndexes(ClientContext &context, const char *index_type) {
@@ -1420,6 +1421,14 @@ unique_ptr<StorageLockKey> DataTable::GetCheckpointLock() {
 	return info->checkpoint_lock.GetExclusiveLock();
 }
 
+unique_ptr<StorageLockKey> DataTable::TryGetCheckpointLock() {
+	return info->checkpoint_lock.TryGetExclusiveLock();
+}
+
+void DataTable::ScheduleCheckpoint(TableDataWriter &writer, TaskExecutor &executor) {
+	row_groups->ScheduleCheckpoint(writer, executor);
+}
+
 void DataTable::Checkpoint(TableDataWriter &writer, Serializer &serializer) {
 	// checkpoint each individual row group
 	TableStatistics global_stats;
@@ -296,9 +296,8 @@ void MetadataManager::ClearModifiedBlocks(const vector<MetaBlockPointer> &pointe
 			throw InternalException("ClearModifiedBlocks - Block id %llu not found in modified_blocks", block_id);
 		}
 		auto &modified_list = entry->second;
-		// verify the block has been modified
-		D_ASSERT(modified_list && (1ULL << block_index));
-		// unset the bit
+		// unset the bit - note that a block can be cleared multiple times, as the data of different unchanged row
+		// groups can share a block
 		modified_list &= ~(1ULL << block_index);
 	}
 }
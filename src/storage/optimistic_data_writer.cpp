@@ -57,11 +57,13 @@ void OptimisticDataWriter::WriteLastRowGroup(RowGroupCollection &row_groups) {
 void OptimisticDataWriter::FlushToDisk(RowGroup &row_group) {
 	//! The set of column compression types (if any)
 	vector<CompressionType> compression_types;
+	vector<bool> bloom_filters;
 	D_ASSERT(compression_types.empty());
 	for (auto &column : table.Columns()) {
 		compression_types.push_back(column.CompressionType());
+		bloom_filters.push_back(column.HasBloomFilter());
 	}
-	RowGroupWriteInfo info(*partial_manager, compression_types);
+	RowGroupWriteInfo info(*partial_manager, compression_types, bloom_filters);
 	row_group.WriteToDisk(info);
 }
 
@@ -531,7 +531,32 @@ void SingleFileBlockManager::ReadBlocks(FileBuffer &buffer, block_id_t start_blo
 	auto location = GetBlockLocation(start_block);
 	buffer.Read(*handle, location);
 
+	VerifyBlockChecksums(buffer, start_block, block_count);
+}
+
+void SingleFileBlockManager::ReadBlocks(const vector<BlockReadRange> &ranges) {
+	// submit the reads of all ranges at once
+	vector<FileReadRequest> requests;
+	for (auto &range : ranges) {
+		D_ASSERT(range.start_block >= 0);
+		D_ASSERT(range.block_count >= 1);
+		auto &buffer = range.buffer.get();
+		requests.emplace_back(buffer.InternalBuffer(), buffer.AllocSize(), GetBlockLocation(range.start_block));
+	}
+	handle->ReadBatch(std::move(requests));
+
+	for (auto &range : ranges) {
+		VerifyBlockChecksums(range.buffer.get(), range.start_block, range.block_count);
+	}
+}
+
+bool SingleFileBlockManager::SupportsAsyncReads() {
+	return handle->SupportsAsyncReads();
+}
+
+void SingleFileBlockManager::VerifyBlockChecksums(FileBuffer &buffer, block_id_t start_block, idx_t block_count) {
 	// for each of the blocks - verify the checksum
+	auto location = GetBlockLocation(start_block);
 	auto ptr = buffer.InternalBuffer();
 	for (idx_t i = 0; i < block_count; i++) {
 		// compute the checksum
@@ -1,5 +1,6 @@
 #include "duckdb/storage/standard_buffer_manager.hpp"
 
+#include "duckdb/common/algorithm.hpp"
 #include "duckdb/common/allocator.hpp"
 #include "duckdb/common/enums/memory_tag.hpp"
 #include "duckdb/common/exception.hpp"
@@ -206,26 +207,12 @@ void StandardBufferManager::ReAllocate(shared_ptr<BlockHandle> &handle, idx_t bl
 }
 
 void StandardBufferManager::BatchRead(vector<shared_ptr<BlockHandle>> &handles, const map<block_id_t, idx_t> &load_map,
-                                      block_id_t first_block, block_id_t last_block) {
+                                      const BlockReadRange &range) {
 	auto &block_manager = handles[0]->block_manager;
-	idx_t block_count = NumericCast<idx_t>(last_block - first_block + 1);
-#ifndef DUCKDB_ALTERNATIVE_VERIFY
-	if (block_count == 1) {
-		// prefetching with block_count == 1 has no performance impact since we can't batch reads
-		// skip the prefetch in this case
-		// we do it anyway if alternative_verify is on for extra testing
-		return;
-	}
-#endif
-
-	// allocate a buffer to hold the data of all of the blocks
-	auto intermediate_buffer = Allocate(MemoryTag::BASE_TABLE, block_count * block_manager.GetBlockSize());
-	// perform a batch read of the blocks into the buffer
-	block_manager.ReadBlocks(intermediate_buffer.GetFileBuffer(), first_block, block_count);
-
+	auto &intermediate_buffer = range.buffer.get();
 	// the blocks are read - now we need to assign them to the individual blocks
-	for (idx_t block_idx = 0; block_idx < block_count; block_idx++) {
-		block_id_t block_id = first_block + NumericCast<block_id_t>(block_idx);
+	for (idx_t block_idx = 0; block_idx < range.block_count; block_idx++) {
+		block_id_t block_id = range.start_block + NumericCast<block_id_t>(block_idx);
 		auto entry = load_map.find(block_id);
 		D_ASSERT(entry != load_map.end()); // if we allow gaps we might not return true here
 		auto &handle = handles[entry->second];
@@ -247,9 +234,9 @@ void StandardBufferManager::BatchRead(vector<shared_ptr<BlockHandle>> &handles,
 				reservation.Resize(0);
 				continue;
 			}
-			auto block_ptr =
-			    intermediate_buffer.GetFileBuffer().InternalBuffer() + block_idx * block_manager.GetBlockAllocSize();
+			auto block_ptr = intermediate_buffer.InternalBuffer() + block_idx * block_manager.GetBlockAllocSize();
 			buf = handle->LoadFromBuffer(block_ptr, std::move(reusable_buffer));
+			buffer_pool.RegisterBlockLoad(*handle, true);
 			handle->readers = 1;
 			handle->memory_charge = std::move(reservation);
 		}
@@ -271,29 +258,43 @@ void StandardBufferManager::Prefetch(vector<shared_ptr<BlockHandle>> &handles) {
 		// nothing to fetch
 		return;
 	}
-	// iterate over the blocks and perform bulk reads
-	block_id_t first_block = -1;
-	block_id_t previous_block_id = -1;
+	// iterate over the blocks and gather ranges of adjacent blocks
+	auto &block_manager = handles[0]->block_manager;
+	vector<pair<block_id_t, idx_t>> ranges;
 	for (auto &entry : to_be_loaded) {
-		if (previous_block_id < 0) {
-			// this the first block we are seeing
-			first_block = entry.first;
-			previous_block_id = first_block;
-		} else if (previous_block_id + 1 == entry.first) {
-			// this block is adjacent to the previous block - add it to the batch read
-			previous_block_id = entry.first;
+		if (!ranges.empty() && ranges.back().first + NumericCast<block_id_t>(ranges.back().second) == entry.first) {
+			// this block is adjacent to the previous block - add it to the range
+			ranges.back().second++;
 		} else {
-			// this block is not adjacent to the previous block
-			// perform the batch read for the previous batch
-			BatchRead(handles, to_be_loaded, first_block, previous_block_id);
-
-			// set the first_block and previous_block_id to the current block
-			first_block = entry.first;
-			previous_block_id = entry.first;
+			ranges.emplace_back(entry.first, 1);
 		}
 	}
-	// batch read the final batch
-	BatchRead(handles, to_be_loaded, first_block, previous_block_id);
+#ifndef DUCKDB_ALTERNATIVE_VERIFY
+	if (!block_manager.SupportsAsyncReads()) {
+		// prefetching a single block has no performance impact if reads are synchronous, since we can't batch reads
+		// skip the prefetch of these blocks
+		// we do it anyway if alternative_verify is on for extra testing
+		ranges.erase(std::remove_if(ranges.begin(), ranges.end(),
+		                            [](const pair<block_id_t, idx_t> &range) { return range.second == 1; }),
+		             ranges.end());
+	}
+#endif
+	if (ranges.empty()) {
+		return;
+	}
+
+	// allocate buffers to hold the data of all of the ranges
+	vector<BufferHandle> intermediate_buffers;
+	vector<BlockReadRange> reads;
+	for (auto &range : ranges) {
+		intermediate_buffers.push_back(Allocate(MemoryTag::BASE_TABLE, range.second * block_manager.GetBlockSize()));
+		reads.emplace_back(intermediate_buffers.back().GetFileBuffer(), range.first, range.second);
+	}
+	// perform a batch read of all of the ranges
+	block_manager.ReadBlocks(reads);
+	for (auto &read : reads) {
+		BatchRead(handles, to_be_loaded, read);
+	}
 }
 
 BufferHandle StandardBufferManager::Pin(shared_ptr<BlockHandle> &handle) {
@@ -309,6 +310,7 @@ BufferHandle StandardBufferManager::Pin(shared_ptr<BlockHandle> &handle) {
 		// check if the block is already loaded
 		if (handle->state == BlockState::BLOCK_LOADED) {
 			// the block is loaded, increment the reader count and set the BufferHandle
+			buffer_pool.RegisterBlockHit(*handle);
 			handle->readers++;
 			buf = handle->Load();
 		}
@@ -329,6 +331,7 @@ BufferHandle StandardBufferManager::Pin(shared_ptr<BlockHandle> &handle) {
 		// check if the block is already loaded
 		if (handle->state == BlockState::BLOCK_LOADED) {
 			// the block is loaded, increment the reader count and return a pointer to the handle
+			buffer_pool.RegisterBlockHit(*handle);
 			handle->readers++;
 			reservation.Resize(0);
 			buf = handle->Load();
@@ -336,6 +339,7 @@ BufferHandle StandardBufferManager::Pin(shared_ptr<BlockHandle> &handle) {
 			// now we can actually load the current block
 			D_ASSERT(handle->readers == 0);
 			buf = handle->Load(std::move(reusable_buffer));
+			buffer_pool.RegisterBlockLoad(*handle, false);
 			handle->readers = 1;
 			handle->memory_charge = std::move(reservation);
 			// in the case of a variable sized block, the buffer may be smaller than a full block.
@@ -419,6 +423,9 @@ vector<MemoryInformation> StandardBufferManager::GetMemoryUsageInfo() const {
 		info.tag = MemoryTag(k);
 		info.size = buffer_pool.memory_usage.GetUsedMemory(MemoryTag(k), BufferPool::MemoryUsageCaches::FLUSH);
 		info.evicted_data = evicted_data_per_tag[k].load();
+		info.buffer_hits = buffer_pool.buffer_hits[k].load();
+		info.buffer_misses = buffer_pool.buffer_misses[k].load();
+		info.buffer_evictions = buffer_pool.buffer_evictions[k].load();
 		result.push_back(info);
 	}
 	return result;
@@ -568,6 +575,9 @@ vector<TemporaryFileInformation> StandardBufferManager::GetTemporaryFiles() {
 		TemporaryFileInformation info;
 		info.path = name;
 		info.size = NumericCast<idx_t>(fs.GetFileSize(*handle));
+		// variable-size blocks are not compressed
+		info.compressed_size = info.size;
+		info.uncompressed_size = info.size;
 		handle.reset();
 		result.push_back(info);
 	});
@@ -298,7 +298,7 @@ void SingleFileStorageCommitState::FlushCommit() {
 	if (state != WALCommitState::IN_PROGRESS) {
 		return;
 	}
-	wal.Flush();
+	wal.FlushCommit();
 	state = WALCommitState::FLUSHED;
 }
 
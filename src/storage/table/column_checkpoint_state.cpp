@@ -197,6 +197,7 @@ void ColumnCheckpointState::FlushSegment(unique_ptr<ColumnSegment> segment, idx_
 PersistentColumnData ColumnCheckpointState::ToPersistentData() {
 	PersistentColumnData data(column_data.type.InternalType());
 	data.pointers = std::move(data_pointers);
+	data.bloom_filter = bloom_filter;
 	return data;
 }
 
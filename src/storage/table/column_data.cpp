@@ -1,7 +1,11 @@
 #include "duckdb/storage/table/column_data.hpp"
+#include "duckdb/common/blocked_bloom_filter.hpp"
 #include "duckdb/common/exception/transaction_exception.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/function/compression_function.hpp"
+#include "duckdb/planner/filter/conjunction_filter.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/in_filter.hpp"
 #include "duckdb/planner/table_filter.hpp"
 #include "duckdb/storage/data_pointer.hpp"
 #include "duckdb/storage/data_table.hpp"
@@ -367,12 +371,79 @@ FilterPropagateResult ColumnData::CheckZonemap(ColumnScanState &state, TableFilt
 	return FilterPropagateResult::NO_PRUNING_POSSIBLE;
 }
 
+static bool BloomFilterContains(const BlockedBloomFilter &bloom_filter, const LogicalType &type, const Value &value) {
+	if (value.IsNull() || value.type().InternalType() != type.InternalType()) {
+		return true;
+	}
+	return bloom_filter.Lookup(value.Hash());
+}
+
+//! Checks equality and IN filters against the bloom filter of a column
+static FilterPropagateResult CheckBloomFilter(const BlockedBloomFilter &bloom_filter, const LogicalType &type,
+                                              TableFilter &filter) {
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON: {
+		auto &constant_filter = filter.Cast<ConstantFilter>();
+		if (constant_filter.comparison_type != ExpressionType::COMPARE_EQUAL) {
+			return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+		}
+		return BloomFilterContains(bloom_filter, type, constant_filter.constant)
+		           ? FilterPropagateResult::NO_PRUNING_POSSIBLE
+		           : FilterPropagateResult::FILTER_ALWAYS_FALSE;
+	}
+	case TableFilterType::IN_FILTER: {
+		auto &in_filter = filter.Cast<InFilter>();
+		for (auto &value : in_filter.values) {
+			if (BloomFilterContains(bloom_filter, type, value)) {
+				return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+			}
+		}
+		return FilterPropagateResult::FILTER_ALWAYS_FALSE;
+	}
+	case TableFilterType::CONJUNCTION_AND: {
+		auto &conjunction = filter.Cast<ConjunctionAndFilter>();
+		for (auto &child_filter : conjunction.child_filters) {
+			if (CheckBloomFilter(bloom_filter, type, *child_filter) == FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+				return FilterPropagateResult::FILTER_ALWAYS_FALSE;
+			}
+		}
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	case TableFilterType::CONJUNCTION_OR: {
+		auto &conjunction = filter.Cast<ConjunctionOrFilter>();
+		for (auto &child_filter : conjunction.child_filters) {
+			if (CheckBloomFilter(bloom_filter, type, *child_filter) != FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+				return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+			}
+		}
+		return FilterPropagateResult::FILTER_ALWAYS_FALSE;
+	}
+	default:
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+}
+
 FilterPropagateResult ColumnData::CheckZonemap(TableFilter &filter) {
 	if (!stats) {
 		throw InternalException("ColumnData::CheckZonemap called on a column without stats");
 	}
-	lock_guard<mutex> l(stats_lock);
-	return filter.CheckStatistics(stats->statistics);
+	shared_ptr<BlockedBloomFilter> column_bloom_filter;
+	{
+		lock_guard<mutex> l(stats_lock);
+		auto prune_result = filter.CheckStatistics(stats->statistics);
+		if (prune_result != FilterPropagateResult::NO_PRUNING_POSSIBLE || !bloom_filter) {
+			return prune_result;
+		}
+		column_bloom_filter = bloom_filter;
+	}
+	{
+		lock_guard<mutex> l(update_lock);
+		if (updates) {
+			// the bloom filter does not contain the updated values
+			return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+		}
+	}
+	return CheckBloomFilter(*column_bloom_filter, type, filter);
 }
 
 unique_ptr<BaseStatistics> ColumnData::GetStatistics() {
@@ -400,6 +471,11 @@ void ColumnData::MergeIntoStatistics(BaseStatistics &other) {
 }
 
 void ColumnData::InitializeAppend(ColumnAppendState &state) {
+	{
+		// the appended values are not in the bloom filter - it is rebuilt at the next checkpoint
+		lock_guard<mutex> l(stats_lock);
+		bloom_filter.reset();
+	}
 	auto l = data.Lock();
 	if (data.IsEmpty(l)) {
 		// no segments yet, append an empty segment
@@ -576,6 +652,10 @@ unique_ptr<ColumnCheckpointState> ColumnData::Checkpoint(RowGroup &row_group, Co
 	// replace the old tree with the new one
 	data.Replace(l, checkpoint_state->new_tree);
 	ClearUpdates();
+	{
+		lock_guard<mutex> stats_guard(stats_lock);
+		bloom_filter = checkpoint_state->bloom_filter;
+	}
 
 	return checkpoint_state;
 }
@@ -586,6 +666,7 @@ void ColumnData::InitializeColumn(PersistentColumnData &column_data) {
 
 void ColumnData::InitializeColumn(PersistentColumnData &column_data, BaseStatistics &target_stats) {
 	D_ASSERT(type.InternalType() == column_data.physical_type);
+	bloom_filter = column_data.bloom_filter;
 	// construct the segments based on the data pointers
 	this->count = 0;
 	for (auto &data_pointer : column_data.pointers) {
@@ -653,6 +734,7 @@ void PersistentColumnData::Serialize(Serializer &serializer) const {
 		serializer.WriteList(102, "sub_columns", child_columns.size() - 1,
 		                     [&](Serializer::List &list, idx_t i) { list.WriteElement(child_columns[i + 1]); });
 	}
+	serializer.WritePropertyWithDefault(103, "bloom_filter", bloom_filter);
 }
 
 void PersistentColumnData::DeserializeField(Deserializer &deserializer, field_id_t field_idx, const char *field_name,
@@ -691,6 +773,7 @@ PersistentColumnData PersistentColumnData::Deserialize(Deserializer &deserialize
 	default:
 		break;
 	}
+	deserializer.ReadPropertyWithDefault(103, "bloom_filter", result.bloom_filter);
 	return result;
 }
 
@@ -760,6 +843,10 @@ bool PersistentCollectionData::HasUpdates() const {
 PersistentColumnData ColumnData::Serialize() {
 	PersistentColumnData result(type.InternalType(), GetDataPointers());
 	result.has_updates = HasUpdates();
+	{
+		lock_guard<mutex> l(stats_lock);
+		result.bloom_filter = bloom_filter;
+	}
 	return result;
 }
 
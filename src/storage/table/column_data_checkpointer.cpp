@@ -1,4 +1,6 @@
 #include "duckdb/storage/table/column_data_checkpointer.hpp"
+#include "duckdb/common/blocked_bloom_filter.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/main/config.hpp"
 #include "duckdb/storage/table/update_segment.hpp"
 #include "duckdb/storage/data_table.hpp"
@@ -198,13 +200,38 @@ void ColumnDataCheckpointer::WriteToDisk() {
 	auto best_function = compression_functions[compression_idx];
 	auto compress_state = best_function->init_compression(*this, std::move(analyze_state));
 
-	ScanSegments(
-	    [&](Vector &scan_vector, idx_t count) { best_function->compress(*compress_state, scan_vector, count); });
+	// if requested, collect the hashes of all values while compressing to build the bloom filter of the column
+	bool build_bloom_filter = checkpoint_info.HasBloomFilter() && BlockedBloomFilter::SupportsType(GetType());
+	vector<hash_t> hashes;
+	Vector hash_vector(LogicalType::HASH);
+	ScanSegments([&](Vector &scan_vector, idx_t count) {
+		if (build_bloom_filter) {
+			VectorOperations::Hash(scan_vector, hash_vector, count);
+			hash_vector.Flatten(count);
+			auto hash_data = FlatVector::GetData<hash_t>(hash_vector);
+			hashes.insert(hashes.end(), hash_data, hash_data + count);
+		}
+		best_function->compress(*compress_state, scan_vector, count);
+	});
 	best_function->compress_finalize(*compress_state);
+	if (build_bloom_filter) {
+		BuildBloomFilter(hashes);
+	}
 
 	nodes.clear();
 }
 
+void ColumnDataCheckpointer::BuildBloomFilter(vector<hash_t> &hashes) {
+	// size the filter for the number of distinct values, so that low-cardinality columns have small filters
+	std::sort(hashes.begin(), hashes.end());
+	hashes.erase(std::unique(hashes.begin(), hashes.end()), hashes.end());
+	auto bloom_filter = make_shared_ptr<BlockedBloomFilter>(hashes.size());
+	for (auto &hash : hashes) {
+		bloom_filter->Insert(hash);
+	}
+	state.bloom_filter = std::move(bloom_filter);
+}
+
 bool ColumnDataCheckpointer::HasChanges() {
 	for (idx_t segment_idx = 0; segment_idx < nodes.size(); segment_idx++) {
 		auto segment = nodes[segment_idx].node.get();
@@ -238,6 +265,11 @@ void ColumnDataCheckpointer::WritePersistentSegments() {
 
 		state.data_pointers.push_back(std::move(pointer));
 	}
+	if (checkpoint_info.HasBloomFilter()) {
+		// the data is unchanged - so is the bloom filter
+		lock_guard<mutex> l(col_data.stats_lock);
+		state.bloom_filter = col_data.bloom_filter;
+	}
 }
 
 void ColumnDataCheckpointer::Checkpoint(vector<SegmentNode<ColumnSegment>> nodes_p) {
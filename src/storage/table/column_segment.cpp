@@ -4,8 +4,11 @@
 #include "duckdb/common/types/null_value.hpp"
 #include "duckdb/common/types/vector.hpp"
 #include "duckdb/main/config.hpp"
+#include "duckdb/planner/filter/bloom_filter.hpp"
 #include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/dynamic_filter.hpp"
+#include "duckdb/planner/filter/in_filter.hpp"
 #include "duckdb/planner/filter/struct_filter.hpp"
 #include "duckdb/storage/data_pointer.hpp"
 #include "duckdb/storage/storage_manager.hpp"
@@ -111,6 +114,10 @@ void ColumnSegment::InitializePrefetch(PrefetchState &prefetch_state, ColumnScan
 }
 
 void ColumnSegment::InitializeScan(ColumnScanState &state) {
+	if (block && block->BlockId() < MAXIMUM_BLOCK && block->IsUnloaded()) {
+		// blocks that are loaded by a scan are the first to be evicted by the scan-resistant eviction policy
+		block->SetScanHint();
+	}
 	state.scan_state = function.get().init_scan(*this);
 }
 
@@ -530,6 +537,22 @@ idx_t ColumnSegment::FilterSelection(SelectionVector &sel, Vector &vector, Unifi
 		return FilterSelection(sel, *child_vec, child_data, *struct_filter.child_filter, scan_count,
 		                       approved_tuple_count);
 	}
+	case TableFilterType::BLOOM_FILTER: {
+		auto &bloom_filter = filter.Cast<BloomFilter>();
+		return bloom_filter.Filter(vector, vdata, sel, approved_tuple_count);
+	}
+	case TableFilterType::IN_FILTER: {
+		auto &in_filter = filter.Cast<InFilter>();
+		return in_filter.Filter(vector, vdata, sel, approved_tuple_count);
+	}
+	case TableFilterType::DYNAMIC_FILTER: {
+		// take a snapshot of the filter - it can be updated concurrently
+		auto current_filter = filter.Cast<DynamicFilter>().GetFilter();
+		if (!current_filter) {
+			return approved_tuple_count;
+		}
+		return FilterSelection(sel, vector, vdata, *current_filter, scan_count, approved_tuple_count);
+	}
 	default:
 		throw InternalException("FIXME: unsupported type for filter selection");
 	}
@@ -26,19 +26,21 @@
 namespace duckdb {
 
 RowGroup::RowGroup(RowGroupCollection &collection_p, idx_t start, idx_t count)
-    : SegmentBase<RowGroup>(start, count), collection(collection_p), version_info(nullptr), allocation_size(0) {
+    : SegmentBase<RowGroup>(start, count), collection(collection_p), version_info(nullptr), has_changes(true),
+      allocation_size(0) {
 	Verify();
 }
 
 RowGroup::RowGroup(RowGroupCollection &collection_p, RowGroupPointer pointer)
     : SegmentBase<RowGroup>(pointer.row_start, pointer.tuple_count), collection(collection_p), version_info(nullptr),
-      allocation_size(0) {
+      has_changes(false), allocation_size(0) {
 	// deserialize the columns
 	if (pointer.data_pointers.size() != collection_p.GetTypes().size()) {
 		throw IOException("Row group column count is unaligned with table column count. Corrupt file?");
 	}
 	this->column_pointers = std::move(pointer.data_pointers);
 	this->columns.resize(column_pointers.size());
+	this->column_metadata_blocks.resize(column_pointers.size());
 	this->is_loaded = unique_ptr<atomic<bool>[]>(new atomic<bool>[columns.size()]);
 	for (idx_t c = 0; c < columns.size(); c++) {
 		this->is_loaded[c] = false;
@@ -51,7 +53,7 @@ RowGroup::RowGroup(RowGroupCollection &collection_p, RowGroupPointer pointer)
 
 RowGroup::RowGroup(RowGroupCollection &collection_p, PersistentRowGroupData &data)
     : SegmentBase<RowGroup>(data.start, data.count), collection(collection_p), version_info(nullptr),
-      allocation_size(0) {
+      has_changes(true), allocation_size(0) {
 	auto &block_manager = GetBlockManager();
 	auto &info = GetTableInfo();
 	auto &types = collection.get().GetTypes();
@@ -67,6 +69,10 @@ RowGroup::RowGroup(RowGroupCollection &collection_p, PersistentRowGroupData &dat
 
 void RowGroup::MoveToCollection(RowGroupCollection &collection_p, idx_t new_start) {
 	this->collection = collection_p;
+	if (this->start != new_start) {
+		// the row start is part of the column metadata
+		has_changes = true;
+	}
 	this->start = new_start;
 	for (auto &column : GetColumns()) {
 		column->SetStart(new_start);
@@ -116,7 +122,7 @@ ColumnData &RowGroup::GetColumn(storage_t c) {
 	auto &metadata_manager = GetCollection().GetMetadataManager();
 	auto &types = GetCollection().GetTypes();
 	auto &block_pointer = column_pointers[c];
-	MetadataReader column_data_reader(metadata_manager, block_pointer);
+	MetadataReader column_data_reader(metadata_manager, block_pointer, &column_metadata_blocks[c]);
 	this->columns[c] =
 	    ColumnData::Deserialize(GetBlockManager(), GetTableInfo(), c, start, column_data_reader, types[c]);
 	is_loaded[c] = true;
@@ -419,6 +425,9 @@ static idx_t GetFilterScanCount(ColumnScanState &state, TableFilter &filter) {
 	case TableFilterType::IS_NULL:
 	case TableFilterType::IS_NOT_NULL:
 	case TableFilterType::CONSTANT_COMPARISON:
+	case TableFilterType::BLOOM_FILTER:
+	case TableFilterType::IN_FILTER:
+	case TableFilterType::DYNAMIC_FILTER:
 		return state.current->start + state.current->count;
 	default: {
 		throw NotImplementedException("Unimplemented filter type for zonemap");
@@ -508,9 +517,9 @@ void RowGroup::TemplatedScan(TransactionData transaction, CollectionScanState &s
 		}
 		auto &block_manager = GetBlockManager();
 #ifndef DUCKDB_ALTERNATIVE_VERIFY
-		// // in regular operation we only prefetch from remote file systems
+		// // in regular operation we only prefetch from remote file systems, or if reads are asynchronous
 		// // when alternative verify is set, we always prefetch for testing purposes
-		if (block_manager.IsRemote())
+		if (block_manager.IsRemote() || block_manager.SupportsAsyncReads())
 #else
 		if (!block_manager.InMemory())
 #endif
@@ -778,6 +787,7 @@ void RowGroup::AppendVersionInfo(TransactionData transaction, idx_t count) {
 	auto &vinfo = GetOrCreateVersionInfo();
 	vinfo.AppendVersionInfo(transaction, count, row_group_start, row_group_end);
 	this->count = row_group_end;
+	has_changes = true;
 }
 
 void RowGroup::CommitAppend(transaction_t commit_id, idx_t row_group_start, idx_t count) {
@@ -788,6 +798,7 @@ void RowGroup::CommitAppend(transaction_t commit_id, idx_t row_group_start, idx_
 void RowGroup::RevertAppend(idx_t row_group_start) {
 	auto &vinfo = GetOrCreateVersionInfo();
 	vinfo.RevertAppend(row_group_start - this->start);
+	has_changes = true;
 	for (auto &column : columns) {
 		column->RevertAppend(UnsafeNumericCast<row_t>(row_group_start));
 	}
@@ -798,6 +809,7 @@ void RowGroup::RevertAppend(idx_t row_group_start) {
 void RowGroup::InitializeAppend(RowGroupAppendState &append_state) {
 	append_state.row_group = this;
 	append_state.offset_in_row_group = this->count;
+	has_changes = true;
 	// for each column, initialize the append state
 	append_state.states = make_unsafe_uniq_array<ColumnAppendState>(GetColumnCount());
 	for (idx_t i = 0; i < GetColumnCount(); i++) {
@@ -830,6 +842,7 @@ void RowGroup::Update(TransactionData transaction, DataChunk &update_chunk, row_
 		D_ASSERT(ids[i] >= row_t(this->start) && ids[i] < row_t(this->start + this->count));
 	}
 #endif
+	has_changes = true;
 	for (idx_t i = 0; i < column_ids.size(); i++) {
 		auto column = column_ids[i];
 		D_ASSERT(column.index != COLUMN_IDENTIFIER_ROW_ID);
@@ -854,6 +867,7 @@ void RowGroup::UpdateColumn(TransactionData transaction, DataChunk &updates, Vec
 	auto primary_column_idx = column_path[0];
 	D_ASSERT(primary_column_idx != COLUMN_IDENTIFIER_ROW_ID);
 	D_ASSERT(primary_column_idx < columns.size());
+	has_changes = true;
 	auto &col_data = GetColumn(primary_column_idx);
 	col_data.UpdateColumn(transaction, column_path, updates.data[0], ids, updates.size(), 1);
 	MergeStatistics(primary_column_idx, *col_data.GetUpdateStatistics());
@@ -885,6 +899,10 @@ CompressionType ColumnCheckpointInfo::GetCompressionType() {
 	return info.compression_types[column_idx];
 }
 
+bool ColumnCheckpointInfo::HasBloomFilter() {
+	return info.bloom_filters[column_idx];
+}
+
 RowGroupWriteData RowGroup::WriteToDisk(RowGroupWriteInfo &info) {
 	RowGroupWriteData result;
 	result.states.reserve(columns.size());
@@ -933,7 +951,9 @@ bool RowGroup::HasUnloadedDeletes() const {
 
 RowGroupWriteData RowGroup::WriteToDisk(RowGroupWriter &writer) {
 	vector<CompressionType> compression_types;
+	vector<bool> bloom_filters;
 	compression_types.reserve(columns.size());
+	bloom_filters.reserve(columns.size());
 	for (idx_t column_idx = 0; column_idx < GetColumnCount(); column_idx++) {
 		auto &column = GetColumn(column_idx);
 		if (column.count != this->count) {
@@ -942,9 +962,11 @@ RowGroupWriteData RowGroup::WriteToDisk(RowGroupWriter &writer) {
 			                        column_idx, this->count.load(), column.count.load());
 		}
 		compression_types.push_back(writer.GetColumnCompressionType(column_idx));
+		bloom_filters.push_back(writer.ColumnHasBloomFilter(column_idx));
 	}
 
-	RowGroupWriteInfo info(writer.GetPartialBlockManager(), compression_types, writer.GetCheckpointType());
+	RowGroupWriteInfo info(writer.GetPartialBlockManager(), compression_types, bloom_filters,
+	                       writer.GetCheckpointType());
 	return WriteToDisk(info);
 }
 
@@ -961,6 +983,7 @@ RowGroupPointer RowGroup::Checkpoint(RowGroupWriteData write_data, RowGroupWrite
 	D_ASSERT(write_data.states.size() == columns.size());
 	row_group_pointer.row_start = start;
 	row_group_pointer.tuple_count = count;
+	vector<vector<MetaBlockPointer>> metadata_blocks;
 	for (auto &state : write_data.states) {
 		// get the current position of the table data writer
 		auto &data_writer = writer.GetPayloadWriter();
@@ -973,17 +996,53 @@ RowGroupPointer RowGroup::Checkpoint(RowGroupWriteData write_data, RowGroupWrite
 		//
 		// Just as above, the state can refer to many other states, so this
 		// can cascade recursively into more pointer writes.
+		// We keep track of the metadata blocks we write to, so later checkpoints can re-use them.
+		vector<MetaBlockPointer> column_blocks {pointer};
+		data_writer.SetWrittenPointers(&column_blocks);
 		auto persistent_data = state->ToPersistentData();
 		BinarySerializer serializer(data_writer);
 		serializer.Begin();
 		persistent_data.Serialize(serializer);
 		serializer.End();
+		data_writer.SetWrittenPointers(nullptr);
+		metadata_blocks.push_back(std::move(column_blocks));
 	}
 	row_group_pointer.deletes_pointers = CheckpointDeletes(writer.GetPayloadWriter().GetManager());
+
+	// the in-memory column data now matches what was written
+	column_pointers = row_group_pointer.data_pointers;
+	column_metadata_blocks = std::move(metadata_blocks);
+	has_changes = false;
+	Verify();
+	return row_group_pointer;
+}
+
+RowGroupPointer RowGroup::Checkpoint(RowGroupWriter &writer) {
+	D_ASSERT(!HasChanges());
+	D_ASSERT(column_pointers.size() == GetColumnCount());
+	auto &manager = writer.GetPayloadWriter().GetManager();
+	for (idx_t column_idx = 0; column_idx < GetColumnCount(); column_idx++) {
+		if (column_metadata_blocks[column_idx].empty()) {
+			// the column was never loaded - we need to read it once to find the metadata blocks it is stored in
+			GetColumn(column_idx);
+		}
+		// the column metadata is re-used - ensure its blocks are not marked as free
+		manager.ClearModifiedBlocks(column_metadata_blocks[column_idx]);
+	}
+
+	RowGroupPointer row_group_pointer;
+	row_group_pointer.row_start = start;
+	row_group_pointer.tuple_count = count;
+	row_group_pointer.data_pointers = column_pointers;
+	row_group_pointer.deletes_pointers = CheckpointDeletes(manager);
 	Verify();
 	return row_group_pointer;
 }
 
+bool RowGroup::HasChanges() const {
+	return has_changes;
+}
+
 bool RowGroup::IsPersistent() const {
 	for (auto &column : columns) {
 		if (!column->IsPersistent()) {
@@ -60,6 +60,9 @@ RowGroupCollection::RowGroupCollection(shared_ptr<DataTableInfo> info_p, BlockMa
 	row_groups = make_shared_ptr<RowGroupSegmentTree>(*this);
 }
 
+RowGroupCollection::~RowGroupCollection() {
+}
+
 idx_t RowGroupCollection::GetTotalRows() const {
 	return total_rows.load();
 }
@@ -692,22 +695,28 @@ void RowGroupCollection::UpdateColumn(TransactionData transaction, Vector &row_i
 //===--------------------------------------------------------------------===//
 // Checkpoint State
 //===--------------------------------------------------------------------===//
+struct VacuumState {
+	bool can_vacuum_deletes = false;
+	idx_t row_start = 0;
+	idx_t next_vacuum_idx = 0;
+	vector<idx_t> row_group_counts;
+};
+
 struct CollectionCheckpointState {
-	CollectionCheckpointState(RowGroupCollection &collection, TableDataWriter &writer,
-	                          vector<SegmentNode<RowGroup>> &segments, TableStatistics &global_stats)
-	    : collection(collection), writer(writer), executor(writer.GetScheduler()), segments(segments),
-	      global_stats(global_stats) {
+	CollectionCheckpointState(RowGroupCollection &collection, TableDataWriter &writer, TaskExecutor &executor,
+	                          vector<SegmentNode<RowGroup>> segments_p)
+	    : collection(collection), writer(writer), executor(executor), segments(std::move(segments_p)) {
 		writers.resize(segments.size());
 		write_data.resize(segments.size());
 	}
 
 	RowGroupCollection &collection;
 	TableDataWriter &writer;
-	TaskExecutor executor;
-	vector<SegmentNode<RowGroup>> &segments;
+	TaskExecutor &executor;
+	vector<SegmentNode<RowGroup>> segments;
 	vector<unique_ptr<RowGroupWriter>> writers;
 	vector<RowGroupWriteData> write_data;
-	TableStatistics &global_stats;
+	VacuumState vacuum_state;
 	mutex write_lock;
 };
 
@@ -741,13 +750,6 @@ private:
 //===--------------------------------------------------------------------===//
 // Vacuum
 //===--------------------------------------------------------------------===//
-struct VacuumState {
-	bool can_vacuum_deletes = false;
-	idx_t row_start = 0;
-	idx_t next_vacuum_idx = 0;
-	vector<idx_t> row_group_counts;
-};
-
 class VacuumTask : public BaseCheckpointTask {
 public:
 	VacuumTask(CollectionCheckpointState &checkpoint_state, VacuumState &vacuum_state, idx_t segment_idx,
@@ -961,20 +963,20 @@ unique_ptr<CheckpointTask> RowGroupCollection::GetCheckpointTask(CollectionCheck
 	return make_uniq<CheckpointTask>(checkpoint_state, segment_idx);
 }
 
-void RowGroupCollection::Checkpoint(TableDataWriter &writer, TableStatistics &global_stats) {
+void RowGroupCollection::ScheduleCheckpoint(TableDataWriter &writer, TaskExecutor &executor) {
+	D_ASSERT(!checkpoint_state);
 	auto segments = row_groups->MoveSegments();
-	auto l = row_groups->Lock();
+	checkpoint_state = make_uniq<CollectionCheckpointState>(*this, writer, executor, std::move(segments));
+	auto &state = *checkpoint_state;
+	auto &vacuum_state = state.vacuum_state;
 
-	CollectionCheckpointState checkpoint_state(*this, writer, segments, global_stats);
-
-	VacuumState vacuum_state;
-	InitializeVacuumState(checkpoint_state, vacuum_state, segments);
+	InitializeVacuumState(state, vacuum_state, state.segments);
 	// schedule tasks
 	idx_t total_vacuum_tasks = 0;
 	auto &config = DBConfig::GetConfig(writer.GetDatabase());
-	for (idx_t segment_idx = 0; segment_idx < segments.size(); segment_idx++) {
-		auto &entry = segments[segment_idx];
-		auto vacuum_tasks = ScheduleVacuumTasks(checkpoint_state, vacuum_state, segment_idx,
+	for (idx_t segment_idx = 0; segment_idx < state.segments.size(); segment_idx++) {
+		auto &entry = state.segments[segment_idx];
+		auto vacuum_tasks = ScheduleVacuumTasks(state, vacuum_state, segment_idx,
 		                                        total_vacuum_tasks < config.options.max_vacuum_tasks);
 		if (vacuum_tasks) {
 			// vacuum tasks were scheduled - don't schedule a checkpoint task yet
@@ -985,16 +987,31 @@ void RowGroupCollection::Checkpoint(TableDataWriter &writer, TableStatistics &gl
 			// row group was vacuumed/dropped - skip
 			continue;
 		}
-		// schedule a checkpoint task for this row group
 		entry.node->MoveToCollection(*this, vacuum_state.row_start);
-		auto checkpoint_task = GetCheckpointTask(checkpoint_state, segment_idx);
-		checkpoint_state.executor.ScheduleTask(std::move(checkpoint_task));
 		vacuum_state.row_start += entry.node->count;
+		if (!entry.node->HasChanges()) {
+			// the row group is unchanged since it was last written - its data and metadata can be re-used as-is
+			continue;
+		}
+		// schedule a checkpoint task for this row group
+		auto checkpoint_task = GetCheckpointTask(state, segment_idx);
+		state.executor.ScheduleTask(std::move(checkpoint_task));
 	}
-	// all tasks have been scheduled - execute tasks until we are done
-	checkpoint_state.executor.WorkOnTasks();
+}
 
-	// no errors - finalize the row groups
+void RowGroupCollection::Checkpoint(TableDataWriter &writer, TableStatistics &global_stats) {
+	if (!checkpoint_state) {
+		// the row groups have not been written yet - write them now
+		TaskExecutor executor(writer.GetScheduler());
+		ScheduleCheckpoint(writer, executor);
+		executor.WorkOnTasks();
+		Checkpoint(writer, global_stats);
+		return;
+	}
+	// all tasks have been executed - finalize the row groups
+	auto state = std::move(checkpoint_state);
+	auto &segments = state->segments;
+	auto l = row_groups->Lock();
 	idx_t new_total_rows = 0;
 	for (idx_t segment_idx = 0; segment_idx < segments.size(); segment_idx++) {
 		auto &entry = segments[segment_idx];
@@ -1003,12 +1020,16 @@ void RowGroupCollection::Checkpoint(TableDataWriter &writer, TableStatistics &gl
 			continue;
 		}
 		auto &row_group = *entry.node;
-		auto row_group_writer = std::move(checkpoint_state.writers[segment_idx]);
-		if (!row_group_writer) {
+		auto row_group_writer = std::move(state->writers[segment_idx]);
+		RowGroupPointer pointer;
+		if (row_group_writer) {
+			pointer = row_group.Checkpoint(std::move(state->write_data[segment_idx]), *row_group_writer, global_stats);
+		} else if (!row_group.HasChanges()) {
+			row_group_writer = writer.GetRowGroupWriter(row_group);
+			pointer = row_group.Checkpoint(*row_group_writer);
+		} else {
 			throw InternalException("Missing row group writer for index %llu", segment_idx);
 		}
-		auto pointer =
-		    row_group.Checkpoint(std::move(checkpoint_state.write_data[segment_idx]), *row_group_writer, global_stats);
 		writer.AddRowGroup(std::move(pointer), std::move(row_group_writer));
 		row_groups->AppendSegment(l, std::move(entry.node));
 		new_total_rows += row_group.count;
@@ -1,6 +1,10 @@
 #include "duckdb/storage/temporary_file_manager.hpp"
+
+#include "duckdb/common/checksum.hpp"
+#include "duckdb/main/config.hpp"
 #include "duckdb/storage/buffer/temporary_file_information.hpp"
 #include "duckdb/storage/standard_buffer_manager.hpp"
+#include "lz4.hpp"
 
 namespace duckdb {
 
@@ -8,10 +12,11 @@ namespace duckdb {
 // BlockIndexManager
 //===--------------------------------------------------------------------===//
 
-BlockIndexManager::BlockIndexManager(TemporaryFileManager &manager) : max_index(0), manager(&manager) {
+BlockIndexManager::BlockIndexManager(TemporaryFileManager &manager, idx_t block_size)
+    : max_index(0), manager(&manager), block_size(block_size) {
 }
 
-BlockIndexManager::BlockIndexManager() : max_index(0), manager(nullptr) {
+BlockIndexManager::BlockIndexManager() : max_index(0), manager(nullptr), block_size(0) {
 }
 
 idx_t BlockIndexManager::GetNewBlockIndex() {
@@ -53,12 +58,15 @@ idx_t BlockIndexManager::GetMaxIndex() {
 	return max_index;
 }
 
+idx_t BlockIndexManager::GetUsedIndexCount() {
+	return indexes_in_use.size();
+}
+
 bool BlockIndexManager::HasFreeBlocks() {
 	return !free_indexes.empty();
 }
 
 void BlockIndexManager::SetMaxIndex(idx_t new_index) {
-	static constexpr idx_t TEMP_FILE_BLOCK_SIZE = DEFAULT_BLOCK_ALLOC_SIZE;
 	if (!manager) {
 		max_index = new_index;
 	} else {
@@ -66,11 +74,11 @@ void BlockIndexManager::SetMaxIndex(idx_t new_index) {
 		if (new_index < old) {
 			max_index = new_index;
 			auto difference = old - new_index;
-			auto size_on_disk = difference * TEMP_FILE_BLOCK_SIZE;
+			auto size_on_disk = difference * block_size;
 			manager->DecreaseSizeOnDisk(size_on_disk);
 		} else if (new_index > old) {
 			auto difference = new_index - old;
-			auto size_on_disk = difference * TEMP_FILE_BLOCK_SIZE;
+			auto size_on_disk = difference * block_size;
 			manager->IncreaseSizeOnDisk(size_on_disk);
 			// Increase can throw, so this is only updated after it was succesfully updated
 			max_index = new_index;
@@ -95,10 +103,10 @@ idx_t BlockIndexManager::GetNewBlockIndexInternal() {
 //===--------------------------------------------------------------------===//
 
 TemporaryFileHandle::TemporaryFileHandle(idx_t temp_file_count, DatabaseInstance &db, const string &temp_directory,
-                                         idx_t index, TemporaryFileManager &manager)
+                                         idx_t index, idx_t slot_size, TemporaryFileManager &manager)
     : max_allowed_index((1 << temp_file_count) * MAX_ALLOWED_INDEX_BASE), db(db), file_index(index),
       path(FileSystem::GetFileSystem(db).JoinPath(temp_directory, "duckdb_temp_storage-" + to_string(index) + ".tmp")),
-      index_manager(manager) {
+      slot_size(slot_size), index_manager(manager, slot_size) {
 }
 
 TemporaryFileHandle::TemporaryFileLock::TemporaryFileLock(mutex &mutex) : lock(mutex) {
@@ -117,17 +125,56 @@ TemporaryFileIndex TemporaryFileHandle::TryGetBlockIndex() {
 	return TemporaryFileIndex(file_index, block_index);
 }
 
-void TemporaryFileHandle::WriteTemporaryFile(FileBuffer &buffer, TemporaryFileIndex index) {
+void TemporaryFileHandle::WriteTemporaryFile(FileBuffer &buffer, TemporaryFileIndex index,
+                                             AllocatedData &compressed_buffer) {
 	// We group DEFAULT_BLOCK_ALLOC_SIZE blocks into the same file.
 	D_ASSERT(buffer.size == BufferManager::GetBufferManager(db).GetBlockSize());
-	buffer.Write(*handle, GetPositionInFile(index.block_index));
+	auto position = GetPositionInFile(index.block_index);
+	if (compressed_buffer.get()) {
+		// the compressed buffer already contains the compressed size and the checksum
+		D_ASSERT(IsCompressed() && compressed_buffer.GetSize() >= slot_size);
+		handle->Write(compressed_buffer.get(), slot_size, position);
+		return;
+	}
+	// uncompressed: store the checksum in the (otherwise unused) block header
+	D_ASSERT(!IsCompressed() && buffer.AllocSize() == slot_size);
+	Store<uint64_t>(Checksum(buffer.buffer, buffer.size), buffer.InternalBuffer());
+	buffer.Write(*handle, position);
 }
 
 unique_ptr<FileBuffer> TemporaryFileHandle::ReadTemporaryBuffer(idx_t block_index,
                                                                 unique_ptr<FileBuffer> reusable_buffer) {
-	return StandardBufferManager::ReadTemporaryBufferInternal(
-	    BufferManager::GetBufferManager(db), *handle, GetPositionInFile(block_index),
-	    BufferManager::GetBufferManager(db).GetBlockSize(), std::move(reusable_buffer));
+	auto &buffer_manager = BufferManager::GetBufferManager(db);
+	auto block_size = buffer_manager.GetBlockSize();
+	auto position = GetPositionInFile(block_index);
+	if (!IsCompressed()) {
+		auto buffer = StandardBufferManager::ReadTemporaryBufferInternal(buffer_manager, *handle, position, block_size,
+		                                                                 std::move(reusable_buffer));
+		auto stored_checksum = Load<uint64_t>(buffer->InternalBuffer());
+		if (stored_checksum != Checksum(buffer->buffer, buffer->size)) {
+			throw IOException("Corrupt temporary file \"%s\": checksum mismatch in block %llu", path, block_index);
+		}
+		return buffer;
+	}
+	// read the compressed slot and verify its header
+	auto compressed_buffer = Allocator::Get(db).Allocate(slot_size);
+	handle->Read(compressed_buffer.get(), slot_size, position);
+	auto compressed_size = Load<idx_t>(compressed_buffer.get());
+	auto stored_checksum = Load<uint64_t>(compressed_buffer.get() + sizeof(idx_t));
+	auto compressed_data = compressed_buffer.get() + TemporaryFileManager::COMPRESSED_HEADER_SIZE;
+	if (compressed_size > slot_size - TemporaryFileManager::COMPRESSED_HEADER_SIZE ||
+	    stored_checksum != Checksum(compressed_data, compressed_size)) {
+		throw IOException("Corrupt temporary file \"%s\": checksum mismatch in block %llu", path, block_index);
+	}
+	// decompress it into the buffer
+	auto buffer = buffer_manager.ConstructManagedBuffer(block_size, std::move(reusable_buffer));
+	auto decompressed_size = duckdb_lz4::LZ4_decompress_safe(
+	    const_char_ptr_cast(compressed_data), char_ptr_cast(buffer->buffer), NumericCast<int>(compressed_size),
+	    NumericCast<int>(buffer->size));
+	if (decompressed_size < 0 || NumericCast<idx_t>(decompressed_size) != block_size) {
+		throw IOException("Corrupt temporary file \"%s\": failed to decompress block %llu", path, block_index);
+	}
+	return buffer;
 }
 
 void TemporaryFileHandle::EraseBlockIndex(block_id_t block_index) {
@@ -155,6 +202,9 @@ TemporaryFileInformation TemporaryFileHandle::GetTemporaryFile() {
 	TemporaryFileInformation info;
 	info.path = path;
 	info.size = GetPositionInFile(index_manager.GetMaxIndex());
+	auto block_count = index_manager.GetUsedIndexCount();
+	info.compressed_size = block_count * slot_size;
+	info.uncompressed_size = block_count * BufferManager::GetBufferManager(db).GetBlockAllocSize();
 	return info;
 }
 
@@ -181,7 +231,11 @@ void TemporaryFileHandle::RemoveTempBlockIndex(TemporaryFileLock &, idx_t index)
 }
 
 idx_t TemporaryFileHandle::GetPositionInFile(idx_t index) {
-	return index * BufferManager::GetBufferManager(db).GetBlockAllocSize();
+	return index * slot_size;
+}
+
+bool TemporaryFileHandle::IsCompressed() const {
+	return slot_size != BufferManager::GetBufferManager(db).GetBlockAllocSize();
 }
 
 //===--------------------------------------------------------------------===//
@@ -277,17 +331,53 @@ TemporaryFileManager::~TemporaryFileManager() {
 TemporaryFileManager::TemporaryManagerLock::TemporaryManagerLock(mutex &mutex) : lock(mutex) {
 }
 
+idx_t TemporaryFileManager::CompressBuffer(FileBuffer &buffer, AllocatedData &compressed_buffer) {
+	auto block_alloc_size = BufferManager::GetBufferManager(db).GetBlockAllocSize();
+	if (!DBConfig::GetConfig(db).options.temp_file_compression) {
+		return block_alloc_size;
+	}
+	auto source_size = NumericCast<int>(buffer.size);
+	auto max_compressed_size = NumericCast<idx_t>(duckdb_lz4::LZ4_compressBound(source_size));
+	auto allocation_size = MaxValue<idx_t>(COMPRESSED_HEADER_SIZE + max_compressed_size, block_alloc_size);
+	compressed_buffer = Allocator::Get(db).Allocate(allocation_size);
+	auto compressed_data = compressed_buffer.get() + COMPRESSED_HEADER_SIZE;
+	auto compressed_size =
+	    duckdb_lz4::LZ4_compress_default(const_char_ptr_cast(buffer.buffer), char_ptr_cast(compressed_data),
+	                                     source_size, NumericCast<int>(max_compressed_size));
+	if (compressed_size <= 0) {
+		compressed_buffer.Reset();
+		return block_alloc_size;
+	}
+	auto slot_size = AlignValue<idx_t, COMPRESSED_SLOT_ALIGNMENT>(COMPRESSED_HEADER_SIZE + idx_t(compressed_size));
+	if (slot_size >= block_alloc_size) {
+		// compression does not save any space: write the block uncompressed
+		compressed_buffer.Reset();
+		return block_alloc_size;
+	}
+	Store<idx_t>(idx_t(compressed_size), compressed_buffer.get());
+	Store<uint64_t>(Checksum(compressed_data, idx_t(compressed_size)), compressed_buffer.get() + sizeof(idx_t));
+	// zero-initialize the remainder of the slot
+	memset(compressed_data + compressed_size, 0, slot_size - COMPRESSED_HEADER_SIZE - idx_t(compressed_size));
+	return slot_size;
+}
+
 void TemporaryFileManager::WriteTemporaryBuffer(block_id_t block_id, FileBuffer &buffer) {
 	// We group DEFAULT_BLOCK_ALLOC_SIZE blocks into the same file.
 	D_ASSERT(buffer.size == BufferManager::GetBufferManager(db).GetBlockSize());
 	TemporaryFileIndex index;
 	TemporaryFileHandle *handle = nullptr;
 
+	// compress the buffer before grabbing the lock - the (compressed) size determines the file we write to
+	AllocatedData compressed_buffer;
+	auto slot_size = CompressBuffer(buffer, compressed_buffer);
 	{
 		TemporaryManagerLock lock(manager_lock);
-		// first check if we can write to an open existing file
+		// first check if we can write to an open existing file with the same slot size
 		for (auto &entry : files) {
 			auto &temp_file = entry.second;
+			if (temp_file->GetSlotSize() != slot_size) {
+				continue;
+			}
 			index = temp_file->TryGetBlockIndex();
 			if (index.IsValid()) {
 				handle = entry.second.get();
@@ -297,7 +387,8 @@ void TemporaryFileManager::WriteTemporaryBuffer(block_id_t block_id, FileBuffer
 		if (!handle) {
 			// no existing handle to write to; we need to create & open a new file
 			auto new_file_index = index_manager.GetNewBlockIndex();
-			auto new_file = make_uniq<TemporaryFileHandle>(files.size(), db, temp_directory, new_file_index, *this);
+			auto new_file =
+			    make_uniq<TemporaryFileHandle>(files.size(), db, temp_directory, new_file_index, slot_size, *this);
 			handle = new_file.get();
 			files[new_file_index] = std::move(new_file);
 
@@ -308,7 +399,7 @@ void TemporaryFileManager::WriteTemporaryBuffer(block_id_t block_id, FileBuffer
 	}
 	D_ASSERT(handle);
 	D_ASSERT(index.IsValid());
-	handle->WriteTemporaryFile(buffer, index);
+	handle->WriteTemporaryFile(buffer, index, compressed_buffer);
 }
 
 bool TemporaryFileManager::HasTemporaryBuffer(block_id_t block_id) {
@@ -17,12 +17,16 @@
 #include "duckdb/common/serializer/memory_stream.hpp"
 #include "duckdb/storage/table/column_data.hpp"
 
+#include <chrono>
+#include <thread>
+
 namespace duckdb {
 
 const uint64_t WAL_VERSION_NUMBER = 2;
 
 WriteAheadLog::WriteAheadLog(AttachedDatabase &database, const string &wal_path)
-    : database(database), wal_path(wal_path), wal_size(0), initialized(false) {
+    : database(database), wal_path(wal_path), wal_size(0), initialized(false), flushed_commits(0), synced_commits(0),
+      sync_in_progress(false), sync_failed(false) {
 }
 
 WriteAheadLog::~WriteAheadLog() {
@@ -423,4 +427,55 @@ void WriteAheadLog::Flush() {
 	wal_size = writer->GetFileSize();
 }
 
+idx_t WriteAheadLog::FlushCommit() {
+	if (!writer) {
+		return 0;
+	}
+
+	// write an empty entry
+	WriteAheadLogSerializer serializer(*this, WALType::WAL_FLUSH);
+	serializer.End();
+
+	// hand the changes to the file system - the sync happens in SyncCommit
+	writer->Flush();
+	wal_size = writer->GetFileSize();
+	return ++flushed_commits;
+}
+
+void WriteAheadLog::SyncCommit(idx_t commit, idx_t commit_delay) {
+	unique_lock<mutex> guard(sync_lock);
+	while (synced_commits < commit) {
+		if (sync_failed) {
+			// a failed sync might have lost the data of our commit - syncing again does not make it durable
+			throw IOException("Could not sync commit to the write-ahead log \"%s\": a previous sync failed", wal_path);
+		}
+		if (sync_in_progress) {
+			// another commit is syncing the WAL - wait for it to finish and check if it included our commit
+			sync_cv.wait(guard);
+			continue;
+		}
+		sync_in_progress = true;
+		guard.unlock();
+		if (commit_delay > 0) {
+			// give concurrent transactions the chance to flush their commits so they are included in this sync
+			std::this_thread::sleep_for(std::chrono::microseconds(commit_delay));
+		}
+		// all commits that were flushed before the sync starts are durable after it
+		idx_t sync_target = flushed_commits;
+		try {
+			writer->handle->Sync();
+		} catch (...) {
+			guard.lock();
+			sync_in_progress = false;
+			sync_failed = true;
+			sync_cv.notify_all();
+			throw;
+		}
+		guard.lock();
+		synced_commits = MaxValue<idx_t>(synced_commits, sync_target);
+		sync_in_progress = false;
+		sync_cv.notify_all();
+	}
+}
+
 } // namespace duckdb
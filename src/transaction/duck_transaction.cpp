@@ -162,6 +162,10 @@ UndoBufferProperties DuckTransaction::GetUndoProperties() {
 	return undo_buffer.GetProperties();
 }
 
+reference_set_t<DataTableInfo> DuckTransaction::GetDeletedOrUpdatedTables() {
+	return undo_buffer.GetDeletedOrUpdatedTables();
+}
+
 bool DuckTransaction::AutomaticCheckpoint(AttachedDatabase &db, const UndoBufferProperties &properties) {
 	if (!ChangesMade()) {
 		// read-only transactions cannot trigger an automated checkpoint
@@ -8,11 +8,15 @@
 #include "duckdb/catalog/catalog.hpp"
 #include "duckdb/catalog/dependency_manager.hpp"
 #include "duckdb/storage/storage_manager.hpp"
+#include "duckdb/storage/write_ahead_log.hpp"
 #include "duckdb/transaction/duck_transaction.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/connection_manager.hpp"
 #include "duckdb/main/attached_database.hpp"
 #include "duckdb/main/database_manager.hpp"
+#include "duckdb/main/config.hpp"
+#include "duckdb/main/result_cache.hpp"
+#include "duckdb/main/valid_checker.hpp"
 #include "duckdb/transaction/meta_transaction.hpp"
 
 namespace duckdb {
@@ -59,6 +63,10 @@ Transaction &DuckTransactionManager::StartTransaction(ClientContext &context) {
 
 	// obtain the start time and transaction ID of this transaction
 	transaction_t start_time = current_start_timestamp++;
+	if (!unsynced_commits.empty()) {
+		// commits that are not yet durable in the WAL are not visible to new transactions
+		start_time = MinValue<transaction_t>(start_time, *unsynced_commits.begin());
+	}
 	transaction_t transaction_id = current_transaction_id++;
 	if (active_transactions.empty()) {
 		lowest_active_start = start_time;
@@ -231,6 +239,7 @@ ErrorData DuckTransactionManager::CommitTransaction(ClientContext &context, Tran
 	ErrorData error;
 	unique_ptr<lock_guard<mutex>> held_wal_lock;
 	unique_ptr<StorageCommitState> commit_state;
+	optional_ptr<WriteAheadLog> wal;
 	if (!checkpoint_decision.can_checkpoint && transaction.ShouldWriteToWAL(db)) {
 		// if we are committing changes and we are not checkpointing, we need to write to the WAL
 		// since WAL writes can take a long time - we grab the WAL lock here and unlock the transaction lock
@@ -248,10 +257,17 @@ ErrorData DuckTransactionManager::CommitTransaction(ClientContext &context, Tran
 		// grab the WAL lock and hold it until the entire commit is finished
 		held_wal_lock = make_uniq<lock_guard<mutex>>(wal_lock);
 		error = transaction.WriteToWAL(db, commit_state);
+		wal = db.GetStorageManager().GetWAL();
 
 		// after we finish writing to the WAL we grab the transaction lock again
 		tlock.lock();
 	}
+	// if the WAL is synced after the commit (group commit), we reserve a start time that lies just before the commit id
+	// transactions that start before the sync has finished use it as their start time - so they cannot see the commit
+	transaction_t unsynced_start_time = MAX_TRANSACTION_ID;
+	if (wal) {
+		unsynced_start_time = current_start_timestamp++;
+	}
 	// obtain a commit id for the transaction
 	transaction_t commit_id = GetCommitTimestamp();
 	// commit the UndoBuffer of the transaction
@@ -268,6 +284,45 @@ ErrorData DuckTransactionManager::CommitTransaction(ClientContext &context, Tran
 		if (transaction.catalog_version >= TRANSACTION_ID_START) {
 			transaction.catalog_version = ++last_committed_version;
 		}
+		// invalidate the cached results that depend on the changes of the transaction
+		if (undo_properties.has_catalog_changes) {
+			ResultCache::Get(db.GetDatabase()).Clear();
+		} else if (transaction.ChangesMade()) {
+			ResultCache::Get(db.GetDatabase()).Invalidate();
+		}
+	}
+	if (!error.HasError() && wal) {
+		// the commit has been written to the WAL but not yet synced
+		// we sync without holding the WAL lock, so that commits of other transactions that are written in the meantime
+		// are made durable by the same sync (group commit)
+		// the write lock of the transaction prevents a checkpoint from removing the WAL while we wait
+		auto wal_commit = wal->GetLastFlushedCommit();
+		held_wal_lock.reset();
+		// catalog changes are synced while holding the transaction lock, new transactions cannot observe the new
+		// catalog version before the changes are durable
+		bool release_transaction_lock = !undo_properties.has_catalog_changes;
+		unsynced_commits.insert(unsynced_start_time);
+		if (release_transaction_lock) {
+			tlock.unlock();
+		}
+		try {
+			wal->SyncCommit(wal_commit, DBConfig::Get(db).options.wal_commit_delay);
+		} catch (std::exception &ex) {
+			// the commit is applied in memory but is not durable, and the WAL can no longer be truncated since other
+			// commits might have been written after it - the database can not be used anymore
+			ErrorData sync_error(ex);
+			error = ErrorData(ExceptionType::FATAL,
+			                  "Failed to sync the write-ahead log on commit: " + sync_error.RawMessage());
+			ValidChecker::Invalidate(db.GetDatabase(), error.RawMessage());
+		}
+		if (release_transaction_lock) {
+			tlock.lock();
+		}
+		// commits are published in the order of their commit ids - wait until the earlier commits are synced as well,
+		// otherwise transactions that start after this commit has returned could still not see it
+		unsynced_commits_cv.wait(tlock, [&]() { return *unsynced_commits.begin() == unsynced_start_time; });
+		unsynced_commits.erase(unsynced_commits.begin());
+		unsynced_commits_cv.notify_all();
 	}
 	OnCommitCheckpointDecision(checkpoint_decision, transaction);
 
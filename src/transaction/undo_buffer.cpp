@@ -13,6 +13,9 @@
 #include "duckdb/execution/index/bound_index.hpp"
 #include "duckdb/transaction/wal_write_state.hpp"
 #include "duckdb/transaction/delete_info.hpp"
+#include "duckdb/transaction/update_info.hpp"
+#include "duckdb/storage/table/column_data.hpp"
+#include "duckdb/storage/table/update_segment.hpp"
 
 namespace duckdb {
 constexpr uint32_t UNDO_ENTRY_HEADER_SIZE = sizeof(UndoFlags) + sizeof(uint32_t);
@@ -158,6 +161,31 @@ UndoBufferProperties UndoBuffer::GetProperties() {
 	return properties;
 }
 
+reference_set_t<DataTableInfo> UndoBuffer::GetDeletedOrUpdatedTables() {
+	reference_set_t<DataTableInfo> result;
+	if (!ChangesMade()) {
+		return result;
+	}
+	IteratorState iterator_state;
+	IterateEntries(iterator_state, [&](UndoFlags entry_type, data_ptr_t data) {
+		switch (entry_type) {
+		case UndoFlags::UPDATE_TUPLE: {
+			auto info = reinterpret_cast<UpdateInfo *>(data);
+			result.insert(info->segment->column_data.info);
+			break;
+		}
+		case UndoFlags::DELETE_TUPLE: {
+			auto info = reinterpret_cast<DeleteInfo *>(data);
+			result.insert(*info->table->GetDataTableInfo());
+			break;
+		}
+		default:
+			break;
+		}
+	});
+	return result;
+}
+
 void UndoBuffer::Cleanup(transaction_t lowest_active_transaction) {
 	// garbage collect everything in the Undo Chunk
 	// this should only happen if
@@ -1,6 +1,7 @@
 #include "catch.hpp"
 
 #include "arrow/arrow_test_helper.hpp"
+#include "duckdb/common/types/arrow_string_view_type.hpp"
 
 using namespace duckdb;
 
@@ -144,6 +145,105 @@ TEST_CASE("Test Arrow String View", "[arrow][.]") {
 	    "SELECT NULL UNION SELECT (i*10^i)::varchar str FROM range(10000) tbl(i)");
 }
 
+TEST_CASE("Test Arrow zero-copy export", "[arrow]") {
+	DuckDB db;
+	Connection con(db);
+	REQUIRE_NO_FAIL(con.Query("SET produce_arrow_string_view=True"));
+	auto result = con.Query("SELECT i::INTEGER i, CASE WHEN i % 7 = 0 THEN NULL WHEN i % 2 = 0 THEN 'short' || i "
+	                        "ELSE 'a string that is not inlined ' || i END s FROM range(5000) tbl(i)");
+	REQUIRE_NO_FAIL(*result);
+	auto client_properties = con.context->GetClientProperties();
+
+	idx_t row_idx = 0;
+	while (true) {
+		auto chunk = result->Fetch();
+		if (!chunk || chunk->size() == 0) {
+			break;
+		}
+		ArrowArray array;
+		ArrowConverter::ToArrowArray(*chunk, &array, client_properties, true);
+		// the array references the memory of the chunk, and keeps it alive after the chunk is destroyed
+		auto count = chunk->size();
+		chunk.reset();
+		REQUIRE(idx_t(array.length) == count);
+
+		auto &integers = *array.children[0];
+		auto &strings = *array.children[1];
+		auto integer_data = reinterpret_cast<const int32_t *>(integers.buffers[1]);
+		auto validity = reinterpret_cast<const uint8_t *>(strings.buffers[0]);
+		auto views = reinterpret_cast<const arrow_string_view_t *>(strings.buffers[1]);
+		auto buffer_sizes = reinterpret_cast<const int64_t *>(strings.buffers[strings.n_buffers - 1]);
+		idx_t mismatches = 0;
+		for (idx_t i = 0; i < count; i++, row_idx++) {
+			if (integer_data[i] != int32_t(row_idx)) {
+				mismatches++;
+			}
+			bool is_valid = validity[i / 8] & (1 << (i % 8));
+			if (row_idx % 7 == 0 || !is_valid) {
+				mismatches += row_idx % 7 == 0 && !is_valid ? 0 : 1;
+				continue;
+			}
+			auto view = views[i];
+			string str;
+			if (view.IsInline()) {
+				str = string(view.GetInlineData(), NumericCast<idx_t>(view.Length()));
+			} else {
+				auto buffer_idx = view.GetBufferIndex();
+				if (view.GetOffset() + view.Length() > buffer_sizes[buffer_idx]) {
+					mismatches++;
+					continue;
+				}
+				auto buffer = reinterpret_cast<const char *>(strings.buffers[2 + buffer_idx]);
+				str = string(buffer + view.GetOffset(), NumericCast<idx_t>(view.Length()));
+			}
+			auto expected = (row_idx % 2 == 0 ? "short" : "a string that is not inlined ") + to_string(row_idx);
+			if (str != expected) {
+				mismatches++;
+			}
+		}
+		REQUIRE(mismatches == 0);
+		array.release(&array);
+	}
+	REQUIRE(row_idx == 5000);
+}
+
+TEST_CASE("Test Arrow zero-copy export only borrows owned memory", "[arrow]") {
+	DuckDB db;
+	Connection con(db);
+	auto client_properties = con.context->GetClientProperties();
+
+	vector<LogicalType> types {LogicalType::INTEGER, LogicalType::INTEGER};
+	DataChunk chunk;
+	chunk.Initialize(Allocator::DefaultAllocator(), types);
+	// the first vector owns its data, the second vector points into memory that its buffer does not own
+	auto owned_data = FlatVector::GetData<int32_t>(chunk.data[0]);
+	auto external_data = make_unsafe_uniq_array<int32_t>(STANDARD_VECTOR_SIZE);
+	for (idx_t i = 0; i < STANDARD_VECTOR_SIZE; i++) {
+		owned_data[i] = int32_t(i);
+		external_data[i] = int32_t(i);
+	}
+	FlatVector::SetData(chunk.data[1], data_ptr_cast(external_data.get()));
+	chunk.SetCardinality(STANDARD_VECTOR_SIZE);
+
+	ArrowArray array;
+	ArrowConverter::ToArrowArray(chunk, &array, client_properties, true);
+	REQUIRE(array.children[0]->buffers[1] == owned_data);
+	REQUIRE(array.children[1]->buffers[1] != external_data.get());
+
+	// the array holds a copy of the external memory
+	external_data.reset();
+	chunk.Destroy();
+	auto integer_data = reinterpret_cast<const int32_t *>(array.children[1]->buffers[1]);
+	idx_t mismatches = 0;
+	for (idx_t i = 0; i < STANDARD_VECTOR_SIZE; i++) {
+		if (integer_data[i] != int32_t(i)) {
+			mismatches++;
+		}
+	}
+	REQUIRE(mismatches == 0);
+	array.release(&array);
+}
+
 TEST_CASE("Test TPCH arrow roundtrip", "[arrow][.]") {
 	DBConfig config;
 	DuckDB db(nullptr, &config);
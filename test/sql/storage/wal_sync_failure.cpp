@@ -0,0 +1,68 @@
+#include "catch.hpp"
+#include "test_helpers.hpp"
+#include "duckdb/common/local_file_system.hpp"
+#include "duckdb/common/virtual_file_system.hpp"
+
+using namespace duckdb;
+using namespace std;
+
+//! File system that fails to sync the WAL on request
+class FailingSyncFileSystem : public LocalFileSystem {
+public:
+	explicit FailingSyncFileSystem(atomic<bool> &fail_sync) : fail_sync(fail_sync) {
+	}
+
+	void FileSync(FileHandle &handle) override {
+		if (fail_sync && StringUtil::EndsWith(handle.GetPath(), ".wal")) {
+			throw IOException("Injected sync failure of \"%s\"", handle.GetPath());
+		}
+		LocalFileSystem::FileSync(handle);
+	}
+
+	bool CanHandleFile(const string &fpath) override {
+		return true;
+	}
+
+	std::string GetName() const override {
+		return "FailingSyncFileSystem";
+	}
+
+private:
+	atomic<bool> &fail_sync;
+};
+
+TEST_CASE("Test a failing WAL sync on commit", "[storage]") {
+	auto config = GetTestConfig();
+	auto storage_database = TestCreatePath("wal_sync_failure");
+	atomic<bool> fail_sync(false);
+
+	config->options.checkpoint_wal_size = idx_t(-1);
+	config->options.checkpoint_on_shutdown = false;
+	DeleteDatabase(storage_database);
+	{
+		auto file_system = make_uniq<VirtualFileSystem>();
+		file_system->RegisterSubSystem(make_uniq<FailingSyncFileSystem>(fail_sync));
+		config->file_system = std::move(file_system);
+		DuckDB db(storage_database, config.get());
+		Connection con(db);
+		Connection con2(db);
+		REQUIRE_NO_FAIL(con.Query("CREATE TABLE integers (i INTEGER)"));
+		REQUIRE_NO_FAIL(con.Query("INSERT INTO integers VALUES (1), (2), (3)"));
+
+		// the commit is not durable: it fails and the database can no longer be used
+		fail_sync = true;
+		REQUIRE_FAIL(con.Query("INSERT INTO integers VALUES (4)"));
+		fail_sync = false;
+		REQUIRE_FAIL(con.Query("SELECT SUM(i) FROM integers"));
+		REQUIRE_FAIL(con2.Query("SELECT SUM(i) FROM integers"));
+	}
+	{
+		// the commits that were synced before the failure are durable
+		config->file_system.reset();
+		DuckDB db(storage_database, config.get());
+		Connection con(db);
+		auto result = con.Query("SELECT COUNT(*) FROM integers WHERE i <= 3");
+		REQUIRE(CHECK_COLUMN(result, 0, {3}));
+	}
+	DeleteDatabase(storage_database);
+}
@@ -6,6 +6,7 @@
 #include "duckdb/main/client_config.hpp"
 #include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/in_filter.hpp"
 #include "duckdb/planner/filter/struct_filter.hpp"
 #include "duckdb/planner/table_filter.hpp"
 
@@ -44,11 +45,14 @@ py::object PythonTableArrowArrayStreamFactory::ProduceScanner(py::object &arrow_
 	auto filters = parameters.filters;
 	auto &column_list = parameters.projected_columns.columns;
 	auto &filter_to_col = parameters.projected_columns.filter_to_col;
-	bool has_filter = filters && !filters->filters.empty();
+	py::object filter = py::none();
+	if (filters && !filters->filters.empty()) {
+		filter = TransformFilter(*filters, parameters.projected_columns.projection_map, filter_to_col,
+		                         client_properties, arrow_table);
+	}
+	bool has_filter = !filter.is_none();
 	py::list projection_list = py::cast(column_list);
 	if (has_filter) {
-		auto filter = TransformFilter(*filters, parameters.projected_columns.projection_map, filter_to_col,
-		                              client_properties, arrow_table);
 		if (column_list.empty()) {
 			return arrow_scanner(arrow_obj_handle, py::arg("filter") = filter);
 		} else {
@@ -345,9 +349,13 @@ py::object TransformFilterRecursive(TableFilter *filter, vector<string> &column_
 		//! Get first non null filter type
 		auto child_filter = or_filter.child_filters[i++].get();
 		py::object expression = TransformFilterRecursive(child_filter, column_ref, timezone_config, type);
-		while (i < or_filter.child_filters.size()) {
+		while (i < or_filter.child_filters.size() && !expression.is_none()) {
 			child_filter = or_filter.child_filters[i++].get();
 			py::object child_expression = TransformFilterRecursive(child_filter, column_ref, timezone_config, type);
+			if (child_expression.is_none()) {
+				//! if one of the children can't be pushed the disjunction can't be pushed either
+				return py::none();
+			}
 			expression = expression.attr("__or__")(child_expression);
 		}
 		return expression;
@@ -360,7 +368,15 @@ py::object TransformFilterRecursive(TableFilter *filter, vector<string> &column_
 		while (i < and_filter.child_filters.size()) {
 			child_filter = and_filter.child_filters[i++].get();
 			py::object child_expression = TransformFilterRecursive(child_filter, column_ref, timezone_config, type);
-			expression = expression.attr("__and__")(child_expression);
+			if (child_expression.is_none()) {
+				//! children that can't be pushed are checked by DuckDB after the scan
+				continue;
+			}
+			if (expression.is_none()) {
+				expression = child_expression;
+			} else {
+				expression = expression.attr("__and__")(child_expression);
+			}
 		}
 		return expression;
 	}
@@ -378,8 +394,25 @@ py::object TransformFilterRecursive(TableFilter *filter, vector<string> &column_
 
 		return child_expr;
 	}
+	case TableFilterType::IN_FILTER: {
+		auto &in_filter = filter->Cast<InFilter>();
+		auto constant_field = field(py::tuple(py::cast(column_ref)));
+		py::object expression = py::none();
+		for (auto &value : in_filter.values) {
+			auto constant_value = GetScalar(value, timezone_config, type);
+			auto child_expression = constant_field.attr("__eq__")(constant_value);
+			if (expression.is_none()) {
+				expression = child_expression;
+			} else {
+				expression = expression.attr("__or__")(child_expression);
+			}
+		}
+		return expression;
+	}
 	default:
-		throw NotImplementedException("Pushdown Filter Type not supported in Arrow Scans");
+		//! Filters we can't express in Arrow (e.g. join bloom filters) are only skipped, DuckDB checks them after the
+		//! scan
+		return py::none();
 	}
 }
 
@@ -389,21 +422,23 @@ py::object PythonTableArrowArrayStreamFactory::TransformFilter(TableFilterSet &f
                                                                const ClientProperties &config,
                                                                const ArrowTableType &arrow_table) {
 	auto filters_map = &filter_collection.filters;
-	auto it = filters_map->begin();
-	D_ASSERT(columns.find(it->first) != columns.end());
-	auto arrow_type = &arrow_table.GetColumns().at(filter_to_col.at(it->first));
-
+	py::object expression = py::none();
 	vector<string> column_ref;
-	column_ref.push_back(columns[it->first]);
-	py::object expression = TransformFilterRecursive(it->second.get(), column_ref, config.time_zone, **arrow_type);
-	while (it != filters_map->end()) {
-		arrow_type = &arrow_table.GetColumns().at(filter_to_col.at(it->first));
+	for (auto it = filters_map->begin(); it != filters_map->end(); it++) {
+		D_ASSERT(columns.find(it->first) != columns.end());
+		auto arrow_type = &arrow_table.GetColumns().at(filter_to_col.at(it->first));
 		column_ref.clear();
 		column_ref.push_back(columns[it->first]);
 		py::object child_expression =
 		    TransformFilterRecursive(it->second.get(), column_ref, config.time_zone, **arrow_type);
-		expression = expression.attr("__and__")(child_expression);
-		it++;
+		if (child_expression.is_none()) {
+			continue;
+		}
+		if (expression.is_none()) {
+			expression = child_expression;
+		} else {
+			expression = expression.attr("__and__")(child_expression);
+		}
 	}
 	return expression;
 }
@@ -75,7 +75,7 @@ public:
 	const ClientProperties client_properties;
 
 private:
-	//! We transform a TableFilterSet to an Arrow Expression Object
+	//! We transform a TableFilterSet to an Arrow Expression Object (None if none of the filters can be pushed)
 	static py::object TransformFilter(TableFilterSet &filters, std::unordered_map<idx_t, string> &columns,
 	                                  unordered_map<idx_t, idx_t> filter_to_col,
 	                                  const ClientProperties &client_properties, const ArrowTableType &arrow_table);
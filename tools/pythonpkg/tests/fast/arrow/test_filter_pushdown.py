@@ -918,3 +918,33 @@ class TestArrowFilterPushdown(object):
         ).fetchall() == [(28, '28')]
 
         pa.unregister_extension_type("duckdb.uhugeint")
+
+    @pytest.mark.parametrize('create_table', [create_pyarrow_table, create_pyarrow_dataset])
+    def test_join_filter_pushdown(self, duckdb_cursor, create_table):
+        duckdb_cursor.execute(
+            "CREATE TABLE probe AS SELECT i AS k, i::VARCHAR AS s FROM range(1000000) tbl(i) ORDER BY hash(i)"
+        )
+        arrow_table = create_table(duckdb_cursor.table("probe"))
+
+        # a small build side pushes an IN filter into the arrow scan
+        duckdb_cursor.execute("CREATE TABLE small_build AS SELECT * FROM (VALUES (7), (7), (123456), (999999)) t(k)")
+        assert duckdb_cursor.execute(
+            "SELECT COUNT(*), SUM(arrow_table.k) FROM arrow_table JOIN small_build USING (k)"
+        ).fetchall() == [(4, 1123469)]
+
+        # a larger build side pushes a bloom filter, which can't be expressed in arrow and is skipped
+        duckdb_cursor.execute("CREATE TABLE large_build AS SELECT i * 97 AS k FROM range(10000) tbl(i)")
+        assert duckdb_cursor.execute(
+            "SELECT COUNT(*), SUM(arrow_table.k) FROM arrow_table JOIN large_build USING (k)"
+        ).fetchall() == [(10000, 4849515000)]
+
+        # the join filters are combined with filters that can be pushed
+        assert duckdb_cursor.execute(
+            "SELECT COUNT(*) FROM arrow_table JOIN large_build USING (k) WHERE arrow_table.k < 9700"
+        ).fetchall() == [(100,)]
+
+    def test_join_filter_pushdown_polars(self, duckdb_cursor):
+        pl = pytest.importorskip("polars")
+        probe = pl.DataFrame({'k': range(100000)})
+        build = pl.DataFrame({'k': [i * 7 for i in range(5000)]})
+        assert duckdb_cursor.execute("SELECT COUNT(*) FROM probe JOIN build USING (k)").fetchall() == [(5000,)]